@@ -43,6 +43,7 @@ void FLyraAimAssistTarget::ResetTarget()
 	Location = FVector::ZeroVector;
 	DeltaMovement = FVector::ZeroVector;
 	ScreenBounds.Init();
+	ScreenBoundsLocation = FVector::ZeroVector;
 
 	ViewDistance = 0.0f;
 	SortScore = 0.0f;
@@ -51,6 +52,7 @@ void FLyraAimAssistTarget::ResetTarget()
 	AssistWeight = 0.0f;
 
 	VisibilityTraceHandle = FTraceHandle();
+	LastVisibilityTraceFrame = 0;
 
 	bIsVisible = false;
 	bUnderAssistInnerReticle = false;
@@ -14,6 +14,13 @@
 #include "Character/LyraHealthComponent.h"
 #include "ShooterCoreRuntimeSettings.h"
 #include "DrawDebugHelpers.h"
+#include "Async/ParallelFor.h"
+#include "Engine/GameInstance.h"
+
+DECLARE_CYCLE_STAT(TEXT("Aim Assist Score Targets"), STAT_AimAssistScoreTargets, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Aim Assist Projections Reused"), STAT_AimAssistProjectionsReused, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Aim Assist Visibility Traces Deferred"), STAT_AimAssistVisibilityTracesDeferred, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Aim Assist Visibility Results Expired"), STAT_AimAssistVisibilityExpired, STATGROUP_Game);
 
 namespace LyraConsoleVariables
 {
@@ -23,18 +30,64 @@ namespace LyraConsoleVariables
 		bDrawDebugViewfinder,
 		TEXT("Should we draw a debug box for the aim assist target viewfinder?"),
 		ECVF_Cheat);
+
+	static int32 AimAssistParallelScoringMinTargets = 16;
+	static FAutoConsoleVariableRef CVarAimAssistParallelScoringMinTargets(
+		TEXT("lyra.Weapon.AimAssist.ParallelScoringMinTargets"),
+		AimAssistParallelScoringMinTargets,
+		TEXT("Number of aim assist candidates at which projection and scoring is spread over worker threads (0 always runs on the calling thread)"),
+		ECVF_Default);
+
+	static int32 AimAssistVisibilityTraceBudget = 24;
+	static FAutoConsoleVariableRef CVarAimAssistVisibilityTraceBudget(
+		TEXT("lyra.Weapon.AimAssist.VisibilityTraceBudget"),
+		AimAssistVisibilityTraceBudget,
+		TEXT("Maximum number of aim assist visibility traces per frame, shared by all local players (0 is unlimited). Targets that went the longest without a trace are traced first, the others keep their last result."),
+		ECVF_Default);
+
+	static int32 AimAssistVisibilityMaxAgeFrames = 8;
+	static FAutoConsoleVariableRef CVarAimAssistVisibilityMaxAgeFrames(
+		TEXT("lyra.Weapon.AimAssist.VisibilityMaxAgeFrames"),
+		AimAssistVisibilityMaxAgeFrames,
+		TEXT("Number of frames an over budget target keeps its last visibility result before it is considered hidden"),
+		ECVF_Default);
+
+	static float AimAssistProjectionCacheDistance = 1.0f;
+	static FAutoConsoleVariableRef CVarAimAssistProjectionCacheDistance(
+		TEXT("lyra.Weapon.AimAssist.ProjectionCacheDistance"),
+		AimAssistProjectionCacheDistance,
+		TEXT("How far (in uu) the view and a target may move before the target's cached screen bounds are projected again (0 disables the cache)"),
+		ECVF_Default);
+
+	static float AimAssistProjectionCacheAngle = 0.05f;
+	static FAutoConsoleVariableRef CVarAimAssistProjectionCacheAngle(
+		TEXT("lyra.Weapon.AimAssist.ProjectionCacheAngle"),
+		AimAssistProjectionCacheAngle,
+		TEXT("How far (in degrees) the view may rotate before cached target screen bounds are projected again"),
+		ECVF_Default);
 }
 
-const FLyraAimAssistTarget* FindTarget(const TArray<FLyraAimAssistTarget>& Targets, const UShapeComponent* TargetComponent)
+/** A filtered aim assist candidate, packed so it can be projected and scored off the game thread */
+struct FAimAssistTargetCandidate
 {
-	const FLyraAimAssistTarget* FoundTarget = Targets.FindByPredicate(
-	[&TargetComponent](const FLyraAimAssistTarget& Target)
-	{
-		return (Target.TargetShapeComponent == TargetComponent);
-	});
+	// Inputs, gathered on the game thread
+	TWeakObjectPtr<UShapeComponent> TargetShapeComponent;
+	FTransform TargetTransform;
+	FCollisionShape TargetShape;
+	FVector TargetShapeOrigin = FVector::ZeroVector;
+	const FLyraAimAssistTarget* OldTarget = nullptr;
+
+	// Outputs, written by the scoring job
+	FBox2D ScreenBounds = FBox2D(ForceInitToZero);
+	FVector ScreenBoundsLocation = FVector::ZeroVector;
+	float ViewDistance = 0.0f;
+	float SortScore = 0.0f;
+	bool bAccepted = false;
+	bool bReusedProjection = false;
+	bool bUnderAssistInnerReticle = false;
+	bool bUnderAssistOuterReticle = false;
+};
 
-	return FoundTarget;
-}
 
 static bool GatherTargetInfo(const AActor* Actor, const UShapeComponent* ShapeComponent, FTransform& OutTransform, FCollisionShape& OutShape, FVector& OutShapeOrigin)
 {
@@ -163,10 +216,18 @@ void UAimAssistTargetManagerComponent::GetVisibleTargets(const FAimAssistFilter&
 		}
 	}
 	
-	// Gather targets that are in front of the player
+	// Index last frame's targets so their state can be carried over
+	TMap<const UShapeComponent*, const FLyraAimAssistTarget*> OldTargetsByComponent;
+	OldTargetsByComponent.Reserve(OldTargets.Num());
+	for (const FLyraAimAssistTarget& OldTarget : OldTargets)
+	{
+		OldTargetsByComponent.Add(OldTarget.TargetShapeComponent.Get(), &OldTarget);
+	}
+
+	// Gather candidates that pass the filter into a packed array
+	TArray<FAimAssistTargetCandidate> Candidates;
+	Candidates.Reserve(NewTargetData.Num());
 	{
-		const FVector PawnLocation = OwnerPawn->GetActorLocation();		
-		
 		for (FAimAssistTargetOptions& AimAssistTarget : NewTargetData)
 		{
 			if (!DoesTargetPassFilter(OwnerData, Filter, AimAssistTarget, TargetRange))
@@ -176,16 +237,30 @@ void UAimAssistTargetManagerComponent::GetVisibleTargets(const FAimAssistFilter&
 			
 			AActor* OwningActor = AimAssistTarget.TargetShapeComponent->GetOwner();
 
-			FTransform TargetTransform;
-			FCollisionShape TargetShape;
-			FVector TargetShapeOrigin;
-
-			if (!GatherTargetInfo(OwningActor, AimAssistTarget.TargetShapeComponent.Get(), TargetTransform, TargetShape, TargetShapeOrigin))
+			FAimAssistTargetCandidate Candidate;
+			if (!GatherTargetInfo(OwningActor, AimAssistTarget.TargetShapeComponent.Get(), Candidate.TargetTransform, Candidate.TargetShape, Candidate.TargetShapeOrigin))
 			{
 				continue;
 			}
-			
-			const FVector TargetViewLocation = TargetTransform.TransformPositionNoScale(TargetShapeOrigin);
+
+			Candidate.TargetShapeComponent = AimAssistTarget.TargetShapeComponent;
+			Candidate.OldTarget = OldTargetsByComponent.FindRef(AimAssistTarget.TargetShapeComponent.Get());
+			Candidates.Add(MoveTemp(Candidate));
+		}
+	}
+
+	// Project and score the targets that are in front of the player. This only reads the packed candidates and the view data, so it can be spread over worker threads.
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AimAssistScoreTargets);
+
+		const bool bCanReuseProjections = CanReuseTargetProjections(OwnerData);
+		const float ProjectionCacheDistanceSquared = FMath::Square(LyraConsoleVariables::AimAssistProjectionCacheDistance);
+
+		auto ScoreCandidate = [&](int32 CandidateIndex)
+		{
+			FAimAssistTargetCandidate& Candidate = Candidates[CandidateIndex];
+
+			const FVector TargetViewLocation = Candidate.TargetTransform.TransformPositionNoScale(Candidate.TargetShapeOrigin);
 			const FVector TargetViewVector = (TargetViewLocation - ViewLocation);
 
 			FVector TargetViewDirection;
@@ -194,63 +269,92 @@ void UAimAssistTargetManagerComponent::GetVisibleTargets(const FAimAssistFilter&
 			const float TargetViewDot = FVector::DotProduct(TargetViewDirection, ViewForward);
 			if (TargetViewDot <= 0.0f)
 			{
-				continue;
+				return;
 			}
-			
-			const FLyraAimAssistTarget* OldTarget = FindTarget(OldTargets, AimAssistTarget.TargetShapeComponent.Get());
 
-			// Calculate the screen bounds for this target
+			const FLyraAimAssistTarget* OldTarget = Candidate.OldTarget;
+			const FVector TargetLocation = Candidate.TargetTransform.GetTranslation();
+
+			// Calculate the screen bounds for this target, reusing last frame's if neither the view nor the target has really moved
 			FBox2D TargetScreenBounds(ForceInitToZero);
-			const bool bUpdateTargetProjections = true;
-			if (bUpdateTargetProjections)
+			if (bCanReuseProjections && OldTarget && OldTarget->ScreenBounds.bIsValid
+				&& (FVector::DistSquared(TargetLocation, OldTarget->ScreenBoundsLocation) <= ProjectionCacheDistanceSquared))
 			{
-				TargetScreenBounds = OwnerData.ProjectShapeToScreen(TargetShape, TargetShapeOrigin, TargetTransform);
+				TargetScreenBounds = OldTarget->ScreenBounds;
+				Candidate.ScreenBoundsLocation = OldTarget->ScreenBoundsLocation;
+				Candidate.bReusedProjection = true;
 			}
 			else
 			{
-				// Target projections are not being updated so use the values from the previous frame if the target existed.
-				if (OldTarget)
-				{
-					TargetScreenBounds = OldTarget->ScreenBounds;
-				}
+				TargetScreenBounds = OwnerData.ProjectShapeToScreen(Candidate.TargetShape, Candidate.TargetShapeOrigin, Candidate.TargetTransform);
+				Candidate.ScreenBoundsLocation = TargetLocation;
 			}
 
 			if (!TargetScreenBounds.bIsValid)
 			{
-				continue;
+				return;
 			}
 
 			if (!TargetingReticleBounds.Intersect(TargetScreenBounds))
+			{
+				return;
+			}
+
+			Candidate.ScreenBounds = TargetScreenBounds;
+			Candidate.ViewDistance = TargetViewDistance;
+			Candidate.bUnderAssistInnerReticle = AssistInnerReticleBounds.Intersect(TargetScreenBounds);
+			Candidate.bUnderAssistOuterReticle = AssistOuterReticleBounds.Intersect(TargetScreenBounds);
+
+			// Calculate a score used for sorting based on previous weight, distance from target, and distance from reticle.
+			const float AssistWeight = OldTarget ? OldTarget->AssistWeight : 0.0f;
+			const float AssistWeightScore = (AssistWeight * Settings.TargetScore_AssistWeight);
+			const float ViewDotScore = ((TargetViewDot * Settings.TargetScore_ViewDot) - Settings.TargetScore_ViewDotOffset);
+			const float ViewDistanceScore = ((1.0f - (TargetViewDistance / TargetRange)) * Settings.TargetScore_ViewDistance);
+
+			Candidate.SortScore = (AssistWeightScore + ViewDotScore + ViewDistanceScore);
+			Candidate.bAccepted = true;
+		};
+
+		const int32 MinParallelTargets = LyraConsoleVariables::AimAssistParallelScoringMinTargets;
+		const bool bScoreInParallel = (MinParallelTargets > 0) && (Candidates.Num() >= MinParallelTargets);
+		ParallelFor(Candidates.Num(), ScoreCandidate, bScoreInParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+	}
+
+	// Build the new targets in candidate order so results don't depend on how the job was split up
+	{
+		for (const FAimAssistTargetCandidate& Candidate : Candidates)
+		{
+			if (!Candidate.bAccepted)
 			{
 				continue;
 			}
 
-			FLyraAimAssistTarget NewTarget;
+			FLyraAimAssistTarget& NewTarget = OutNewTargets.AddDefaulted_GetRef();
 
-			NewTarget.TargetShapeComponent = AimAssistTarget.TargetShapeComponent;
-			NewTarget.Location = TargetTransform.GetTranslation();
-			NewTarget.ScreenBounds = TargetScreenBounds;
-			NewTarget.ViewDistance = TargetViewDistance;
-			NewTarget.bUnderAssistInnerReticle = AssistInnerReticleBounds.Intersect(TargetScreenBounds);
-			NewTarget.bUnderAssistOuterReticle = AssistOuterReticleBounds.Intersect(TargetScreenBounds);
+			NewTarget.TargetShapeComponent = Candidate.TargetShapeComponent;
+			NewTarget.Location = Candidate.TargetTransform.GetTranslation();
+			NewTarget.ScreenBounds = Candidate.ScreenBounds;
+			NewTarget.ScreenBoundsLocation = Candidate.ScreenBoundsLocation;
+			NewTarget.ViewDistance = Candidate.ViewDistance;
+			NewTarget.SortScore = Candidate.SortScore;
+			NewTarget.bUnderAssistInnerReticle = Candidate.bUnderAssistInnerReticle;
+			NewTarget.bUnderAssistOuterReticle = Candidate.bUnderAssistOuterReticle;
 			
 			// Transfer target data from last frame.
-			if (OldTarget)
+			if (const FLyraAimAssistTarget* OldTarget = Candidate.OldTarget)
 			{
 				NewTarget.DeltaMovement = (NewTarget.Location - OldTarget->Location);
 				NewTarget.AssistTime = OldTarget->AssistTime;
 				NewTarget.AssistWeight = OldTarget->AssistWeight;
 				NewTarget.VisibilityTraceHandle = OldTarget->VisibilityTraceHandle;
+				NewTarget.LastVisibilityTraceFrame = OldTarget->LastVisibilityTraceFrame;
+				NewTarget.bIsVisible = OldTarget->bIsVisible;
 			}
 
-			// Calculate a score used for sorting based on previous weight, distance from target, and distance from reticle.
-			const float AssistWeightScore = (NewTarget.AssistWeight * Settings.TargetScore_AssistWeight);
-			const float ViewDotScore = ((TargetViewDot * Settings.TargetScore_ViewDot) - Settings.TargetScore_ViewDotOffset);
-			const float ViewDistanceScore = ((1.0f - (TargetViewDistance / TargetRange)) * Settings.TargetScore_ViewDistance);
-
-			NewTarget.SortScore = (AssistWeightScore + ViewDotScore + ViewDistanceScore);
-
-			OutNewTargets.Add(NewTarget);
+			if (Candidate.bReusedProjection)
+			{
+				INC_DWORD_STAT(STAT_AimAssistProjectionsReused);
+			}
 		}
 	}
 
@@ -265,13 +369,91 @@ void UAimAssistTargetManagerComponent::GetVisibleTargets(const FAimAssistFilter&
 		OutNewTargets.SetNum(Settings.MaxNumberOfTargets, false);
 	}
 
-	// Do visibliity traces on the targets
+	// Visibility traces come out of a budget shared by all local players this frame, each request gets an even share of it
 	{
-		for (FLyraAimAssistTarget& Target : OutNewTargets)
+		const int32 TraceBudget = LyraConsoleVariables::AimAssistVisibilityTraceBudget;
+		if (TraceBudget > 0)
 		{
-			DetermineTargetVisibility(Target, Settings, Filter, OwnerData);
+			if (VisibilityTraceBudgetFrame != GFrameCounter)
+			{
+				VisibilityTraceBudgetFrame = GFrameCounter;
+				VisibilityTracesRemainingThisFrame = TraceBudget;
+			}
+
+			const UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+			const int32 NumLocalPlayers = GameInstance ? FMath::Max(GameInstance->GetNumLocalPlayers(), 1) : 1;
+			VisibilityTracesRemainingThisRequest = FMath::Min(VisibilityTracesRemainingThisFrame, FMath::DivideAndRoundUp(TraceBudget, NumLocalPlayers));
+		}
+		else
+		{
+			VisibilityTracesRemainingThisRequest = MAX_int32;
 		}
 	}
+
+	// Do visibliity traces on the targets, the ones that went the longest without a trace first so none of them starve when over budget
+	{
+		TArray<int32, TInlineAllocator<32>> TraceOrder;
+		TraceOrder.Reserve(OutNewTargets.Num());
+		for (int32 TargetIndex = 0; TargetIndex < OutNewTargets.Num(); ++TargetIndex)
+		{
+			TraceOrder.Add(TargetIndex);
+		}
+
+		if (VisibilityTracesRemainingThisRequest < OutNewTargets.Num())
+		{
+			TraceOrder.StableSort([&OutNewTargets](const int32 IndexA, const int32 IndexB)
+			{
+				return (OutNewTargets[IndexA].LastVisibilityTraceFrame < OutNewTargets[IndexB].LastVisibilityTraceFrame);
+			});
+		}
+
+		for (const int32 TargetIndex : TraceOrder)
+		{
+			DetermineTargetVisibility(OutNewTargets[TargetIndex], Settings, Filter, OwnerData);
+		}
+	}
+}
+
+bool UAimAssistTargetManagerComponent::CanReuseTargetProjections(const FAimAssistOwnerViewData& OwnerData)
+{
+	FProjectionViewCache& ViewCache = ProjectionViewCaches.FindOrAdd(OwnerData.PlayerController);
+
+	const float CacheDistance = LyraConsoleVariables::AimAssistProjectionCacheDistance;
+	const float CacheAngleRadians = FMath::DegreesToRadians(LyraConsoleVariables::AimAssistProjectionCacheAngle);
+
+	const bool bViewIsStable = (CacheDistance > 0.0f)
+		&& (ViewCache.ViewRect == OwnerData.ViewRect)
+		&& ViewCache.ProjectionMatrix.Equals(OwnerData.ProjectionMatrix, KINDA_SMALL_NUMBER)
+		&& (FVector::DistSquared(ViewCache.ViewTransform.GetTranslation(), OwnerData.ViewTransform.GetTranslation()) <= FMath::Square(CacheDistance))
+		&& (ViewCache.ViewTransform.GetRotation().AngularDistance(OwnerData.ViewTransform.GetRotation()) <= CacheAngleRadians);
+
+	// Only move the reference view when everything gets re-projected, otherwise slow drift would never invalidate the cache
+	if (!bViewIsStable)
+	{
+		ViewCache.ViewTransform = OwnerData.ViewTransform;
+		ViewCache.ProjectionMatrix = OwnerData.ProjectionMatrix;
+		ViewCache.ViewRect = OwnerData.ViewRect;
+	}
+
+	return bViewIsStable;
+}
+
+bool UAimAssistTargetManagerComponent::ConsumeVisibilityTraceBudget()
+{
+	if (VisibilityTracesRemainingThisRequest == MAX_int32)
+	{
+		return true;
+	}
+
+	if (VisibilityTracesRemainingThisRequest <= 0 || VisibilityTracesRemainingThisFrame <= 0)
+	{
+		INC_DWORD_STAT(STAT_AimAssistVisibilityTracesDeferred);
+		return false;
+	}
+
+	--VisibilityTracesRemainingThisRequest;
+	--VisibilityTracesRemainingThisFrame;
+	return true;
 }
 
 bool UAimAssistTargetManagerComponent::DoesTargetPassFilter(const FAimAssistOwnerViewData& OwnerData, const FAimAssistFilter& Filter, const FAimAssistTargetOptions& Target, const float AcceptableRange) const
@@ -427,20 +609,49 @@ void UAimAssistTargetManagerComponent::DetermineTargetVisibility(FLyraAimAssistT
 		}
 
 		// Only start a new asynchronous trace for next frame if the target is still visible.
+		// If we're over budget the target keeps its current result and tries again next frame.
 		if (Target.bIsVisible)
 		{
-			Target.VisibilityTraceHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Test, OwnerData.ViewTransform.GetTranslation(), TargetEyeLocation, ECC_Visibility, QueryParams, ResponseParams);
+			if (ConsumeVisibilityTraceBudget())
+			{
+				Target.VisibilityTraceHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Test, OwnerData.ViewTransform.GetTranslation(), TargetEyeLocation, ECC_Visibility, QueryParams, ResponseParams);
+				Target.LastVisibilityTraceFrame = GFrameCounter;
+			}
+			else
+			{
+				ExpireVisibility(Target);
+			}
 		}
 	}
 	else
 	{
-		Target.bIsVisible = !World->LineTraceTestByChannel(OwnerData.ViewTransform.GetTranslation(), TargetEyeLocation, ECC_Visibility, QueryParams, ResponseParams);
+		// Over budget targets keep whatever visibility they had last frame (new targets stay hidden until they get a trace)
+		if (ConsumeVisibilityTraceBudget())
+		{
+			Target.bIsVisible = !World->LineTraceTestByChannel(OwnerData.ViewTransform.GetTranslation(), TargetEyeLocation, ECC_Visibility, QueryParams, ResponseParams);
+			Target.LastVisibilityTraceFrame = GFrameCounter;
+		}
+		else
+		{
+			ExpireVisibility(Target);
+		}
 
 		// Invalidate the async trace handle.
 		Target.VisibilityTraceHandle = FTraceHandle();		
 	}
 }
 
+void UAimAssistTargetManagerComponent::ExpireVisibility(FLyraAimAssistTarget& Target)
+{
+	// Don't let a target keep a visibility result that is too old to be trusted
+	const uint64 MaxAgeFrames = FMath::Max(LyraConsoleVariables::AimAssistVisibilityMaxAgeFrames, 0);
+	if (Target.bIsVisible && (GFrameCounter - Target.LastVisibilityTraceFrame) > MaxAgeFrames)
+	{
+		Target.bIsVisible = false;
+		INC_DWORD_STAT(STAT_AimAssistVisibilityExpired);
+	}
+}
+
 void UAimAssistTargetManagerComponent::InitTargetSelectionCollisionParams(FCollisionQueryParams& OutParams, const AActor& RequestedBy, const FAimAssistFilter& Filter) const
 {
 	// Exclude Requester
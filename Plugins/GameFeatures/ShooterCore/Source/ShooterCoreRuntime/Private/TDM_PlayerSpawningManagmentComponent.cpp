@@ -24,59 +24,19 @@ AActor* UTDM_PlayerSpawningManagmentComponent::OnChoosePlayerStart(AController*
 		return nullptr;
 	}
 
-	ALyraGameState* GameState = GetGameStateChecked<ALyraGameState>();
+	const FLyraTeamPawnSpatialHash& TeamPawns = GetTeamPawnSpatialHash();
 
-	ALyraPlayerStart* BestPlayerStart = nullptr;
-	double MaxDistance = 0;
-	ALyraPlayerStart* FallbackPlayerStart = nullptr;
-	double FallbackMaxDistance = 0;
-
-	for (APlayerState* PS : GameState->PlayerArray)
+	// With no enemies around any start will do, let the default random selection handle it
+	if (!TeamPawns.HasPawnsNotOnTeam(PlayerTeamId))
 	{
-		const int32 TeamId = TeamSubsystem->FindTeamFromObject(PS);
-		
-		// We should have a TeamId by now...
-		if (PS->IsOnlyASpectator() || !ensure(TeamId != INDEX_NONE))
-		{
-			continue;
-		}
-
-		// If the other player isn't on the same team, lets find the furthest spawn from them.
-		if (TeamId != PlayerTeamId)
-		{
-			for (ALyraPlayerStart* PlayerStart : PlayerStarts)
-			{
-				if (APawn* Pawn = PS->GetPawn())
-				{
-					const double Distance = PlayerStart->GetDistanceTo(Pawn);
-
-					if (PlayerStart->IsClaimed())
-					{
-						if (FallbackPlayerStart == nullptr || Distance > FallbackMaxDistance)
-						{
-							FallbackPlayerStart = PlayerStart;
-							FallbackMaxDistance = Distance;
-						}
-					}
-					else if (PlayerStart->GetLocationOccupancy(Player) < ELyraPlayerStartLocationOccupancy::Full)
-					{
-						if (BestPlayerStart == nullptr || Distance > MaxDistance)
-						{
-							BestPlayerStart = PlayerStart;
-							MaxDistance = Distance;
-						}
-					}
-				}
-			}
-		}
+		return nullptr;
 	}
 
-	if (BestPlayerStart)
+	// Find the spawn furthest from the closest enemy
+	return ChooseBestScoredPlayerStart(Player, PlayerStarts, [&TeamPawns, PlayerTeamId](const ALyraPlayerStart& PlayerStart)
 	{
-		return BestPlayerStart;
-	}
-
-	return FallbackPlayerStart;
+		return TeamPawns.FindNearestDistanceSquaredNotOnTeam(PlayerStart.GetActorLocation(), PlayerTeamId);
+	});
 }
 
 void UTDM_PlayerSpawningManagmentComponent::OnFinishRestartPlayer(AController* Player, const FRotator& StartRotation)
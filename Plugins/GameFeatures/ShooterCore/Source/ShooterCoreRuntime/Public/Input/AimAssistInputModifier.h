@@ -91,6 +91,9 @@ struct FLyraAimAssistTarget
 	FVector DeltaMovement = FVector::ZeroVector;
 	FBox2D ScreenBounds;
 
+	// Target location that ScreenBounds was projected from, used to decide when the projection can be reused
+	FVector ScreenBoundsLocation = FVector::ZeroVector;
+
 	float ViewDistance = 0.0f;
 	float SortScore = 0.0f;
 
@@ -98,6 +101,9 @@ struct FLyraAimAssistTarget
 	float AssistWeight = 0.0f;
 
 	FTraceHandle VisibilityTraceHandle;
+
+	// Frame the last visibility trace for this target was issued on, 0 if it never got one
+	uint64 LastVisibilityTraceFrame = 0;
 	
 	uint8 bIsVisible : 1;
 	
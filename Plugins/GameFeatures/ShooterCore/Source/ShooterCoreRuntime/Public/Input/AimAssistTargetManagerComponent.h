@@ -43,6 +43,32 @@ protected:
 	/** Determine if the given target is visible based on our current view data. */
 	void DetermineTargetVisibility(FLyraAimAssistTarget& Target, const FAimAssistSettings& Settings, const FAimAssistFilter& Filter, const FAimAssistOwnerViewData& OwnerData);
 	
+	/** Marks an over budget target as hidden once its last visibility trace is too old. */
+	static void ExpireVisibility(FLyraAimAssistTarget& Target);
+
 	/** Setup CollisionQueryParams to ignore a set of actors based on filter settings. Such as Ignoring Requester or Instigator. */
 	void InitTargetSelectionCollisionParams(FCollisionQueryParams& OutParams, const AActor& RequestedBy, const FAimAssistFilter& Filter) const;
+
+	/** Returns true if a visibility trace may be issued for the current request, consuming it from the shared per-frame budget. */
+	bool ConsumeVisibilityTraceBudget();
+
+	/** Returns true if the owner's view is close enough to the one last frame's projections were made from for them to be reused. */
+	bool CanReuseTargetProjections(const FAimAssistOwnerViewData& OwnerData);
+
+	/** The view that cached target screen bounds were projected with, per local player */
+	struct FProjectionViewCache
+	{
+		FTransform ViewTransform = FTransform::Identity;
+		FMatrix ProjectionMatrix = FMatrix::Identity;
+		FIntRect ViewRect = FIntRect(0, 0, 0, 0);
+	};
+
+	TMap<TWeakObjectPtr<const APlayerController>, FProjectionViewCache> ProjectionViewCaches;
+
+	/** Visibility traces shared by every local player, refilled once per frame */
+	uint64 VisibilityTraceBudgetFrame = 0;
+	int32 VisibilityTracesRemainingThisFrame = 0;
+
+	/** Visibility traces the current GetVisibleTargets request may still issue */
+	int32 VisibilityTracesRemainingThisRequest = 0;
 };
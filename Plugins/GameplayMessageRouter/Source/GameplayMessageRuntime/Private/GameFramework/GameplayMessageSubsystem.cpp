@@ -49,17 +49,33 @@ bool UGameplayMessageSubsystem::HasInstance(const UObject* WorldContextObject)
 	return Router != nullptr;
 }
 
+void UGameplayMessageSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	DeferredMessagesTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::HandleDeferredMessagesTick));
+}
+
 void UGameplayMessageSubsystem::Deinitialize()
 {
+	FTSTicker::GetCoreTicker().RemoveTicker(DeferredMessagesTickHandle);
+	DeferredMessagesTickHandle.Reset();
+
+	// Anything still queued has nobody left to receive it
+	DeferredMessages.Empty();
+
 	ListenerMap.Reset();
+	ChannelChainCache.Reset();
 
 	Super::Deinitialize();
 }
 
 void UGameplayMessageSubsystem::BroadcastMessageInternal(FGameplayTag Channel, const UScriptStruct* StructType, const void* MessageBytes)
 {
-	// Log the message if enabled
-	if (UE::GameplayMessageSubsystem::ShouldLogMessages != 0)
+	check(IsInGameThread());
+
+	// Log the message if enabled (skip the ExportText entirely when the category is compiled out or suppressed)
+	if (UE::GameplayMessageSubsystem::ShouldLogMessages != 0 && UE_LOG_ACTIVE(LogGameplayMessageSubsystem, Log))
 	{
 		FString* pContextString = nullptr;
 #if WITH_EDITOR
@@ -75,23 +91,33 @@ void UGameplayMessageSubsystem::BroadcastMessageInternal(FGameplayTag Channel, c
 		UE_LOG(LogGameplayMessageSubsystem, Log, TEXT("BroadcastMessage(%s, %s, %s)"), pContextString ? **pContextString : *GetPathNameSafe(this), *Channel.ToString(), *HumanReadableMessage);
 	}
 
+	// Copy the chain, callbacks may broadcast on new channels and grow the cache while we iterate
+	const TArray<FGameplayTag, TInlineAllocator<8>> ChannelChain(GetChannelChain(Channel));
+
 	// Broadcast the message
-	bool bOnInitialTag = true;
-	for (FGameplayTag Tag = Channel; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+	for (int32 ChainIndex = 0; ChainIndex < ChannelChain.Num(); ++ChainIndex)
 	{
+		const FGameplayTag Tag = ChannelChain[ChainIndex];
+		const bool bOnInitialTag = (ChainIndex == 0);
+
 		if (const FChannelListenerList* pList = ListenerMap.Find(Tag))
 		{
-			// Copy in case there are removals while handling callbacks
-			TArray<FGameplayMessageListenerData> ListenerArray(pList->Listeners);
+			// Hold on to the current snapshot, removals while handling callbacks will swap in a new list rather than modify this one
+			const TSharedPtr<const FListenerArray> ListenerArray = pList->Listeners;
+			if (!ListenerArray.IsValid())
+			{
+				continue;
+			}
 
-			for (const FGameplayMessageListenerData& Listener : ListenerArray)
+			for (const TSharedRef<const FGameplayMessageListenerData>& ListenerRef : *ListenerArray)
 			{
+				const FGameplayMessageListenerData& Listener = *ListenerRef;
 				if (bOnInitialTag || (Listener.MatchType == EGameplayMessageMatch::PartialMatch))
 				{
 					if (Listener.bHadValidType && !Listener.ListenerStructType.IsValid())
 					{
 						UE_LOG(LogGameplayMessageSubsystem, Warning, TEXT("Listener struct type has gone invalid on Channel %s. Removing listener from list"), *Channel.ToString());
-						UnregisterListenerInternal(Channel, Listener.HandleID);
+						UnregisterListenerInternal(Tag, Listener.HandleID);
 						continue;
 					}
 
@@ -111,10 +137,71 @@ void UGameplayMessageSubsystem::BroadcastMessageInternal(FGameplayTag Channel, c
 				}
 			}
 		}
-		bOnInitialTag = false;
 	}
 }
 
+const TArray<FGameplayTag>& UGameplayMessageSubsystem::GetChannelChain(FGameplayTag Channel)
+{
+	if (const TArray<FGameplayTag>* pChain = ChannelChainCache.Find(Channel))
+	{
+		return *pChain;
+	}
+
+	TArray<FGameplayTag>& Chain = ChannelChainCache.Add(Channel);
+	for (FGameplayTag Tag = Channel; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+	{
+		Chain.Add(Tag);
+	}
+	return Chain;
+}
+
+UGameplayMessageSubsystem::FDeferredMessage::FDeferredMessage(FGameplayTag InChannel, const UScriptStruct* InStructType, const void* InMessageBytes)
+	: Channel(InChannel)
+	, StructType(InStructType)
+{
+	MessageBytes = FMemory::Malloc(FMath::Max(StructType->GetStructureSize(), 1), StructType->GetMinAlignment());
+	StructType->InitializeStruct(MessageBytes);
+	StructType->CopyScriptStruct(MessageBytes, InMessageBytes);
+}
+
+UGameplayMessageSubsystem::FDeferredMessage::~FDeferredMessage()
+{
+	StructType->DestroyStruct(MessageBytes);
+	FMemory::Free(MessageBytes);
+}
+
+void UGameplayMessageSubsystem::QueueMessageInternal(FGameplayTag Channel, const UScriptStruct* StructType, const void* MessageBytes)
+{
+	if (ensure(StructType != nullptr && MessageBytes != nullptr))
+	{
+		DeferredMessages.Enqueue(MakeUnique<FDeferredMessage>(Channel, StructType, MessageBytes));
+	}
+}
+
+void UGameplayMessageSubsystem::FlushDeferredMessages()
+{
+	check(IsInGameThread());
+
+	// Only drain what was queued before we started, so listeners that queue more messages can't keep us here forever
+	TArray<TUniquePtr<FDeferredMessage>, TInlineAllocator<16>> Batch;
+	TUniquePtr<FDeferredMessage> Message;
+	while (DeferredMessages.Dequeue(Message))
+	{
+		Batch.Add(MoveTemp(Message));
+	}
+
+	for (const TUniquePtr<FDeferredMessage>& QueuedMessage : Batch)
+	{
+		BroadcastMessageInternal(QueuedMessage->Channel, QueuedMessage->StructType, QueuedMessage->MessageBytes);
+	}
+}
+
+bool UGameplayMessageSubsystem::HandleDeferredMessagesTick(float DeltaTime)
+{
+	FlushDeferredMessages();
+	return true;
+}
+
 void UGameplayMessageSubsystem::K2_BroadcastMessage(FGameplayTag Channel, const int32& Message)
 {
 	// This will never be called, the exec version below will be hit instead
@@ -140,16 +227,23 @@ DEFINE_FUNCTION(UGameplayMessageSubsystem::execK2_BroadcastMessage)
 
 FGameplayMessageListenerHandle UGameplayMessageSubsystem::RegisterListenerInternal(FGameplayTag Channel, TFunction<void(FGameplayTag, const UScriptStruct*, const void*)>&& Callback, const UScriptStruct* StructType, EGameplayMessageMatch MatchType)
 {
+	check(IsInGameThread());
+
 	FChannelListenerList& List = ListenerMap.FindOrAdd(Channel);
 
-	FGameplayMessageListenerData& Entry = List.Listeners.AddDefaulted_GetRef();
-	Entry.ReceivedCallback = MoveTemp(Callback);
-	Entry.ListenerStructType = StructType;
-	Entry.bHadValidType = StructType != nullptr;
-	Entry.HandleID = ++List.HandleID;
-	Entry.MatchType = MatchType;
+	TSharedRef<FGameplayMessageListenerData> Entry = MakeShared<FGameplayMessageListenerData>();
+	Entry->ReceivedCallback = MoveTemp(Callback);
+	Entry->ListenerStructType = StructType;
+	Entry->bHadValidType = StructType != nullptr;
+	Entry->HandleID = ++List.HandleID;
+	Entry->MatchType = MatchType;
+
+	// Publish a new list rather than modifying the one broadcasts may currently be iterating
+	TSharedRef<FListenerArray> NewListeners = List.Listeners.IsValid() ? MakeShared<FListenerArray>(*List.Listeners) : MakeShared<FListenerArray>();
+	NewListeners->Emplace(Entry);
+	List.Listeners = NewListeners;
 
-	return FGameplayMessageListenerHandle(this, Channel, Entry.HandleID);
+	return FGameplayMessageListenerHandle(this, Channel, Entry->HandleID);
 }
 
 void UGameplayMessageSubsystem::UnregisterListener(FGameplayMessageListenerHandle Handle)
@@ -168,15 +262,22 @@ void UGameplayMessageSubsystem::UnregisterListener(FGameplayMessageListenerHandl
 
 void UGameplayMessageSubsystem::UnregisterListenerInternal(FGameplayTag Channel, int32 HandleID)
 {
+	check(IsInGameThread());
+
 	if (FChannelListenerList* pList = ListenerMap.Find(Channel))
 	{
-		int32 MatchIndex = pList->Listeners.IndexOfByPredicate([ID = HandleID](const FGameplayMessageListenerData& Other) { return Other.HandleID == ID; });
-		if (MatchIndex != INDEX_NONE)
+		if (pList->Listeners.IsValid())
 		{
-			pList->Listeners.RemoveAtSwap(MatchIndex);
+			int32 MatchIndex = pList->Listeners->IndexOfByPredicate([ID = HandleID](const TSharedRef<const FGameplayMessageListenerData>& Other) { return Other->HandleID == ID; });
+			if (MatchIndex != INDEX_NONE)
+			{
+				TSharedRef<FListenerArray> NewListeners = MakeShared<FListenerArray>(*pList->Listeners);
+				NewListeners->RemoveAtSwap(MatchIndex);
+				pList->Listeners = NewListeners;
+			}
 		}
 
-		if (pList->Listeners.Num() == 0)
+		if (!pList->Listeners.IsValid() || pList->Listeners->Num() == 0)
 		{
 			ListenerMap.Remove(Channel);
 		}
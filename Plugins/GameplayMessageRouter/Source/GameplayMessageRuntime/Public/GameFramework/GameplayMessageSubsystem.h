@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Engine/World.h"
 #include "GameFramework/GameplayMessageTypes2.h"
@@ -101,6 +103,7 @@ public:
 	static bool HasInstance(const UObject* WorldContextObject);
 
 	//~USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 	//~End of USubsystem interface
 
@@ -117,6 +120,26 @@ public:
 		BroadcastMessageInternal(Channel, StructType, &Message);
 	}
 
+	/**
+	 * Queue a message to be broadcast on the specified channel the next time deferred messages are flushed on the game thread
+	 * Safe to call from any thread; the message is copied, so it does not need to outlive this call
+	 *
+	 * @param Channel			The message channel to broadcast on
+	 * @param Message			The message to send (must be the same type of UScriptStruct expected by the listeners for this channel, otherwise an error will be logged)
+	 */
+	template <typename FMessageStructType>
+	void BroadcastMessageDeferred(FGameplayTag Channel, const FMessageStructType& Message)
+	{
+		const UScriptStruct* StructType = TBaseStructure<FMessageStructType>::Get();
+		QueueMessageInternal(Channel, StructType, &Message);
+	}
+
+	/**
+	 * Broadcast every message queued by BroadcastMessageDeferred, in the order they were queued
+	 * Called automatically once per frame, but can be called earlier from the game thread to deliver messages sooner
+	 */
+	void FlushDeferredMessages();
+
 	/**
 	 * Register to receive messages on a specified channel
 	 *
@@ -222,14 +245,43 @@ private:
 
 	void UnregisterListenerInternal(FGameplayTag Channel, int32 HandleID);
 
+	// Internal helper for queueing a copy of a message to be broadcast later on the game thread
+	void QueueMessageInternal(FGameplayTag Channel, const UScriptStruct* StructType, const void* MessageBytes);
+
+	// Returns the channel followed by all of its parent tags, computed once per channel
+	const TArray<FGameplayTag>& GetChannelChain(FGameplayTag Channel);
+
+	bool HandleDeferredMessagesTick(float DeltaTime);
+
 private:
+	using FListenerArray = TArray<TSharedRef<const FGameplayMessageListenerData>>;
+
 	// List of all entries for a given channel
 	struct FChannelListenerList
 	{
-		TArray<FGameplayMessageListenerData> Listeners;
+		// Never modified once published; registering or unregistering swaps in a new array so that
+		// in-flight broadcasts can keep iterating the snapshot they grabbed
+		TSharedPtr<const FListenerArray> Listeners;
 		int32 HandleID = 0;
 	};
 
+	// A copy of a message waiting to be broadcast on the game thread
+	struct FDeferredMessage
+	{
+		FDeferredMessage(FGameplayTag InChannel, const UScriptStruct* InStructType, const void* InMessageBytes);
+		~FDeferredMessage();
+
+		FGameplayTag Channel;
+		const UScriptStruct* StructType;
+		void* MessageBytes;
+	};
+
 private:
 	TMap<FGameplayTag, FChannelListenerList> ListenerMap;
+
+	TMap<FGameplayTag, TArray<FGameplayTag>> ChannelChainCache;
+
+	TQueue<TUniquePtr<FDeferredMessage>, EQueueMode::Mpsc> DeferredMessages;
+
+	FTSTicker::FDelegateHandle DeferredMessagesTickHandle;
 };
@@ -39,7 +39,8 @@ public:
 	virtual void BeginPlay() override;
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
-	virtual AkGeometrySetID GetGeometrySetID() const { return AkGeometrySetID(this); }
+	virtual AkGeometrySetID GetGeometrySetID() const { return SharedGeometrySetID.IsValid() ? SharedGeometrySetID : AkGeometrySetID(this); }
+	AkGeometryInstanceID GetGeometryInstanceID() const { return AkGeometryInstanceID(this); }
 
 	virtual bool GetGeometryHasBeenSent() const { return GeometryHasBeenSent; }
 	virtual bool GetGeometryInstanceHasBeenSent() const { return GeometryInstanceHasBeenSent; }
@@ -68,6 +69,12 @@ protected:
 	/* Add or update an instance of the geometry. A geometry instance is a unique instance of a geometry set with a specified transform (position, rotation and scale) and room association. 
 	* It is necessary to create at least one geometry instance for each geometry set that is to be used for diffraction and reflection simulation. */
 	void SendGeometryInstanceToWwise(const FRotator& rotation, const FVector& location, const FVector& scale, const AkRoomID roomID);
+	/* Reference the geometry set shared by all the components that sent geometry with the same content hash, if it has already been sent.
+	* Returns false when the geometry must be sent with SendSharedGeometryToWwise(). */
+	bool AcquireSharedGeometry(uint64 GeometryHash);
+	/* Add a geometry set in Spatial Audio that is shared by all the components sending geometry with the same content hash.
+	* Each component still sends its own geometry instance. See SendGeometryInstanceToWwise(). */
+	void SendSharedGeometryToWwise(uint64 GeometryHash, const AkGeometryParams& params);
 	/* Remove a geometry and the corresponding instance from Wwise. */
 	void RemoveGeometryFromWwise();
 	/* Remove a geometry instance from Wwise. */
@@ -86,4 +93,9 @@ private:
 
 	bool GeometryHasBeenSent = false;
 	bool GeometryInstanceHasBeenSent = false;
+
+	/* Release the reference to the shared geometry set, if any. */
+	void ReleaseSharedGeometry();
+	AkGeometrySetID SharedGeometrySetID;
+	uint64 SharedGeometryHash = 0;
 };
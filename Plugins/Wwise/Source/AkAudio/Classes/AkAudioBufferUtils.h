@@ -0,0 +1,31 @@
+/*******************************************************************************
+The content of the files in this repository include portions of the
+AUDIOKINETIC Wwise Technology released in source code form as part of the SDK
+package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use these files in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+Copyright (c) 2022 Audiokinetic Inc.
+*******************************************************************************/
+
+/*=============================================================================
+	AkAudioBufferUtils.h: Sample buffer conversions between Wwise and Unreal.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace AkAudioBufferUtils
+{
+	/**
+	 * Splits an interleaved buffer of NumFrames frames of NumChannels samples into one buffer per channel.
+	 * Uses the Unreal vector intrinsics (SSE or NEON) four frames at a time, and scalar code for the remaining channels and frames.
+	 */
+	AKAUDIO_API void Deinterleave(const float* RESTRICT InInterleaved, float* const* RESTRICT OutPlanar, int32 NumChannels, int32 NumFrames);
+}
@@ -16,13 +16,24 @@ Copyright (c) 2021 Audiokinetic Inc.
 #pragma once
 
 #include "Engine/EngineTypes.h"
-#include "CoreUObject/Public/UObject/StrongObjectPtr.h"
+#include "UObject/GCObject.h"
+#include "HAL/CriticalSection.h"
 
 class UAkCallbackInfo;
 
-class AkCallbackInfoPool final
+/**
+ * Recycles the UAkCallbackInfo objects passed to Blueprint callbacks, to avoid creating UObjects during gameplay.
+ *
+ * The pool is prewarmed per callback info class from UAkSettings::CallbackInfoPoolSettings. Released objects are kept up to
+ * a per-class cap, and unused objects above the prewarm count are trimmed a few at a time on idle frames.
+ * Acquire and Release can be called from any thread.
+ */
+class AkCallbackInfoPool final : public FGCObject
 {
 public:
+	AkCallbackInfoPool();
+	virtual ~AkCallbackInfoPool();
+
 	template<typename CallbackType>
 	CallbackType* Acquire()
 	{
@@ -31,10 +42,35 @@ public:
 
 	void Release(UAkCallbackInfo* instance);
 
+	/** Creates the prewarm count of every callback info class. Game thread only. */
+	void Prewarm();
+
+	/** Trims unused objects if nothing was acquired since the last call. Called once per frame on the game thread. */
+	void Tick();
+
+	//~ FGCObject
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+
 private:
+	struct FClassPool
+	{
+		TArray<UAkCallbackInfo*> Free;
+		int32 PrewarmCount = 0;
+	};
+
 	UAkCallbackInfo* internalAcquire(UClass* type);
+	UAkCallbackInfo* CreateInstance(UClass* type);
+	void DropInstance(UAkCallbackInfo* instance);
 
 private:
-	TMap<UClass*, TArray<UAkCallbackInfo*>> Pool;
-	TArray<TStrongObjectPtr<UAkCallbackInfo>> gcStorage;
+	FCriticalSection Lock;
+	TMap<UClass*, FClassPool> Pool;
+
+	/** Every instance created by the pool and not dropped, free or acquired */
+	TSet<UAkCallbackInfo*> LiveInstances;
+
+	int32 MaxFreePerClass = 128;
+	int32 TrimCountPerIdleFrame = 4;
+	bool bAcquiredSinceLastTick = false;
 };
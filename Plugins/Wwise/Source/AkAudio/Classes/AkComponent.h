@@ -38,6 +38,18 @@ enum class EReflectionFilterBits
 	Floor
 };
 
+/** How much game-side work an AkComponent does, typically decided by a significance manager. See UAkComponent::SetSignificance. */
+UENUM()
+enum class EAkComponentSignificance : uint8
+{
+	/** Ticks every frame and updates its position as soon as it moves. */
+	Full,
+	/** Ticks at a reduced rate. */
+	Reduced,
+	/** Doesn't tick, and only updates its position when it becomes significant again or posts an event. */
+	Inaudible
+};
+
 // PostEvent functions need to return the PlayingID (uint32), but Blueprints only work with int32.
 // Make sure AkPlayingID is always 32 bits, or else we're gonna have a bad time.
 static_assert(sizeof(AkPlayingID) == sizeof(int32), "AkPlayingID is not 32 bits anymore. Change return value of PostEvent functions!");
@@ -307,6 +319,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AkComponent")
 	bool bUseReverbVolumes = true;
 
+	/** Distance, in Unreal units, this component must move before its new position is sent to Wwise. Smaller movements are ignored unless the component also rotates. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "AkComponent", meta = (ClampMin = "0.0"))
+	float PositionUpdateThreshold = 0.1f;
+
 
 	/**
 	 * Return the real attenuation radius for this component (AttenuationScalingFactor * AkAudioEvent->MaxAttenuationRadius)
@@ -314,7 +330,29 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category="Audiokinetic|AkComponent")
 	float GetAttenuationRadius() const;
 
-	void UpdateGameObjectPosition();
+	/**
+	 * Queue this component's position for the AkAudioDevice's next batch of position updates.
+	 *
+	 * @param bForce		Send the position and look up rooms and reverb volumes even if the component didn't move past PositionUpdateThreshold
+	 */
+	void UpdateGameObjectPosition(bool bForce = false);
+
+	/** Location, front and up vectors to send to Wwise for this component */
+	void GetSoundTransform(FVector& Location, FVector& Front, FVector& Up) const;
+
+	/** Called by the AkAudioDevice once it sent a new position to Wwise for this component */
+	void OnPositionSubmitted(const AkSoundPosition& SoundPosition) { CurrentSoundPosition = SoundPosition; }
+	const AkSoundPosition& GetCurrentSoundPosition() const { return CurrentSoundPosition; }
+
+	/**
+	 * Reduce the game-side work done for this component when it can't be heard, e.g. when it is far from every listener or silent.
+	 * Listeners always keep the Full significance, and components that destroy themselves once their events end are never made Inaudible.
+	 *
+	 * @param InSignificance		The new significance of this component
+	 * @param ReducedTickInterval	Tick interval, in seconds, used when the significance is Reduced
+	 */
+	void SetSignificance(EAkComponentSignificance InSignificance, float ReducedTickInterval);
+	EAkComponentSignificance GetSignificance() const { return Significance; }
 
 	void GetAkGameObjectName(FString& Name) const;
 
@@ -358,12 +396,30 @@ public:
 	 */
 	void UpdateAkLateReverbComponentList(FVector Loc);
 
+	/** Updates the list of AkLateReverbComponents from the ones found at the AkComponent's current location
+	 *
+	 * @param FoundComponents		The AkLateReverbComponents at the AkComponent's location, sorted by decreasing priority
+	 */
+	void UpdateAkLateReverbComponentList(TArrayView<class UAkLateReverbComponent* const> FoundComponents);
+
 	/** Gets the current room the AkComponent is in.
 	 * 
 	 * @param Location			The location of the AkComponent
 	 */
 	void UpdateSpatialAudioRoom(FVector Location);
 
+	/** Sets the current room the AkComponent is in.
+	 *
+	 * @param RoomComponents	The AkRoomComponents at the AkComponent's location, sorted by decreasing priority
+	 */
+	void SetSpatialAudioRoom(TArrayView<class UAkRoomComponent* const> RoomComponents);
+
+	/** Index of this component in the AkAudioDevice's queue of environment updates. INDEX_NONE if not queued. */
+	int32 QueuedEnvironmentUpdateIndex = INDEX_NONE;
+
+	/** Index of this component in the AkAudioDevice's queue of position updates. INDEX_NONE if not queued. */
+	int32 QueuedPositionUpdateIndex = INDEX_NONE;
+
 	void SetAutoDestroy(bool in_AutoDestroy) { bAutoDestroy = in_AutoDestroy; }
 
 	bool UseDefaultListeners() const { return bUseDefaultListeners; }
@@ -385,7 +441,7 @@ public:
 
 	AkRoomID GetSpatialAudioRoom() const;
 
-	void UpdateOcclusionObstruction() { ObstructionService.UpdateObstructionOcclusion(Listeners, GetPosition(), GetOwner(), GetSpatialAudioRoom(), GetOcclusionCollisionChannel(), OcclusionRefreshInterval); }
+	void UpdateOcclusionObstruction();
 
 	FVector GetPosition() const;
 
@@ -443,6 +499,13 @@ private:
 	AkSoundPosition CurrentSoundPosition;
 	bool HasMoved();
 
+	EAkComponentSignificance Significance = EAkComponentSignificance::Full;
+	/** Tick interval to restore when going back to the Full significance */
+	float FullSignificanceTickInterval = 0.f;
+	float ReducedSignificanceTickInterval = 0.f;
+	/** Whether the component moved while Inaudible */
+	bool bPositionUpdateDeferred = false;
+
 #endif
 
 #if WITH_EDITORONLY_DATA
@@ -15,64 +15,87 @@ Copyright (c) 2021 Audiokinetic Inc.
 
 #pragma once
 
-#include "Math/GenericOctree.h"
 #include "AkUEFeatures.h"
+#include "Algo/StableSort.h"
 #include "Components/SceneComponent.h"
-#include "EngineDefines.h"
+#include "Containers/ArrayView.h"
 
-class UAkEnvironmentOctree;
-
-#if UE_4_26_OR_LATER
-#define AK_OCTREE_TYPE TOctree2
-#define AK_OCTREE_ELEMENT_ID FOctreeElementId2
-#else
-#define AK_OCTREE_TYPE TOctree
-#define AK_OCTREE_ELEMENT_ID FOctreeElementId
-#endif
-
-struct FAkEnvironmentOctreeElement
+/** Flat storage of the environments indexed in one world.
+	Bounds are kept as separate arrays (one per axis) so a query is a linear scan over contiguous memory, and the
+	components are kept sorted by decreasing priority so the results of a query are already ordered.
+*/
+struct FAkEnvironmentWorldIndex
 {
-	USceneComponent* Component;
-
-	FBoxCenterAndExtent BoundingBox;
-
-	FAkEnvironmentOctreeElement(USceneComponent* in_Component)
-	{
-		Component = in_Component;
-		BoundingBox = FBoxCenterAndExtent(Component->Bounds.GetBox().GetCenter(), Component->Bounds.GetBox().GetExtent());
-	}
-};
+	using FReal = decltype(FVector::X);
 
-struct FAkEnvironmentOctreeSemantics
-{
-	typedef AK_OCTREE_TYPE<FAkEnvironmentOctreeElement, FAkEnvironmentOctreeSemantics> FOctree;
+	TArray<USceneComponent*> Components;
+	TArray<float> Priorities;
+	TArray<FReal> MinX;
+	TArray<FReal> MinY;
+	TArray<FReal> MinZ;
+	TArray<FReal> MaxX;
+	TArray<FReal> MaxY;
+	TArray<FReal> MaxZ;
 
-	enum { MaxElementsPerLeaf = 16 };
-	enum { MinInclusiveElementsPerNode = 7 };
-	enum { MaxNodeDepth = 12 };
+	/** Union of all the bounds above, used to reject locations outside of every environment. */
+	FBox TotalBounds = FBox(ForceInit);
 
-	typedef TInlineAllocator<MaxElementsPerLeaf> ElementAllocator;
+	/** Components, bounds or priorities changed since the arrays were last built. */
+	bool bDirty = false;
 
-	FORCEINLINE static FBoxCenterAndExtent GetBoundingBox(const FAkEnvironmentOctreeElement& Element)
-	{
-		return Element.BoundingBox;
-	}
+	/** Re-reads the bounds and priorities of all Components and rebuilds the sorted arrays. */
+	void Rebuild();
 
-	FORCEINLINE static bool AreElementsEqual(const FAkEnvironmentOctreeElement& A, const FAkEnvironmentOctreeElement& B)
+	/**
+		Appends the environments that overlap Location to OutResult, sorted by decreasing priority.
+		Does not allocate unless OutResult needs to grow.
+	*/
+	template <typename EnvironmentType, typename AllocatorType>
+	void Query(const FVector& Location, TArray<EnvironmentType*, AllocatorType>& OutResult)
 	{
-		return (A.Component == B.Component);
-	}
-
-	static void SetElementId(FOctree& OctreeOwner, const FAkEnvironmentOctreeElement& Element, AK_OCTREE_ELEMENT_ID Id);
-};
+		if (!TotalBounds.IsInsideOrOn(Location))
+		{
+			return;
+		}
 
-class UAkEnvironmentOctree : public AK_OCTREE_TYPE<FAkEnvironmentOctreeElement, FAkEnvironmentOctreeSemantics>
-{
-public:
+		const int32 FirstResult = OutResult.Num();
+		bool bPriorityChanged = false;
+		const int32 Count = Components.Num();
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			if (Location.X < MinX[Index] || Location.X > MaxX[Index] ||
+				Location.Y < MinY[Index] || Location.Y > MaxY[Index] ||
+				Location.Z < MinZ[Index] || Location.Z > MaxZ[Index])
+			{
+				continue;
+			}
 
-	UAkEnvironmentOctree() : AK_OCTREE_TYPE<FAkEnvironmentOctreeElement, FAkEnvironmentOctreeSemantics>(FVector::ZeroVector, HALF_WORLD_MAX) {}
+			EnvironmentType* Env = Cast<EnvironmentType>(Components[Index]);
+			if (Env &&
+				Env->bEnable &&
+				Env->HasEffectOnLocation(Location))
+			{
+				// Priority can be modified without the component being reindexed.
+				if (UNLIKELY(Env->Priority != Priorities[Index]))
+				{
+					bPriorityChanged = true;
+				}
+				OutResult.Add(Env);
+			}
+		}
 
-	TMap<uint32, AK_OCTREE_ELEMENT_ID> ObjectToOctreeId;
+		if (UNLIKELY(bPriorityChanged))
+		{
+			bDirty = true;
+			if (OutResult.Num() - FirstResult > 1)
+			{
+				Algo::StableSort(MakeArrayView(OutResult.GetData() + FirstResult, OutResult.Num() - FirstResult), [](const EnvironmentType* A, const EnvironmentType* B)
+					{
+						return A->Priority > B->Priority;
+					});
+			}
+		}
+	}
 };
 
 /** A spatial indexing data structure used to accelerate geometric queries. 
@@ -89,50 +112,47 @@ public:
 	TArray<EnvironmentType*> Query(const FVector& Location, const UWorld* World)
 	{
 		TArray<EnvironmentType*> Result;
+		Query(Location, World, Result);
+		return Result;
+	}
 
-		TUniquePtr<UAkEnvironmentOctree>* Octree = Map.Find(World);
-
-		if (Octree != nullptr)
+	/**
+		Query a world and location for an environmental rooms or late reverb components.
+		Fills OutResult with the components that overlap Location, sorted by decreasing priority.
+		OutResult is reset but keeps its allocation, so it can be reused between queries.
+	*/
+	template <typename EnvironmentType, typename AllocatorType>
+	void Query(const FVector& Location, const UWorld* World, TArray<EnvironmentType*, AllocatorType>& OutResult)
+	{
+		OutResult.Reset();
+		if (FAkEnvironmentWorldIndex* WorldIndex = GetWorldIndex(World))
 		{
-#if UE_4_26_OR_LATER
-			FBoxCenterAndExtent BoxBounds(Location, FVector::ZeroVector);
-			(*Octree)->FindElementsWithBoundsTest(BoxBounds, [&Result, Location](const FAkEnvironmentOctreeElement& Element)
-				{
-					EnvironmentType* Env = Cast<EnvironmentType>(Element.Component);
-					if (Env &&
-						Env->bEnable &&
-						Env->HasEffectOnLocation(Location))
-					{
-						Result.Add(Env);
-					}
-				});
-#else
-			for (UAkEnvironmentOctree::TConstElementBoxIterator<>	It(**Octree, FBoxCenterAndExtent(Location, FVector(ForceInitToZero)));
-				It.HasPendingElements();
-				It.Advance())
-			{
-				const FAkEnvironmentOctreeElement& Element = It.GetCurrentElement();
-				EnvironmentType* Env = Cast<EnvironmentType>(Element.Component);
-				if (Env &&
-					Env->bEnable &&
-					Env->HasEffectOnLocation(Location))
-				{
-					Result.Add(Env);
-				}
-			}
-#endif
+			WorldIndex->Query(Location, OutResult);
 		}
+	}
 
-		// Sort the found Volumes
-		if (Result.Num() > 1)
+	/**
+		Query a world for the environmental rooms or late reverb components at multiple locations at once.
+		The components overlapping Locations[i] are stored in OutResults, from OutResultOffsets[i] (inclusive)
+		to OutResultOffsets[i + 1] (exclusive), sorted by decreasing priority.
+		Both output arrays are reset but keep their allocation, so they can be reused between frames.
+	*/
+	template <typename EnvironmentType>
+	void QueryBatch(TArrayView<const FVector> Locations, const UWorld* World, TArray<EnvironmentType*>& OutResults, TArray<int32>& OutResultOffsets)
+	{
+		OutResults.Reset();
+		OutResultOffsets.Reset(Locations.Num() + 1);
+
+		FAkEnvironmentWorldIndex* WorldIndex = GetWorldIndex(World);
+		for (const auto& Location : Locations)
 		{
-			Result.Sort([](const EnvironmentType& A, const EnvironmentType& B)
-				{
-					return A.Priority > B.Priority;
-				});
+			OutResultOffsets.Add(OutResults.Num());
+			if (WorldIndex)
+			{
+				WorldIndex->Query(Location, OutResults);
+			}
 		}
-
-		return Result;
+		OutResultOffsets.Add(OutResults.Num());
 	}
 
 	/**
@@ -161,5 +181,16 @@ public:
 	bool IsEmpty(const UWorld* World);
 
 private:
-	TMap<UWorld*, TUniquePtr<UAkEnvironmentOctree> > Map;
+	/** Returns the index of World, rebuilt if needed. nullptr if nothing was ever indexed in World. */
+	FAkEnvironmentWorldIndex* GetWorldIndex(const UWorld* World)
+	{
+		FAkEnvironmentWorldIndex* WorldIndex = Map.Find(World);
+		if (WorldIndex && WorldIndex->bDirty)
+		{
+			WorldIndex->Rebuild();
+		}
+		return WorldIndex;
+	}
+
+	TMap<const UWorld*, FAkEnvironmentWorldIndex> Map;
 };
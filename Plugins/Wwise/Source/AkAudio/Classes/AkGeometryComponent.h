@@ -118,6 +118,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geometry", meta = (ClampMin = "0.0"))
 	float WeldingThreshold;
 
+	/** (Optional) Simplify the static mesh sent to Spatial Audio by welding its vertices on a coarser grid, in local Unreal units. Leave it to 0 to send the mesh at full resolution.
+	* A simplified mesh has fewer triangles and diffraction edges to process, at the cost of accuracy. Reflections are computed on the same simplified mesh.
+	* Only used when it is larger than the Welding Threshold and diffraction is enabled.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geometry", meta = (ClampMin = "0.0", EditCondition = "bEnableDiffraction"))
+	float DiffractionSimplificationThreshold;
+
 	/** Override the acoustic properties of this mesh per material.*/
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geometry", DisplayName = "Acoustic Properties Override")
 	TMap<UMaterialInterface*, FAkGeometrySurfaceOverride> StaticMeshSurfaceOverride;
@@ -185,6 +192,7 @@ private:
 	void InitializeParent();
 
 	void CalculateSurfaceArea(UStaticMeshComponent* StaticMeshComponent);
+	float GetEffectiveWeldingThreshold() const;
 
 	void ConvertStaticMesh(UStaticMeshComponent* StaticMeshComponent, const UAkSettings* AkSettings);
 	void ConvertCollisionMesh(UPrimitiveComponent* PrimitiveComponent, const UAkSettings* AkSettings);
@@ -25,9 +25,23 @@ Copyright (c) 2021 Audiokinetic Inc.
 class AKAUDIO_API FAkJobWorkerScheduler
 {
 public:
-	FAkJobWorkerScheduler() : uMaxExecutionTime(100) {}
-
-	void InstallJobWorkerScheduler(uint32 uMaxExecutionTime, AkJobMgrSettings& out_settings);
+	FAkJobWorkerScheduler() : uMaxExecutionTime(100)
+	{
+		for (int i = 0; i < AK_NUM_JOB_TYPES; i++)
+		{
+			JobTypeThread[i] = ENamedThreads::AnyHiPriThreadNormalTask;
+			JobTypeMaxExecutionTime[i] = uMaxExecutionTime;
+		}
+	}
+
+	/** Installs the job worker callbacks, using the per-job-type settings of UAkSettings. in_uMaxExecutionTime is used for job types without their own time slice. */
+	void InstallJobWorkerScheduler(uint32 in_uMaxExecutionTime, AkJobMgrSettings& out_settings);
 
 	uint32 uMaxExecutionTime;
+
+	/** Task Graph threads on which the workers of each job type are dispatched */
+	ENamedThreads::Type JobTypeThread[AK_NUM_JOB_TYPES];
+
+	/** Maximum execution time of the workers of each job type, in microseconds */
+	uint32 JobTypeMaxExecutionTime[AK_NUM_JOB_TYPES];
 };
@@ -76,6 +76,66 @@ struct FAkAcousticTextureParams
 	TArray<float> AsTArray() const { return { AbsorptionLow(), AbsorptionMidLow(), AbsorptionMidHigh(), AbsorptionHigh() }; }
 };
 
+/** Task Graph threads on which the Sound Engine job workers of a job type run. */
+UENUM()
+enum class EAkJobWorkerThreadPriority : uint8
+{
+	High UMETA(ToolTip = "High priority Task Graph threads. Jobs compete with other audio and rendering tasks."),
+	Normal UMETA(ToolTip = "Normal priority Task Graph threads. Jobs compete with regular game tasks."),
+	Background UMETA(ToolTip = "Background Task Graph threads. Jobs only run when the game tasks leave cores available. Falls back to Normal when the platform has no background threads."),
+};
+
+USTRUCT()
+struct FAkJobWorkerSettings
+{
+	GENERATED_BODY()
+
+	// Maximum number of Task Graph workers processing this job type at the same time. 0 to use every Task Graph worker thread.
+	UPROPERTY(EditAnywhere, Category = "Job Worker", meta = (ClampMin = 0, UIMin = 0))
+	int32 MaxActiveWorkers = 0;
+
+	UPROPERTY(EditAnywhere, Category = "Job Worker")
+	EAkJobWorkerThreadPriority ThreadPriority = EAkJobWorkerThreadPriority::High;
+
+	// Maximum time a job worker processes jobs of this type before yielding its thread, in microseconds. 0 to use the Job Worker Max Execution Time of the platform's initialization settings.
+	UPROPERTY(EditAnywhere, Category = "Job Worker", meta = (ClampMin = 0, UIMin = 0))
+	int32 MaxExecutionTimeUSec = 0;
+};
+
+USTRUCT()
+struct FAkCallbackInfoPoolSettings
+{
+	GENERATED_BODY()
+
+	// Number of Ak Callback Info objects created at startup for callbacks without specific information.
+	UPROPERTY(EditAnywhere, Category = "Callback Info Pool", meta = (ClampMin = 0, UIMin = 0))
+	int32 CallbackInfoPrewarmCount = 4;
+
+	// Number of Ak Event Callback Info objects created at startup, used by End of Event callbacks.
+	UPROPERTY(EditAnywhere, Category = "Callback Info Pool", meta = (ClampMin = 0, UIMin = 0))
+	int32 EventCallbackInfoPrewarmCount = 32;
+
+	UPROPERTY(EditAnywhere, Category = "Callback Info Pool", meta = (ClampMin = 0, UIMin = 0))
+	int32 MIDIEventCallbackInfoPrewarmCount = 0;
+
+	UPROPERTY(EditAnywhere, Category = "Callback Info Pool", meta = (ClampMin = 0, UIMin = 0))
+	int32 MarkerCallbackInfoPrewarmCount = 16;
+
+	UPROPERTY(EditAnywhere, Category = "Callback Info Pool", meta = (ClampMin = 0, UIMin = 0))
+	int32 DurationCallbackInfoPrewarmCount = 8;
+
+	UPROPERTY(EditAnywhere, Category = "Callback Info Pool", meta = (ClampMin = 0, UIMin = 0))
+	int32 MusicSyncCallbackInfoPrewarmCount = 8;
+
+	// Maximum number of unused objects kept per callback info class. Objects released above this count are left to the garbage collector.
+	UPROPERTY(EditAnywhere, Category = "Callback Info Pool", meta = (ClampMin = 0, UIMin = 0))
+	int32 MaxFreeCallbackInfosPerClass = 128;
+
+	// Number of unused objects above the prewarm count released per frame, on frames where no callback info was acquired.
+	UPROPERTY(EditAnywhere, Category = "Callback Info Pool", meta = (ClampMin = 0, UIMin = 0))
+	int32 TrimCountPerIdleFrame = 4;
+};
+
 #define AK_MAX_AUX_PER_OBJ	4
 
 DECLARE_EVENT(UAkSettings, ActivatedNewAssetManagement);
@@ -143,6 +203,15 @@ public:
 	// Default value for Occlusion Collision Channel when creating a new Ak Component.
 	UPROPERTY(Config, EditAnywhere, Category = "Occlusion")
 	TEnumAsByte<ECollisionChannel> DefaultOcclusionCollisionChannel = ECollisionChannel::ECC_Visibility;
+
+	// Maximum number of occlusion and obstruction line traces issued per frame, for all Ak Components and Ak Acoustic Portals of a world.
+	// Refreshes that do not fit in the budget are delayed to the next frames, audible and closer sources first.
+	UPROPERTY(Config, EditAnywhere, Category = "Occlusion", meta = (ClampMin = 1, UIMin = 1))
+	int32 OcclusionTraceBudgetPerFrame = 512;
+
+	// Listener-side occlusion traces ending within this distance of each other are shared between sources, in Unreal units. 0 to disable.
+	UPROPERTY(Config, EditAnywhere, Category = "Occlusion", meta = (ClampMin = 0.0f, UIMin = 0.0f))
+	float OcclusionListenerTraceShareDistance = 25.0f;
 	
 	// Default value for Collision Channel when fitting Ak Acoustic Portals and Ak Spatial Audio Volumes to surrounding geometry.
 	UPROPERTY(Config, EditAnywhere, Category = "Fit To Geometry")
@@ -186,6 +255,22 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Audio Mixer")
 	TSoftObjectPtr<class UAkAudioEvent> AudioInputEvent = nullptr;
 
+	// Scheduling of the Sound Engine generic jobs when Multi-Core Rendering is enabled. Requires Editor restart.
+	UPROPERTY(Config, EditAnywhere, Category = "Multi-Core Rendering")
+	FAkJobWorkerSettings GenericJobWorkerSettings;
+
+	// Scheduling of the Sound Engine audio processing jobs when Multi-Core Rendering is enabled. Requires Editor restart.
+	UPROPERTY(Config, EditAnywhere, Category = "Multi-Core Rendering")
+	FAkJobWorkerSettings AudioProcessingJobWorkerSettings;
+
+	// Scheduling of the Spatial Audio jobs when Multi-Core Rendering is enabled. Requires Editor restart.
+	UPROPERTY(Config, EditAnywhere, Category = "Multi-Core Rendering")
+	FAkJobWorkerSettings SpatialAudioJobWorkerSettings;
+
+	// Pooling of the callback information objects passed to Blueprint event callbacks. Requires Editor restart.
+	UPROPERTY(Config, EditAnywhere, Category = "Callbacks")
+	FAkCallbackInfoPoolSettings CallbackInfoPoolSettings;
+
 	UPROPERTY(Config)
 	TMap<FGuid, FAkAcousticTextureParams> AcousticTextureParamsMap;
 
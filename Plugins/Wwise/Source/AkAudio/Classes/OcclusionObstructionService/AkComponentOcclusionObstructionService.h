@@ -37,6 +37,10 @@ public:
 
 	virtual ~AkComponentOcclusionObstructionService() {}
 
+protected:
+	virtual bool IsAudible() const override;
+	virtual float GetAudibleRadius() const override;
+
 private:
-	UAkComponent * AssociatedComponent;
+	UAkComponent * AssociatedComponent = nullptr;
 };
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*******************************************************************************
+The content of the files in this repository include portions of the
+AUDIOKINETIC Wwise Technology released in source code form as part of the SDK
+package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use these files in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+Copyright (c) 2021 Audiokinetic Inc.
+*******************************************************************************/
+
+
+/*=============================================================================
+AkOcclusionObstructionScheduler.h:
+=============================================================================*/
+
+#pragma once
+
+#include "AkInclude.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+
+class AActor;
+class UWorld;
+class AkOcclusionObstructionService;
+
+/**
+ * Issues the occlusion and obstruction traces of all the AkOcclusionObstructionServices of the worlds, within a per-frame budget.
+ *
+ * Services request a refresh of the occlusion between their source and a listener. Once per world tick, the pending requests are
+ * served by decreasing priority until the trace budget is spent; the remaining requests gain priority and wait for the next frames.
+ * Listener-side traces ending on the same point are shared between sources, and the results of all completed traces are written
+ * back to the services in one pass.
+ */
+class FAkOcclusionObstructionScheduler
+{
+public:
+	struct FRequest
+	{
+		AkOcclusionObstructionService* Service = nullptr;
+		AkGameObjectID ListenerID = AK_INVALID_GAME_OBJECT;
+		FVector SourcePosition;
+		FVector ListenerPosition;
+		TWeakObjectPtr<const AActor> Actor;
+		ECollisionChannel CollisionChannel = ECollisionChannel::ECC_Visibility;
+		float Priority = 0.f;
+
+		/** Number of frames this request was delayed because of the trace budget. */
+		int32 Age = 0;
+	};
+
+	/** Queues the refresh of the occlusion between a service's source and a listener. Services keep at most one pending request per listener. */
+	void RequestRefresh(UWorld* World, const FRequest& Request);
+
+	/** Forgets the pending requests and in-flight traces of a service that is being destroyed. */
+	void Unregister(AkOcclusionObstructionService* Service);
+
+	/** Writes back the completed trace results, then issues the traces of the highest priority requests. */
+	void Tick(UWorld* World);
+
+	void ClearWorld(UWorld* World);
+
+private:
+	struct FTraceTarget
+	{
+		AkOcclusionObstructionService* Service;
+		AkGameObjectID ListenerID;
+		int32 PointIndex;
+		bool bFromListener;
+	};
+
+	struct FPendingTrace
+	{
+		FTraceHandle Handle;
+		TArray<FTraceTarget, TInlineAllocator<1>> Targets;
+	};
+
+	struct FListenerTraceKey
+	{
+		AkGameObjectID ListenerID;
+		FIntVector EndCell;
+		ECollisionChannel CollisionChannel;
+
+		bool operator==(const FListenerTraceKey& Rhs) const
+		{
+			return ListenerID == Rhs.ListenerID && EndCell == Rhs.EndCell && CollisionChannel == Rhs.CollisionChannel;
+		}
+
+		friend uint32 GetTypeHash(const FListenerTraceKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.ListenerID), GetTypeHash(Key.EndCell)), GetTypeHash((uint8)Key.CollisionChannel));
+		}
+	};
+
+	struct FWorldState
+	{
+		TArray<FRequest> Requests;
+		TArray<FPendingTrace> PendingTraces;
+
+		/** Listener-side traces issued this frame, as indices in PendingTraces. */
+		TMap<FListenerTraceKey, int32> ListenerTraces;
+	};
+
+	void WriteBackResults(UWorld* World, FWorldState& State);
+
+	/** Traces the direct path of a request, and the secondary paths if it is occluded. Returns the number of traces issued. */
+	int32 ServeRequest(UWorld* World, FWorldState& State, const FRequest& Request, const AActor* PlayerPawn, float ShareDistance);
+
+	TMap<UWorld*, FWorldState> Worlds;
+};
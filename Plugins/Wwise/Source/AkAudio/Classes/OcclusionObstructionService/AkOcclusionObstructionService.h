@@ -55,31 +55,20 @@ struct FAkListenerOcclusionObstructionPair
 
 	bool ReachedTarget();
 
-	/** Trace a ray from a source position to a bounding box point asynchronously */
-	void AsyncTraceFromSource(const FVector& SourcePosition, const FVector& EndPosition, int BoundingBoxPointIndex, ECollisionChannel CollisionChannel, UWorld* World, const FCollisionQueryParams& CollisionParams);
-	/** Trace a ray from a listener position to a bounding box point asynchronously */
-	void AsyncTraceFromListener(const FVector& ListenerPosition, const FVector& EndPosition, int BoundingBoxPointIndex, ECollisionChannel CollisionChannel, UWorld* World, const FCollisionQueryParams& CollisionParams);
+	/** Store the result of a ray traced between a bounding box point and the source or the listener */
+	void SetRayCollision(int BoundingBoxPointIndex, bool bFromListener, bool bCollision);
 
 	/** Get the total number of listener OR source collisions. */
 	int GetCollisionCount();
 
 	void Reset();
 
-
-	/** Iterate through all trace handles and handle the results if ready */
-	void CheckTraceResults(UWorld* World);
-
+	/** A refresh was requested to the FAkOcclusionObstructionScheduler and was not served yet */
+	bool bRefreshPending = false;
 
 private:
 	/** Used to check when obstruction and occlusion targets need to be updated (when GetCollisionCount() != CurrentCollisionCount) */
 	int CurrentCollisionCount = 0;
-	TArray<FTraceHandle> SourceTraceHandles;
-	TArray<FTraceHandle> ListenerTraceHandles;
-
-	/** Iterate through all listener trace handles and handle the trace results if ready */
-	void CheckListenerTraceHandles(UWorld* World);
-	/** Iterate through all source trace handles and handle the trace results if ready */
-	void CheckSourceTraceHandles(UWorld* World);
 
 	TArray<FThreadSafeBool> SourceRayCollisions;
 	TArray<FThreadSafeBool> ListenerRayCollisions;
@@ -99,11 +88,26 @@ public:
 
 	virtual void SetOcclusionObstruction(AkGameObjectID ListenerID, float Value) = 0;
 
-	virtual ~AkOcclusionObstructionService() {}
+	virtual ~AkOcclusionObstructionService();
+
+	/** Called by the FAkOcclusionObstructionScheduler once the direct path to ListenerID was traced. */
+	void OnRefreshServed(AkGameObjectID ListenerID, bool bDirectPathOccluded);
+
+	/** Called by the FAkOcclusionObstructionScheduler once a secondary path to ListenerID was traced. */
+	void OnRayCollision(AkGameObjectID ListenerID, int BoundingBoxPointIndex, bool bFromListener, bool bCollision);
+
+	/** Translate the impact point of an occluding hit to points on the bounding box of the obstacle */
+	static void GetBoundingBoxTracePoints(const FHitResult& OutHit, FVector (&OutPoints)[NUM_BOUNDING_BOX_TRACE_POINTS], FBox* OutBoundingBox = nullptr);
 
 protected:
 	void _Init(UWorld* in_world, float in_refreshInterval);
 
+	/** Whether the source is currently playing. Audible sources are refreshed first when the trace budget is exceeded. */
+	virtual bool IsAudible() const { return true; }
+
+	/** Distance after which the source cannot be heard. 0 if unknown. */
+	virtual float GetAudibleRadius() const { return 0.0f; }
+
 private:
 	/**
 	 * Fades active occlusions towards targets, sends updated values to the Wwise engine, then calculates refreshed occlusion and obstruction values asynchronously. 
@@ -114,9 +118,13 @@ private:
 	 */
 	void SetObstructionOcclusion(const UAkComponentSet& in_Listeners, AkRoomID RoomID);
 	/**
-	* Calculates updated occlusion and obstruction values.
+	* Calculates updated occlusion and obstruction values synchronously.
 	*/
-	void CalculateObstructionOcclusionValues(const UAkComponentSet& in_Listeners, const FVector& SourcePosition, const AActor* Actor, AkRoomID RoomID, ECollisionChannel in_collisionChannel, bool bAsync = true);
+	void CalculateObstructionOcclusionValues(const UAkComponentSet& in_Listeners, const FVector& SourcePosition, const AActor* Actor, AkRoomID RoomID, ECollisionChannel in_collisionChannel);
+	/**
+	* Requests updated occlusion and obstruction values to the FAkOcclusionObstructionScheduler, which traces them asynchronously within its budget.
+	*/
+	void RequestObstructionOcclusionValues(const UAkComponentSet& in_Listeners, const FVector& SourcePosition, const AActor* Actor, AkRoomID RoomID, ECollisionChannel in_collisionChannel);
 
 
 	/** Last time occlusion was refreshed */
@@ -125,6 +133,9 @@ private:
 
 	bool ClearingOcclusionObstruction = false;
 
+	/** Whether the FAkOcclusionObstructionScheduler may still reference this service */
+	bool bRegisteredWithScheduler = false;
+
 	typedef AkGameObjectIdKeyFuncs<FAkListenerOcclusionObstructionPair, false> ListenerOccObsPairGameObjectIDKeyFuncs;
 	TMap<AkGameObjectID, FAkListenerOcclusionObstructionPair, FDefaultSetAllocator, ListenerOccObsPairGameObjectIDKeyFuncs> ListenerInfoMap;
 };
\ No newline at end of file
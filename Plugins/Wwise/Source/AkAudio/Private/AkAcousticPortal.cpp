@@ -410,11 +410,13 @@ void UAkPortalComponent::FindConnectedComponents(FAkEnvironmentIndex& RoomIndex,
 		FVector frontPoint = toWorld.TransformPosition(frontVector);
 		FVector backPoint = toWorld.TransformPosition(-1 * frontVector);
 
-		TArray<tComponent*> front = RoomIndex.Query<tComponent>(frontPoint, GetWorld());
+		TArray<tComponent*, TInlineAllocator<4>> front;
+		RoomIndex.Query(frontPoint, GetWorld(), front);
 		if (front.Num() > 0)
 			out_pFront = front[0];
 
-		TArray<tComponent*> back = RoomIndex.Query<tComponent>(backPoint, GetWorld());
+		TArray<tComponent*, TInlineAllocator<4>> back;
+		RoomIndex.Query(backPoint, GetWorld(), back);
 		if (back.Num() > 0)
 			out_pBack = back[0];
 	}
@@ -220,17 +220,77 @@ void UAkAcousticTextureSetComponent::SendGeometryInstanceToWwise(const FRotator&
 		params.RoomID = roomID;
 
 		FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
-		if (AkAudioDevice != nullptr && AkAudioDevice->SetGeometryInstance(GetGeometrySetID(), params) == AK_Success)
+		if (AkAudioDevice != nullptr && AkAudioDevice->SetGeometryInstance(GetGeometryInstanceID(), params) == AK_Success)
 			GeometryInstanceHasBeenSent = true;
 	}
 }
 
+bool UAkAcousticTextureSetComponent::AcquireSharedGeometry(uint64 GeometryHash)
+{
+	if (!ShouldSendGeometry())
+		return false;
+
+	if (GeometryHasBeenSent && SharedGeometrySetID.IsValid() && SharedGeometryHash == GeometryHash)
+		return true;
+
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	AkGeometrySetID GeometrySetID;
+	if (AkAudioDevice == nullptr || !AkAudioDevice->AcquireSharedGeometrySet(GeometryHash, GeometrySetID))
+		return false;
+
+	// Take the new reference before releasing the previous one, so our instance never points to a removed set.
+	ReleaseSharedGeometry();
+	SharedGeometrySetID = GeometrySetID;
+	SharedGeometryHash = GeometryHash;
+	GeometryHasBeenSent = true;
+	return true;
+}
+
+void UAkAcousticTextureSetComponent::SendSharedGeometryToWwise(uint64 GeometryHash, const AkGeometryParams& params)
+{
+	if (ShouldSendGeometry())
+	{
+		FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+		AkGeometrySetID GeometrySetID;
+		if (AkAudioDevice != nullptr && AkAudioDevice->AddSharedGeometrySet(GeometryHash, params, GeometrySetID) == AK_Success)
+		{
+			ReleaseSharedGeometry();
+			SharedGeometrySetID = GeometrySetID;
+			SharedGeometryHash = GeometryHash;
+			GeometryHasBeenSent = true;
+		}
+	}
+}
+
+void UAkAcousticTextureSetComponent::ReleaseSharedGeometry()
+{
+	if (!SharedGeometrySetID.IsValid())
+		return;
+
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	if (AkAudioDevice != nullptr)
+		AkAudioDevice->ReleaseSharedGeometrySet(SharedGeometryHash);
+
+	SharedGeometrySetID = AkGeometrySetID();
+	SharedGeometryHash = 0;
+}
+
 void UAkAcousticTextureSetComponent::RemoveGeometryFromWwise()
 {
 	if (ShouldSendGeometry() && GeometryHasBeenSent)
 	{
 		FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
-		if (AkAudioDevice != nullptr && AkAudioDevice->RemoveGeometrySet(GetGeometrySetID()) == AK_Success)
+		if (SharedGeometrySetID.IsValid())
+		{
+			// Other components may still use the shared set: only remove our instance.
+			if (AkAudioDevice != nullptr && GeometryInstanceHasBeenSent)
+				AkAudioDevice->RemoveGeometryInstance(GetGeometryInstanceID());
+
+			ReleaseSharedGeometry();
+			GeometryHasBeenSent = false;
+			GeometryInstanceHasBeenSent = false;
+		}
+		else if (AkAudioDevice != nullptr && AkAudioDevice->RemoveGeometrySet(GetGeometrySetID()) == AK_Success)
 		{
 			GeometryHasBeenSent = false;
 			GeometryInstanceHasBeenSent = false;
@@ -243,7 +303,12 @@ void UAkAcousticTextureSetComponent::RemoveGeometryInstanceFromWwise()
 	if (ShouldSendGeometry() && GeometryInstanceHasBeenSent)
 	{
 		FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
-		if (AkAudioDevice != nullptr && AkAudioDevice->RemoveGeometrySet(GetGeometrySetID()) == AK_Success)
+		if (SharedGeometrySetID.IsValid())
+		{
+			if (AkAudioDevice != nullptr && AkAudioDevice->RemoveGeometryInstance(GetGeometryInstanceID()) == AK_Success)
+				GeometryInstanceHasBeenSent = false;
+		}
+		else if (AkAudioDevice != nullptr && AkAudioDevice->RemoveGeometrySet(GetGeometrySetID()) == AK_Success)
 			GeometryInstanceHasBeenSent = false;
 	}
 }
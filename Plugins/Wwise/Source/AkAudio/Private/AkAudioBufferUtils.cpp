@@ -0,0 +1,166 @@
+/*******************************************************************************
+The content of the files in this repository include portions of the
+AUDIOKINETIC Wwise Technology released in source code form as part of the SDK
+package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use these files in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+Copyright (c) 2022 Audiokinetic Inc.
+*******************************************************************************/
+
+/*=============================================================================
+	AkAudioBufferUtils.cpp: Sample buffer conversions between Wwise and Unreal.
+=============================================================================*/
+
+#include "AkAudioBufferUtils.h"
+#include "AkAudioDevice.h"
+#include "Math/VectorRegister.h"
+#include "HAL/IConsoleManager.h"
+
+namespace AkAudioBufferUtils_Helpers
+{
+	FORCEINLINE void Transpose4x4(VectorRegister4Float& R0, VectorRegister4Float& R1, VectorRegister4Float& R2, VectorRegister4Float& R3)
+	{
+		const VectorRegister4Float T0 = VectorShuffle(R0, R1, 0, 1, 0, 1);
+		const VectorRegister4Float T1 = VectorShuffle(R2, R3, 0, 1, 0, 1);
+		const VectorRegister4Float T2 = VectorShuffle(R0, R1, 2, 3, 2, 3);
+		const VectorRegister4Float T3 = VectorShuffle(R2, R3, 2, 3, 2, 3);
+		R0 = VectorShuffle(T0, T1, 0, 2, 0, 2);
+		R1 = VectorShuffle(T0, T1, 1, 3, 1, 3);
+		R2 = VectorShuffle(T2, T3, 0, 2, 0, 2);
+		R3 = VectorShuffle(T2, T3, 1, 3, 1, 3);
+	}
+
+	void DeinterleaveScalar(const float* RESTRICT InInterleaved, float* const* RESTRICT OutPlanar, int32 NumChannels, int32 FirstChannel, int32 FirstFrame, int32 NumFrames)
+	{
+		for (int32 Channel = FirstChannel; Channel < NumChannels; Channel++)
+		{
+			float* RESTRICT Out = OutPlanar[Channel];
+			for (int32 Frame = FirstFrame; Frame < NumFrames; Frame++)
+			{
+				Out[Frame] = InInterleaved[NumChannels * Frame + Channel];
+			}
+		}
+	}
+}
+
+void AkAudioBufferUtils::Deinterleave(const float* RESTRICT InInterleaved, float* const* RESTRICT OutPlanar, int32 NumChannels, int32 NumFrames)
+{
+	using namespace AkAudioBufferUtils_Helpers;
+
+	if (NumChannels == 1)
+	{
+		FMemory::Memcpy(OutPlanar[0], InInterleaved, NumFrames * sizeof(float));
+		return;
+	}
+
+	const int32 NumVectorFrames = NumFrames & ~3;
+
+	if (NumChannels == 2)
+	{
+		float* RESTRICT OutLeft = OutPlanar[0];
+		float* RESTRICT OutRight = OutPlanar[1];
+		for (int32 Frame = 0; Frame < NumVectorFrames; Frame += 4)
+		{
+			const VectorRegister4Float A = VectorLoad(InInterleaved + 2 * Frame);
+			const VectorRegister4Float B = VectorLoad(InInterleaved + 2 * Frame + 4);
+			VectorStore(VectorShuffle(A, B, 0, 2, 0, 2), OutLeft + Frame);
+			VectorStore(VectorShuffle(A, B, 1, 3, 1, 3), OutRight + Frame);
+		}
+		DeinterleaveScalar(InInterleaved, OutPlanar, NumChannels, 0, NumVectorFrames, NumFrames);
+		return;
+	}
+
+	// Transpose blocks of 4 frames by 4 channels, e.g. twice per block of frames for 7.1
+	const int32 NumVectorChannels = NumChannels & ~3;
+	for (int32 Frame = 0; Frame < NumVectorFrames; Frame += 4)
+	{
+		const float* RESTRICT In = InInterleaved + NumChannels * Frame;
+		for (int32 Channel = 0; Channel < NumVectorChannels; Channel += 4)
+		{
+			VectorRegister4Float R0 = VectorLoad(In + Channel);
+			VectorRegister4Float R1 = VectorLoad(In + NumChannels + Channel);
+			VectorRegister4Float R2 = VectorLoad(In + 2 * NumChannels + Channel);
+			VectorRegister4Float R3 = VectorLoad(In + 3 * NumChannels + Channel);
+			Transpose4x4(R0, R1, R2, R3);
+			VectorStore(R0, OutPlanar[Channel] + Frame);
+			VectorStore(R1, OutPlanar[Channel + 1] + Frame);
+			VectorStore(R2, OutPlanar[Channel + 2] + Frame);
+			VectorStore(R3, OutPlanar[Channel + 3] + Frame);
+		}
+	}
+
+	// Remaining channels of the vectorized frames, e.g. the two last channels of 5.1, then all channels of the remaining frames
+	DeinterleaveScalar(InInterleaved, OutPlanar, NumChannels, NumVectorChannels, 0, NumVectorFrames);
+	DeinterleaveScalar(InInterleaved, OutPlanar, NumChannels, 0, NumVectorFrames, NumFrames);
+}
+
+#if !UE_BUILD_SHIPPING
+namespace AkAudioBufferUtils_Helpers
+{
+	void BenchmarkDeinterleave(const TArray<FString>& Args)
+	{
+		const int32 NumFrames = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1024;
+		const int32 NumIterations = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 10000;
+		if (NumFrames <= 0 || NumIterations <= 0)
+		{
+			return;
+		}
+
+		for (const int32 NumChannels : { 1, 2, 4, 6, 8 })
+		{
+			TArray<float> Interleaved;
+			Interleaved.SetNumUninitialized(NumChannels * NumFrames);
+			for (int32 i = 0; i < Interleaved.Num(); i++)
+			{
+				Interleaved[i] = (float)i;
+			}
+
+			TArray<TArray<float>> Planar;
+			TArray<float*> PlanarPointers;
+			Planar.SetNum(NumChannels);
+			for (auto& Channel : Planar)
+			{
+				Channel.SetNumUninitialized(NumFrames);
+				PlanarPointers.Add(Channel.GetData());
+			}
+
+			const double ScalarStart = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+			{
+				DeinterleaveScalar(Interleaved.GetData(), PlanarPointers.GetData(), NumChannels, 0, 0, NumFrames);
+			}
+			const double ScalarTime = FPlatformTime::Seconds() - ScalarStart;
+
+			const double VectorStart = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+			{
+				AkAudioBufferUtils::Deinterleave(Interleaved.GetData(), PlanarPointers.GetData(), NumChannels, NumFrames);
+			}
+			const double VectorTime = FPlatformTime::Seconds() - VectorStart;
+
+			bool bValid = true;
+			for (int32 Channel = 0; Channel < NumChannels && bValid; Channel++)
+			{
+				for (int32 Frame = 0; Frame < NumFrames && bValid; Frame++)
+				{
+					bValid = Planar[Channel][Frame] == Interleaved[NumChannels * Frame + Channel];
+				}
+			}
+
+			UE_LOG(LogAkAudio, Display, TEXT("Deinterleave %d channels x %d frames: scalar %.3f us, vectorized %.3f us per buffer%s"),
+				NumChannels, NumFrames, ScalarTime * 1e6 / NumIterations, VectorTime * 1e6 / NumIterations, bValid ? TEXT("") : TEXT(" (INVALID OUTPUT)"));
+		}
+	}
+
+	static FAutoConsoleCommand BenchmarkDeinterleaveCommand(
+		TEXT("Wwise.Benchmark.Deinterleave"),
+		TEXT("Measures the deinterleaving of Wwise output buffers for common channel counts. Arguments: [NumFrames=1024] [NumIterations=10000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkDeinterleave));
+}
+#endif // !UE_BUILD_SHIPPING
@@ -67,6 +67,7 @@ Copyright (c) 2022 Audiokinetic Inc.
 #include "Internationalization/Culture.h"
 #include "Internationalization/Internationalization.h"
 #include "Misc/App.h"
+#include "Misc/MemStack.h"
 #include "Misc/ScopeLock.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Stats/Stats.h"
@@ -111,6 +112,13 @@ static constexpr auto InvariantLCID = 0x7F;
 
 DECLARE_STATS_GROUP(TEXT("AkAudioDevice"), STATGROUP_AkAudioDevice, STATCAT_Wwise);
 DECLARE_CYCLE_STAT(TEXT("Post Event Async"), STAT_PostEventAsync, STATGROUP_AkAudioDevice);
+DECLARE_CYCLE_STAT(TEXT("Update Queued Environments"), STAT_UpdateQueuedEnvironments, STATGROUP_AkAudioDevice);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queued Environment Updates"), STAT_QueuedEnvironmentUpdates, STATGROUP_AkAudioDevice);
+DECLARE_CYCLE_STAT(TEXT("Update Queued Positions"), STAT_UpdateQueuedPositions, STATGROUP_AkAudioDevice);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queued Position Updates"), STAT_QueuedPositionUpdates, STATGROUP_AkAudioDevice);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Submitted Positions"), STAT_SubmittedPositions, STATGROUP_AkAudioDevice);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Shared Geometry Sets"), STAT_SharedGeometrySets, STATGROUP_AkAudioDevice);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Shared Geometry References"), STAT_SharedGeometryReferences, STATGROUP_AkAudioDevice);
 
 /*------------------------------------------------------------------------------------
 	Helpers
@@ -455,6 +463,10 @@ bool FAkAudioDevice::Init()
 				WorldVolumesUpdatedMap[World] = false;
 			else
 				WorldVolumesUpdatedMap.Add(World, false);
+
+			// Send the positions of everything that moved during the actor tick, so that occlusion traces use them.
+			UpdateQueuedPositions();
+			OcclusionObstructionScheduler.Tick(World);
 		}
 	);
 
@@ -646,6 +658,7 @@ void FAkAudioDevice::CleanupComponentMapsForWorld(UWorld* World)
 	LateReverbIndex.Clear(World);
 	RoomIndex.Clear(World);
 	WorldPortalsMap.Remove(World);
+	OcclusionObstructionScheduler.ClearWorld(World);
 }
 
 /**
@@ -670,6 +683,18 @@ bool FAkAudioDevice::Update( float DeltaTime )
 		}
 
 		UpdateSetCurrentAudioCultureAsyncTasks();
+		UpdateQueuedPositions();
+		UpdateQueuedEnvironments();
+
+		if (CallbackManager)
+		{
+			CallbackManager->DispatchPendingCallbacks();
+		}
+
+		if (CallbackInfoPool)
+		{
+			CallbackInfoPool->Tick();
+		}
 
 		auto* SoundEngine = FWwiseLowLevelSoundEngine::Get();
 		if (UNLIKELY(!SoundEngine)) return false;
@@ -740,6 +765,10 @@ void FAkAudioDevice::Teardown()
 
 		FAkSoundEngineInitialization::Finalize(IOHook);
 
+		SharedGeometrySets.Empty();
+		SET_DWORD_STAT(STAT_SharedGeometrySets, 0);
+		SET_DWORD_STAT(STAT_SharedGeometryReferences, 0);
+
 		if (LIKELY(CallbackManager))
 		{
 			delete CallbackManager;
@@ -1956,6 +1985,247 @@ TArray<class UAkRoomComponent*> FAkAudioDevice::FindRoomComponentsAtLocation(con
 	return RoomIndex.Query<UAkRoomComponent>(Loc, World);
 }
 
+void FAkAudioDevice::QueueEnvironmentUpdate(UAkComponent* Component, const FVector& RoomLocation, const FVector& ReverbLocation)
+{
+	if (Component->QueuedEnvironmentUpdateIndex != INDEX_NONE
+		&& QueuedEnvironmentUpdates.IsValidIndex(Component->QueuedEnvironmentUpdateIndex)
+		&& QueuedEnvironmentUpdates[Component->QueuedEnvironmentUpdateIndex].Component.Get() == Component)
+	{
+		// Moved multiple times this frame: only the last location matters.
+		auto& QueuedUpdate = QueuedEnvironmentUpdates[Component->QueuedEnvironmentUpdateIndex];
+		QueuedUpdate.RoomLocation = RoomLocation;
+		QueuedUpdate.ReverbLocation = ReverbLocation;
+		return;
+	}
+
+	Component->QueuedEnvironmentUpdateIndex = QueuedEnvironmentUpdates.Add({ Component, RoomLocation, ReverbLocation });
+}
+
+void FAkAudioDevice::QueuePositionUpdate(UAkComponent* Component, bool bForce)
+{
+	if (Component->QueuedPositionUpdateIndex != INDEX_NONE
+		&& QueuedPositionUpdates.IsValidIndex(Component->QueuedPositionUpdateIndex)
+		&& QueuedPositionUpdates[Component->QueuedPositionUpdateIndex].Component.Get() == Component)
+	{
+		// Moved multiple times this frame: the transform is only read when the batch is sent.
+		QueuedPositionUpdates[Component->QueuedPositionUpdateIndex].bForce |= bForce;
+		return;
+	}
+
+	Component->QueuedPositionUpdateIndex = QueuedPositionUpdates.Add({ Component, bForce });
+}
+
+void FAkAudioDevice::FlushQueuedPositionUpdate(UAkComponent* Component)
+{
+	if (Component->QueuedPositionUpdateIndex == INDEX_NONE
+		|| !QueuedPositionUpdates.IsValidIndex(Component->QueuedPositionUpdateIndex)
+		|| QueuedPositionUpdates[Component->QueuedPositionUpdateIndex].Component.Get() != Component)
+	{
+		return;
+	}
+
+	FQueuedPositionUpdate& QueuedUpdate = QueuedPositionUpdates[Component->QueuedPositionUpdateIndex];
+	const FQueuedPositionUpdate Update = QueuedUpdate;
+	QueuedUpdate.Component.Reset();
+	SubmitPositionUpdates(MakeArrayView(&Update, 1));
+}
+
+void FAkAudioDevice::UpdateQueuedPositions()
+{
+	if (QueuedPositionUpdates.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_UpdateQueuedPositions);
+	INC_DWORD_STAT_BY(STAT_QueuedPositionUpdates, QueuedPositionUpdates.Num());
+
+	// Swap the queues so submitting doesn't allocate. Both keep their allocation from one frame to the next.
+	Swap(QueuedPositionUpdates, SubmittedPositionUpdates);
+	SubmitPositionUpdates(SubmittedPositionUpdates);
+	SubmittedPositionUpdates.Reset();
+}
+
+void FAkAudioDevice::SubmitPositionUpdates(TArrayView<const FQueuedPositionUpdate> Updates)
+{
+	static constexpr float OrientationTolerance = 1.e-3f;
+
+	// Gather the transforms of the components that moved enough
+	auto& Buffers = PositionUpdateBuffers;
+	Buffers.Components.Reset();
+	Buffers.Locations.Reset();
+	Buffers.Fronts.Reset();
+	Buffers.Ups.Reset();
+	for (const auto& Update : Updates)
+	{
+		UAkComponent* Component = Update.Component.Get();
+		if (!Component)
+		{
+			continue;
+		}
+
+		Component->QueuedPositionUpdateIndex = INDEX_NONE;
+		if (!Component->IsActive())
+		{
+			continue;
+		}
+
+		FVector Location, Front, Up;
+		Component->GetSoundTransform(Location, Front, Up);
+		if (!Update.bForce)
+		{
+			const AkSoundPosition& CurrentPosition = Component->GetCurrentSoundPosition();
+			FVector CurrentFront, CurrentUp;
+			AKVectorToFVector(CurrentPosition.OrientationFront(), CurrentFront);
+			AKVectorToFVector(CurrentPosition.OrientationTop(), CurrentUp);
+
+			const float Threshold = Component->PositionUpdateThreshold;
+			const bool bMoved = FVector::DistSquared(Location, AKVector64ToFVector(CurrentPosition.Position())) > Threshold * Threshold;
+			if (!bMoved && Front.Equals(CurrentFront, OrientationTolerance) && Up.Equals(CurrentUp, OrientationTolerance))
+			{
+				continue;
+			}
+		}
+
+		Buffers.Components.Add(Component);
+		Buffers.Locations.Add(Location);
+		Buffers.Fronts.Add(Front);
+		Buffers.Ups.Add(Up);
+	}
+
+	const int32 NumPositions = Buffers.Components.Num();
+	if (NumPositions == 0)
+	{
+		return;
+	}
+
+	Buffers.SoundPositions.SetNum(NumPositions, false);
+	FVectorsToAKWorldTransforms(Buffers.Locations, Buffers.Fronts, Buffers.Ups, Buffers.SoundPositions);
+
+	auto* SoundEngine = FWwiseLowLevelSoundEngine::Get();
+	for (int32 Index = 0; Index < NumPositions; ++Index)
+	{
+		UAkComponent* Component = Buffers.Components[Index];
+		if (m_bSoundEngineInitialized && SoundEngine && Component->AllowAudioPlayback())
+		{
+			SoundEngine->SetPosition(Component->GetAkGameObjectID(), Buffers.SoundPositions[Index]);
+			Component->OnPositionSubmitted(Buffers.SoundPositions[Index]);
+			INC_DWORD_STAT(STAT_SubmittedPositions);
+		}
+
+		// Find and apply the room and all AkReverbVolumes at this location. Resolved for all moved components at once.
+		QueueEnvironmentUpdate(Component, Component->GetPosition(), Component->GetComponentLocation());
+	}
+}
+
+void FAkAudioDevice::FVectorsToAKWorldTransforms(TArrayView<const FVector> in_Positions, TArrayView<const FVector> in_Fronts, TArrayView<const FVector> in_Ups, TArrayView<AkWorldTransform> out_AkTransforms)
+{
+	const int32 Num = out_AkTransforms.Num();
+	check(in_Positions.Num() == Num && in_Fronts.Num() == Num && in_Ups.Num() == Num);
+	if (Num == 0)
+	{
+		return;
+	}
+
+	// The front and up components are converted to float as two flat arrays, a loop the compiler can vectorize
+	static_assert(sizeof(FVector) == 3 * sizeof(FVector::FReal), "FVector is expected to only hold its three components");
+	const int32 NumComponents = 3 * Num;
+
+	FMemMark Mark(FMemStack::Get());
+	TArray<AkReal32, TMemStackAllocator<>> FrontComponents;
+	TArray<AkReal32, TMemStackAllocator<>> UpComponents;
+	FrontComponents.SetNumUninitialized(NumComponents);
+	UpComponents.SetNumUninitialized(NumComponents);
+
+	const FVector::FReal* RESTRICT FrontSource = &in_Fronts.GetData()->X;
+	const FVector::FReal* RESTRICT UpSource = &in_Ups.GetData()->X;
+	AkReal32* RESTRICT Fronts = FrontComponents.GetData();
+	AkReal32* RESTRICT Ups = UpComponents.GetData();
+	for (int32 Index = 0; Index < NumComponents; ++Index)
+	{
+		Fronts[Index] = (AkReal32)FrontSource[Index];
+		Ups[Index] = (AkReal32)UpSource[Index];
+	}
+
+	// Positions stay 64-bit
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		const AkReal32* Front = Fronts + 3 * Index;
+		const AkReal32* Up = Ups + 3 * Index;
+		out_AkTransforms[Index].Set(FVectorToAKVector64(in_Positions[Index]), AkVector{ Front[0], Front[1], Front[2] }, AkVector{ Up[0], Up[1], Up[2] });
+	}
+}
+
+void FAkAudioDevice::UpdateQueuedEnvironments()
+{
+	if (QueuedEnvironmentUpdates.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_UpdateQueuedEnvironments);
+	INC_DWORD_STAT_BY(STAT_QueuedEnvironmentUpdates, QueuedEnvironmentUpdates.Num());
+
+	// Components can queue themselves again while being updated. Those will be handled next frame.
+	// Swap the queues instead of moving them out, so both keep their allocation from one frame to the next.
+	Swap(QueuedEnvironmentUpdates, ProcessedEnvironmentUpdates);
+	const auto& Updates = ProcessedEnvironmentUpdates;
+
+	TArray<UWorld*, TInlineAllocator<4>> Worlds;
+	for (auto& Update : Updates)
+	{
+		if (UAkComponent* Component = Update.Component.Get())
+		{
+			Component->QueuedEnvironmentUpdateIndex = INDEX_NONE;
+			Worlds.AddUnique(Component->GetWorld());
+		}
+	}
+
+	auto& Buffers = EnvironmentUpdateBuffers;
+	const bool bUseLateReverbs = GetMaxAuxBus() > 0;
+	for (UWorld* World : Worlds)
+	{
+		Buffers.Components.Reset();
+		Buffers.RoomLocations.Reset();
+		Buffers.ReverbLocations.Reset();
+		for (const auto& Update : Updates)
+		{
+			UAkComponent* Component = Update.Component.Get();
+			if (Component && Component->GetWorld() == World)
+			{
+				Buffers.Components.Add(Component);
+				Buffers.RoomLocations.Add(Update.RoomLocation);
+				Buffers.ReverbLocations.Add(Update.ReverbLocation);
+			}
+		}
+
+		RoomIndex.QueryBatch<UAkRoomComponent>(Buffers.RoomLocations, World, Buffers.Rooms, Buffers.RoomOffsets);
+		if (bUseLateReverbs)
+		{
+			LateReverbIndex.QueryBatch<UAkLateReverbComponent>(Buffers.ReverbLocations, World, Buffers.LateReverbs, Buffers.LateReverbOffsets);
+		}
+
+		for (int32 Index = 0; Index < Buffers.Components.Num(); ++Index)
+		{
+			UAkComponent* Component = Buffers.Components[Index];
+			if (Component->AllowAudioPlayback())
+			{
+				const int32 RoomOffset = Buffers.RoomOffsets[Index];
+				const int32 RoomCount = Buffers.RoomOffsets[Index + 1] - RoomOffset;
+				Component->SetSpatialAudioRoom(MakeArrayView(Buffers.Rooms.GetData() + RoomOffset, RoomCount));
+			}
+			if (bUseLateReverbs && Component->bUseReverbVolumes)
+			{
+				const int32 LateReverbOffset = Buffers.LateReverbOffsets[Index];
+				const int32 LateReverbCount = Buffers.LateReverbOffsets[Index + 1] - LateReverbOffset;
+				Component->UpdateAkLateReverbComponentList(MakeArrayView(Buffers.LateReverbs.GetData() + LateReverbOffset, LateReverbCount));
+			}
+		}
+	}
+
+	ProcessedEnvironmentUpdates.Reset();
+}
+
 /** Add a UAkRoomComponent to the linked list. */
 void FAkAudioDevice::IndexRoom(class UAkRoomComponent* ComponentToAdd)
 {
@@ -2230,17 +2500,9 @@ void FAkAudioDevice::RemoveSpatialAudioPortal(UAkPortalComponent* in_Portal)
  */
 void FAkAudioDevice::GetAuxSendValuesAtLocation(FVector Loc, TArray<AkAuxSendValue>& AkAuxSendValues, const UWorld* in_World)
 {
-	// Check if there are AkReverbVolumes at this location
-	TArray<UAkLateReverbComponent*> FoundComponents = LateReverbIndex.Query<UAkLateReverbComponent>(Loc, in_World);
-
-	// Sort the found Volumes
-	if (FoundComponents.Num() > 1)
-	{
-		FoundComponents.Sort([](const UAkLateReverbComponent& A, const UAkLateReverbComponent& B)
-		{
-			return A.Priority > B.Priority;
-		});
-	}
+	// Check if there are AkReverbVolumes at this location. They are already sorted by decreasing priority.
+	TArray<UAkLateReverbComponent*, TInlineAllocator<8>> FoundComponents;
+	LateReverbIndex.Query(Loc, in_World, FoundComponents);
 
 	// Apply the found Aux Sends
 	AkAuxSendValue	TmpSendValue;
@@ -2318,7 +2580,8 @@ AkPlayingID FAkAudioDevice::PostEventAtLocation(
 		SoundEngine->SetGameObjectAuxSendValues(objId, AkReverbVolumes.GetData(), AkReverbVolumes.Num());
 
 		AkRoomID RoomID;
-		TArray<UAkRoomComponent*> AkRooms = RoomIndex.Query<UAkRoomComponent>(Location, World);
+		TArray<UAkRoomComponent*, TInlineAllocator<4>> AkRooms;
+		RoomIndex.Query(Location, World, AkRooms);
 		if (AkRooms.Num() > 0)
 			RoomID = AkRooms[0]->GetRoomID();
 
@@ -3360,6 +3623,8 @@ void FAkAudioDevice::RegisterComponent( UAkComponent * in_pComponent )
 
 		if (CallbackManager != nullptr)
 			CallbackManager->RegisterGameObject(gameObjId);
+
+		OnAkComponentRegistered.Broadcast(in_pComponent);
 	}
 }
 
@@ -3386,6 +3651,12 @@ void FAkAudioDevice::RegisterComponent(AkGameObjectID GameObjectID)
  */
 void FAkAudioDevice::UnregisterComponent( UAkComponent * in_pComponent )
 {
+	// Listeners may keep pointers to the components they were told about, even if the sound engine is not initialized anymore
+	if (in_pComponent)
+	{
+		OnAkComponentUnregistered.Broadcast(in_pComponent);
+	}
+
 	if (m_bSoundEngineInitialized && in_pComponent)
 	{
 		auto* SoundEngine = FWwiseLowLevelSoundEngine::Get();
@@ -3490,6 +3761,64 @@ AKRESULT FAkAudioDevice::RemoveGeometryInstance(AkGeometryInstanceID GeometryIns
 	return eResult;
 }
 
+bool FAkAudioDevice::AcquireSharedGeometrySet(uint64 GeometryHash, AkGeometrySetID& OutGeometrySetID)
+{
+	check(IsInGameThread());
+
+	FSharedGeometrySet* SharedSet = SharedGeometrySets.Find(GeometryHash);
+	if (!SharedSet)
+	{
+		return false;
+	}
+
+	++SharedSet->RefCount;
+	INC_DWORD_STAT(STAT_SharedGeometryReferences);
+	OutGeometrySetID = SharedSet->GeometrySetID;
+	return true;
+}
+
+AKRESULT FAkAudioDevice::AddSharedGeometrySet(uint64 GeometryHash, const AkGeometryParams& Params, AkGeometrySetID& OutGeometrySetID)
+{
+	check(IsInGameThread());
+	check(!SharedGeometrySets.Contains(GeometryHash));
+
+	const AkGeometrySetID GeometrySetID(NextSharedGeometrySetID);
+	const AKRESULT eResult = SetGeometry(GeometrySetID, Params);
+	if (eResult == AK_Success)
+	{
+		++NextSharedGeometrySetID;
+		FSharedGeometrySet& SharedSet = SharedGeometrySets.Add(GeometryHash);
+		SharedSet.GeometrySetID = GeometrySetID;
+		SharedSet.RefCount = 1;
+		INC_DWORD_STAT(STAT_SharedGeometrySets);
+		INC_DWORD_STAT(STAT_SharedGeometryReferences);
+		OutGeometrySetID = GeometrySetID;
+	}
+
+	return eResult;
+}
+
+void FAkAudioDevice::ReleaseSharedGeometrySet(uint64 GeometryHash)
+{
+	check(IsInGameThread());
+
+	FSharedGeometrySet* SharedSet = SharedGeometrySets.Find(GeometryHash);
+	if (!SharedSet)
+	{
+		return;
+	}
+
+	DEC_DWORD_STAT(STAT_SharedGeometryReferences);
+	if (--SharedSet->RefCount > 0)
+	{
+		return;
+	}
+
+	RemoveGeometrySet(SharedSet->GeometrySetID);
+	SharedGeometrySets.Remove(GeometryHash);
+	DEC_DWORD_STAT(STAT_SharedGeometrySets);
+}
+
 AKRESULT FAkAudioDevice::SetEarlyReflectionsAuxBus(UAkComponent* in_pComponent, const AkUInt32 AuxBusID)
 {
 	AKRESULT eResult = AK_Fail;
@@ -4103,6 +4432,7 @@ bool FAkAudioDevice::EnsureInitialized()
 	m_bSoundEngineInitialized = true;
 
 	CallbackInfoPool = new AkCallbackInfoPool;
+	CallbackInfoPool->Prewarm();
 	// Go get the max number of Aux busses
 	MaxAuxBus = AK_MAX_AUX_PER_OBJ;
 	if (const UAkSettings* AkSettings = GetDefault<UAkSettings>())
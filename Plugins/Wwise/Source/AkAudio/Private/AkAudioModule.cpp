@@ -17,6 +17,7 @@ Copyright (c) 2021 Audiokinetic Inc.
 #include "AkAudioModule.h"
 #include "AkAudioDevice.h"
 #include "AkAudioStyle.h"
+#include "AkInitBank.h"
 #include "AkSettings.h"
 #include "AkSettingsPerUser.h"
 #include "AkUnrealHelper.h"
@@ -222,6 +223,7 @@ void FAkAudioModule::OnPostEngineInit()
 		UserSettings->OnGeneratedSoundBanksPathChanged.AddRaw(this, &FAkAudioModule::OnSoundBanksFolderChanged);
 	}
 	OnDatabaseUpdateCompleteHandle = FWwiseProjectDatabaseDelegates::Get().GetOnDatabaseUpdateCompletedDelegate().AddRaw(this, &FAkAudioModule::AssetReloadPrompt);
+	OnDatabaseRefsUpdatedHandle = FWwiseProjectDatabaseDelegates::Get().GetOnDatabaseRefsUpdatedDelegate().AddRaw(this, &FAkAudioModule::AssetRefsReloadPrompt);
 
 #if AK_SUPPORT_WAAPI
 	if (!IsRunningCommandlet())
@@ -289,6 +291,22 @@ void FAkAudioModule::AssetReloadPrompt()
 	}
 }
 
+void FAkAudioModule::AssetRefsReloadPrompt(const TSet<FGuid>& InUpdatedGuids)
+{
+	const UAkSettingsPerUser* UserSettings = GetDefault<UAkSettingsPerUser>();
+	if (UserSettings->AskForWwiseAssetsReload)
+	{
+		OpenAssetReloadPopup();
+	}
+	else
+	{
+		AsyncTask(ENamedThreads::Type::GameThread, [this, UpdatedGuids = InUpdatedGuids]
+		{
+			ReloadWwiseAssetData(UpdatedGuids);
+		});
+	}
+}
+
 void FAkAudioModule::OpenAssetReloadPopup()
 {
 	ReloadPopup.HideRefreshNotification();
@@ -337,6 +355,41 @@ void FAkAudioModule::ReloadWwiseAssetData()
 		UE_LOG(LogAkAudio, Verbose, TEXT("FAkAudioModule::ReloadWwiseAssetData : Skipping asset data reload because the SoundEngine is not initialized."));
 	}
 }
+
+void FAkAudioModule::ReloadWwiseAssetData(const TSet<FGuid>& InUpdatedGuids)
+{
+	if (!FAkAudioDevice::IsInitialized())
+	{
+		UE_LOG(LogAkAudio, Verbose, TEXT("FAkAudioModule::ReloadWwiseAssetData : Skipping asset data reload because the SoundEngine is not initialized."));
+		return;
+	}
+
+	TArray<UAkAudioType*> UpdatedAssets;
+	for (TObjectIterator<UAkAudioType> AudioAssetIt; AudioAssetIt; ++AudioAssetIt)
+	{
+		if (!InUpdatedGuids.Contains(AudioAssetIt->WwiseGuid))
+		{
+			continue;
+		}
+		if (AudioAssetIt->IsA<UAkInitBank>())
+		{
+			// The Init Bank contents are referenced by every other asset.
+			ReloadWwiseAssetData();
+			return;
+		}
+		UpdatedAssets.Add(*AudioAssetIt);
+	}
+
+	UE_LOG(LogAkAudio, Log, TEXT("FAkAudioModule::ReloadWwiseAssetData : Reloading %d of the Wwise assets."), UpdatedAssets.Num());
+	for (auto* AudioAsset : UpdatedAssets)
+	{
+		AudioAsset->UnloadData();
+	}
+	for (auto* AudioAsset : UpdatedAssets)
+	{
+		AudioAsset->LoadData();
+	}
+}
 #endif
 
 void FAkAudioModule::UpdateWwiseResourceLoaderSettings() const
@@ -15,27 +15,161 @@ Copyright (c) 2021 Audiokinetic Inc.
 
 #include "AkCallbackInfoPool.h"
 #include "AkGameplayTypes.h"
+#include "AkSettings.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/Package.h"
+
+DECLARE_STATS_GROUP(TEXT("AkCallbackInfoPool"), STATGROUP_AkCallbackInfoPool, STATCAT_Wwise);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hits"), STAT_AkCallbackInfoPoolHits, STATGROUP_AkCallbackInfoPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Misses"), STAT_AkCallbackInfoPoolMisses, STATGROUP_AkCallbackInfoPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Trimmed"), STAT_AkCallbackInfoPoolTrimmed, STATGROUP_AkCallbackInfoPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Live Objects"), STAT_AkCallbackInfoPoolLive, STATGROUP_AkCallbackInfoPool);
+
+AkCallbackInfoPool::AkCallbackInfoPool()
+{
+	if (const UAkSettings* AkSettings = GetDefault<UAkSettings>())
+	{
+		MaxFreePerClass = AkSettings->CallbackInfoPoolSettings.MaxFreeCallbackInfosPerClass;
+		TrimCountPerIdleFrame = AkSettings->CallbackInfoPoolSettings.TrimCountPerIdleFrame;
+	}
+}
+
+AkCallbackInfoPool::~AkCallbackInfoPool()
+{
+	DEC_DWORD_STAT_BY(STAT_AkCallbackInfoPoolLive, LiveInstances.Num());
+}
+
+void AkCallbackInfoPool::Prewarm()
+{
+	check(IsInGameThread());
+
+	FAkCallbackInfoPoolSettings Settings;
+	if (const UAkSettings* AkSettings = GetDefault<UAkSettings>())
+	{
+		Settings = AkSettings->CallbackInfoPoolSettings;
+	}
+
+	const TPair<UClass*, int32> PrewarmCounts[] =
+	{
+		{ UAkCallbackInfo::StaticClass(), Settings.CallbackInfoPrewarmCount },
+		{ UAkEventCallbackInfo::StaticClass(), Settings.EventCallbackInfoPrewarmCount },
+		{ UAkMIDIEventCallbackInfo::StaticClass(), Settings.MIDIEventCallbackInfoPrewarmCount },
+		{ UAkMarkerCallbackInfo::StaticClass(), Settings.MarkerCallbackInfoPrewarmCount },
+		{ UAkDurationCallbackInfo::StaticClass(), Settings.DurationCallbackInfoPrewarmCount },
+		{ UAkMusicSyncCallbackInfo::StaticClass(), Settings.MusicSyncCallbackInfoPrewarmCount },
+	};
+
+	for (const auto& PrewarmCount : PrewarmCounts)
+	{
+		UClass* type = PrewarmCount.Key;
+		const int32 Count = FMath::Max(PrewarmCount.Value, 0);
+
+		TArray<UAkCallbackInfo*> Instances;
+		Instances.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Instances.Add(CreateInstance(type));
+		}
+
+		FScopeLock ScopeLock(&Lock);
+		auto& ClassPool = Pool.FindOrAdd(type);
+		ClassPool.PrewarmCount = Count;
+		ClassPool.Free.Append(Instances);
+	}
+}
 
 UAkCallbackInfo* AkCallbackInfoPool::internalAcquire(UClass* type)
 {
-	ensure(IsInGameThread());
-	auto& poolArray = Pool.FindOrAdd(type);
-	if (poolArray.Num() > 0)
 	{
-		return poolArray.Pop();
+		FScopeLock ScopeLock(&Lock);
+		bAcquiredSinceLastTick = true;
+		auto& ClassPool = Pool.FindOrAdd(type);
+		if (ClassPool.Free.Num() > 0)
+		{
+			INC_DWORD_STAT(STAT_AkCallbackInfoPoolHits);
+			return ClassPool.Free.Pop(false);
+		}
 	}
 
-	auto instance = NewObject<UAkCallbackInfo>(GetTransientPackage(), type, NAME_None, RF_Public | RF_Standalone);
-	gcStorage.Emplace(instance);
+	INC_DWORD_STAT(STAT_AkCallbackInfoPoolMisses);
+	return CreateInstance(type);
+}
+
+UAkCallbackInfo* AkCallbackInfoPool::CreateInstance(UClass* type)
+{
+	UAkCallbackInfo* instance = nullptr;
+	{
+		// Prevent the garbage collector from running while the object is not referenced yet. Must be taken before our lock,
+		// since the garbage collector takes our lock in AddReferencedObjects.
+		FGCScopeGuard GCGuard;
+		instance = NewObject<UAkCallbackInfo>(GetTransientPackage(), type, NAME_None, RF_Public);
+
+		FScopeLock ScopeLock(&Lock);
+		LiveInstances.Add(instance);
+	}
+	INC_DWORD_STAT(STAT_AkCallbackInfoPoolLive);
 	return instance;
 }
 
+void AkCallbackInfoPool::DropInstance(UAkCallbackInfo* instance)
+{
+	// No need for a lock here because those calling this function are already locking
+	LiveInstances.Remove(instance);
+	DEC_DWORD_STAT(STAT_AkCallbackInfoPoolLive);
+}
+
 void AkCallbackInfoPool::Release(UAkCallbackInfo* instance)
 {
-	ensure(IsInGameThread());
-	if (Pool.Contains(instance->GetClass()))
+	if (!instance)
+		return;
+
+	instance->Reset();
+
+	FScopeLock ScopeLock(&Lock);
+	auto ClassPool = Pool.Find(instance->GetClass());
+	if (ClassPool && ClassPool->Free.Num() < MaxFreePerClass)
+	{
+		ClassPool->Free.Push(instance);
+	}
+	else
 	{
-		instance->Reset();
-		Pool[instance->GetClass()].Push(instance);
+		// Over the cap: leave the object to the garbage collector
+		DropInstance(instance);
 	}
 }
+
+void AkCallbackInfoPool::Tick()
+{
+	check(IsInGameThread());
+
+	FScopeLock ScopeLock(&Lock);
+	if (bAcquiredSinceLastTick)
+	{
+		bAcquiredSinceLastTick = false;
+		return;
+	}
+
+	int32 TrimBudget = TrimCountPerIdleFrame;
+	for (auto& Item : Pool)
+	{
+		auto& ClassPool = Item.Value;
+		while (TrimBudget > 0 && ClassPool.Free.Num() > ClassPool.PrewarmCount)
+		{
+			DropInstance(ClassPool.Free.Pop(false));
+			INC_DWORD_STAT(STAT_AkCallbackInfoPoolTrimmed);
+			--TrimBudget;
+		}
+	}
+}
+
+void AkCallbackInfoPool::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	FScopeLock ScopeLock(&Lock);
+	Collector.AddReferencedObjects(LiveInstances);
+}
+
+FString AkCallbackInfoPool::GetReferencerName() const
+{
+	return TEXT("AkCallbackInfoPool");
+}
@@ -602,12 +602,9 @@ void UAkComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FAct
 
 		if (AkAudioDevice && AkAudioDevice->WorldSpatialAudioVolumesUpdated(GetWorld()))
 		{
-			UpdateSpatialAudioRoom(GetComponentLocation());
-			// Find and apply all AkReverbVolumes at this location
-			if (bUseReverbVolumes && AkAudioDevice->GetMaxAuxBus() > 0)
-			{
-				UpdateAkLateReverbComponentList(GetComponentLocation());
-			}
+			// Find and apply the room and all AkReverbVolumes at this location
+			const FVector Location = GetComponentLocation();
+			AkAudioDevice->QueueEnvironmentUpdate(this, Location, Location);
 		}
 
 		if (AkAudioDevice && bUseReverbVolumes && AkAudioDevice->GetMaxAuxBus() > 0)
@@ -630,7 +627,7 @@ void UAkComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FAct
 void UAkComponent::BeginPlay()
 {
 	Super::BeginPlay();
-	UpdateGameObjectPosition();
+	UpdateGameObjectPosition(true);
 
 	// If spawned inside AkReverbVolume(s), we do not want the fade in effect to kick in.
 	UpdateAkLateReverbComponentList(GetComponentLocation());
@@ -657,10 +654,69 @@ void UAkComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags,
 
 	// If we're a listener, our position will be updated from Tick instead of here.
 	// This is because PlayerController->GetAudioListenerPosition caches its value, and it can be out of sync
-	if(!IsDefaultListener)
+	if (Significance == EAkComponentSignificance::Inaudible)
+		bPositionUpdateDeferred = true;
+	else if(!IsDefaultListener)
 		UpdateGameObjectPosition();
 }
 
+void UAkComponent::SetSignificance(EAkComponentSignificance InSignificance, float ReducedTickInterval)
+{
+	if (IsDefaultListener || Emitters.Num() > 0)
+		InSignificance = EAkComponentSignificance::Full;
+	else if (InSignificance == EAkComponentSignificance::Inaudible && bAutoDestroy)
+		InSignificance = EAkComponentSignificance::Reduced;
+
+	ReducedSignificanceTickInterval = ReducedTickInterval;
+	if (InSignificance == Significance)
+	{
+		if (Significance == EAkComponentSignificance::Reduced)
+			SetComponentTickInterval(FMath::Max(FullSignificanceTickInterval, ReducedSignificanceTickInterval));
+		return;
+	}
+
+	const EAkComponentSignificance PreviousSignificance = Significance;
+	if (PreviousSignificance == EAkComponentSignificance::Full)
+		FullSignificanceTickInterval = GetComponentTickInterval();
+
+	Significance = InSignificance;
+	switch (Significance)
+	{
+	case EAkComponentSignificance::Full:
+		SetComponentTickInterval(FullSignificanceTickInterval);
+		SetComponentTickEnabled(true);
+		break;
+	case EAkComponentSignificance::Reduced:
+		SetComponentTickInterval(FMath::Max(FullSignificanceTickInterval, ReducedSignificanceTickInterval));
+		SetComponentTickEnabled(true);
+		break;
+	case EAkComponentSignificance::Inaudible:
+		SetComponentTickEnabled(false);
+		break;
+	}
+
+	// Rooms and reverb volumes were not followed while inaudible, refresh them along with the position.
+	if (PreviousSignificance == EAkComponentSignificance::Inaudible)
+	{
+		bPositionUpdateDeferred = false;
+		UpdateGameObjectPosition(true);
+	}
+}
+
+void UAkComponent::UpdateOcclusionObstruction()
+{
+	// Called right before posting an event: an inaudible component must start playing from its actual position.
+	if (Significance == EAkComponentSignificance::Inaudible)
+		SetSignificance(EAkComponentSignificance::Reduced, ReducedSignificanceTickInterval);
+
+	// Don't wait for the end of the frame to send a position queued before posting.
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	if (AkAudioDevice && QueuedPositionUpdateIndex != INDEX_NONE)
+		AkAudioDevice->FlushQueuedPositionUpdate(this);
+
+	ObstructionService.UpdateObstructionOcclusion(Listeners, GetPosition(), GetOwner(), GetSpatialAudioRoom(), GetOcclusionCollisionChannel(), OcclusionRefreshInterval);
+}
+
 UAkComponent* UAkComponent::GetAkComponent(AkGameObjectID GameObjectID)
 { 
 	return GameObjectID == DUMMY_GAMEOBJ ? nullptr : (UAkComponent*)GameObjectID;
@@ -746,8 +802,13 @@ void UAkComponent::UpdateAkLateReverbComponentList( FVector Loc )
 	if (!AkAudioDevice)
 		return;
 
-	TArray<UAkLateReverbComponent*> FoundComponents = AkAudioDevice->FindLateReverbComponentsAtLocation(Loc, GetWorld());
+	TArray<UAkLateReverbComponent*, TInlineAllocator<8>> FoundComponents;
+	AkAudioDevice->GetLateReverbIndex().Query(Loc, GetWorld(), FoundComponents);
+	UpdateAkLateReverbComponentList(FoundComponents);
+}
 
+void UAkComponent::UpdateAkLateReverbComponentList(TArrayView<UAkLateReverbComponent* const> FoundComponents)
+{
 	// Add the new volumes to the current list
 	for (const auto& LateReverbComponent : FoundComponents)
 	{
@@ -802,7 +863,7 @@ bool UAkComponent::HasMoved()
 		CurrentSoundPosition.OrientationFront().X != soundpos.OrientationFront().X || CurrentSoundPosition.OrientationFront().Y != soundpos.OrientationFront().Y || CurrentSoundPosition.OrientationFront().Z != soundpos.OrientationFront().Z;
 }
 
-void UAkComponent::UpdateGameObjectPosition()
+void UAkComponent::UpdateGameObjectPosition(bool bForce)
 {
 #ifdef _DEBUG
 	CheckEmitterListenerConsistancy();
@@ -810,35 +871,37 @@ void UAkComponent::UpdateGameObjectPosition()
 	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
 	if (IsActive() && AkAudioDevice)
 	{
-		if (AllowAudioPlayback())
-		{
-			AkSoundPosition soundpos;
-			FVector Location, Front, Up;
-			UAkComponentUtils::GetLocationFrontUp(this, Location, Front, Up);
-			FAkAudioDevice::FVectorsToAKWorldTransform(Location, Front, Up, soundpos);
+		// The position is read, sent to Wwise and used to find the room and AkReverbVolumes once per frame, along with all the other moved components.
+		AkAudioDevice->QueuePositionUpdate(this, bForce);
+	}
+}
 
-			UpdateSpatialAudioRoom(Location);
+void UAkComponent::GetSoundTransform(FVector& Location, FVector& Front, FVector& Up) const
+{
+	UAkComponentUtils::GetLocationFrontUp(this, Location, Front, Up);
+}
 
-			AkAudioDevice->SetPosition(this, soundpos);
-			CurrentSoundPosition = soundpos;
-		}
-		 
-		// Find and apply all AkReverbVolumes at this location
-		if (bUseReverbVolumes && AkAudioDevice->GetMaxAuxBus() > 0)
+void UAkComponent::UpdateSpatialAudioRoom(FVector Location)
+{
+	if (IsRegisteredWithWwise)
+	{
+		FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+		if (AkAudioDevice)
 		{
-			UpdateAkLateReverbComponentList(GetComponentLocation());
+			TArray<UAkRoomComponent*, TInlineAllocator<4>> RoomComponents;
+			AkAudioDevice->GetRoomIndex().Query(Location, GetWorld(), RoomComponents);
+			SetSpatialAudioRoom(RoomComponents);
 		}
 	}
 }
 
-void UAkComponent::UpdateSpatialAudioRoom(FVector Location)
+void UAkComponent::SetSpatialAudioRoom(TArrayView<UAkRoomComponent* const> RoomComponents)
 {
 	if (IsRegisteredWithWwise)
 	{
 		FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
 		if (AkAudioDevice)
 		{
-			TArray<UAkRoomComponent*> RoomComponents = AkAudioDevice->FindRoomComponentsAtLocation(Location, GetWorld());
 			if (RoomComponents.Num() == 0)
 			{
 				if (AkAudioDevice->WorldHasActiveRooms(GetWorld()))
@@ -19,11 +19,16 @@ Copyright (c) 2021 Audiokinetic Inc.
 #include "AkInclude.h"
 #include "Misc/ScopeLock.h"
 #include "Misc/ScopeExit.h"
-#include "Async/Async.h"
 #include "AkCallbackInfoPool.h"
 #include "AkComponent.h"
 #include "Wwise/WwiseExternalSourceManager.h"
 
+DECLARE_STATS_GROUP(TEXT("AkCallbacks"), STATGROUP_AkCallbacks, STATCAT_Wwise);
+DECLARE_CYCLE_STAT(TEXT("Dispatch Pending Callbacks"), STAT_AkDispatchPendingCallbacks, STATGROUP_AkCallbacks);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Callback Packages"), STAT_AkCallbackPackages, STATGROUP_AkCallbacks);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Blueprint Callbacks Dispatched"), STAT_AkBlueprintCallbacksDispatched, STATGROUP_AkCallbacks);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ended Packages Released"), STAT_AkEndedPackagesReleased, STATGROUP_AkCallbacks);
+
 struct FAkComponentCallbackManager_Constants
 {
 	/// Optimization policy
@@ -64,48 +69,15 @@ void FAkFunctionPtrEventCallbackPackage::CancelCallback()
 
 void FAkBlueprintDelegateEventCallbackPackage::HandleAction(AkCallbackType in_eType, AkCallbackInfo* in_pCallbackInfo)
 {
-	if (BlueprintCallback.IsBound())
+	auto Manager = FAkComponentCallbackManager::GetInstance();
+	if (Manager && BlueprintCallback.IsBound())
 	{
 		AkCallbackInfo* cbInfoCopy = AkCallbackTypeHelpers::CopyWwiseCallbackInfo(in_eType, in_pCallbackInfo);
-		EAkCallbackType BlueprintCallbackType = AkCallbackTypeHelpers::GetBlueprintCallbackTypeFromAkCallbackType(in_eType);
-		auto CachedBlueprintCallback = BlueprintCallback;
-		AsyncTask(ENamedThreads::GameThread, [cbInfoCopy, BlueprintCallbackType, CachedBlueprintCallback]
+		if (cbInfoCopy)
 		{
-			if (!cbInfoCopy)
-			{
-				return;
-			}
-
-			ON_SCOPE_EXIT {
-				FMemory::Free(cbInfoCopy);
-			};
-
-			if (!CachedBlueprintCallback.IsBound())
-			{
-				return;
-			}
-
-			UAkComponent* akComponent = (UAkComponent*)cbInfoCopy->gameObjID;
-			if (!IsValid(akComponent))
-			{
-				return;
-			}
-
-			UAkCallbackInfo* BlueprintAkCallbackInfo = nullptr;
-			if (cbInfoCopy)
-			{
-				BlueprintAkCallbackInfo = AkCallbackTypeHelpers::GetBlueprintableCallbackInfo(BlueprintCallbackType, cbInfoCopy);
-			}
-			CachedBlueprintCallback.ExecuteIfBound(BlueprintCallbackType, BlueprintAkCallbackInfo);
-
-			if (auto AudioDevice = FAkAudioDevice::Get())
-			{
-				if (auto CallbackInfoPool = AudioDevice->GetAkCallbackInfoPool())
-				{
-					CallbackInfoPool->Release(BlueprintAkCallbackInfo);
-				}
-			}
-		});
+			// Executed on the game thread by FAkComponentCallbackManager::DispatchPendingCallbacks
+			Manager->EnqueueBlueprintCallback(cbInfoCopy, AkCallbackTypeHelpers::GetBlueprintCallbackTypeFromAkCallbackType(in_eType), BlueprintCallback);
+		}
 	}
 }
 
@@ -135,21 +107,9 @@ void FAkComponentCallbackManager::AkComponentCallback(AkCallbackType in_eType, A
 
 	if (Instance && pPackage)
 	{
-		const auto& gameObjID = in_pCallbackInfo->gameObjID;
-		bool deletePackage = false;
-
-		{
-			FScopeLock Lock(&Instance->CriticalSection);
-			auto pPackageSet = Instance->GameObjectToPackagesMap.Find(gameObjID);
-			if (pPackageSet && in_eType == AK_EndOfEvent)
-			{
-				Instance->RemovePackageFromSet(pPackageSet, pPackage, gameObjID);
-			}
-		}
-
-		if (in_eType == AK_EndOfEvent)
+		const bool bEndOfEvent = in_eType == AK_EndOfEvent;
+		if (bEndOfEvent)
 		{
-			deletePackage = true;
 			if (auto* Device = FAkAudioDevice::Get())
 			{
 				Device->RemovePlayingID(((AkEventCallbackInfo*)in_pCallbackInfo)->eventID, ((AkEventCallbackInfo*)in_pCallbackInfo)->playingID);
@@ -169,9 +129,10 @@ void FAkComponentCallbackManager::AkComponentCallback(AkCallbackType in_eType, A
 			pPackage->HandleAction(in_eType, in_pCallbackInfo);
 		}
 		
-		if (deletePackage)
+		if (bEndOfEvent)
 		{
-			delete pPackage;
+			// Never lock on the audio thread: the package is removed from its set and released by the game thread.
+			Instance->EndedPackages.Push(pPackage);
 		}
 	}
 }
@@ -188,21 +149,138 @@ FAkComponentCallbackManager::FAkComponentCallbackManager()
 
 FAkComponentCallbackManager::~FAkComponentCallbackManager()
 {
-	for (auto& Item : GameObjectToPackagesMap)
+	TArray<FPendingBlueprintCallback*> PendingCallbacks;
+	PendingBlueprintCallbacks.PopAll(PendingCallbacks);
+	for (auto pPending : PendingCallbacks)
 	{
-		for (auto pPackage : Item.Value)
+		FMemory::Free(pPending->CallbackInfo);
+		FreePendingBlueprintCallback(pPending);
+	}
+
+	// Ended packages are still in their set: release them once.
+	TArray<IAkUserEventCallbackPackage*> Packages;
+	EndedPackages.PopAll(Packages);
+	for (auto pPackage : Packages)
+	{
+		if (auto pPackageSet = GameObjectToPackagesMap.Find(pPackage->GameObjectID))
 		{
-			delete pPackage;
+			pPackageSet->Remove(pPackage);
 		}
 	}
 
+	for (auto& Item : GameObjectToPackagesMap)
+	{
+		Packages.Append(Item.Value.Array());
+	}
+
+	for (auto pPackage : Packages)
+	{
+		FreePackage(pPackage);
+	}
+
 	Instance = nullptr;
 }
 
+template<typename PackageType, typename... ArgTypes>
+PackageType* FAkComponentCallbackManager::AllocatePackage(AkGameObjectID in_gameObjID, ArgTypes&&... Args)
+{
+	static_assert(sizeof(PackageType) <= PackageSlotSize, "Callback package does not fit in the pooled slots.");
+	static_assert(alignof(PackageType) <= 16, "Callback package alignment is larger than the pooled slots alignment.");
+
+	auto pPackage = new (PackageAllocator.Allocate()) PackageType(Forward<ArgTypes>(Args)...);
+	pPackage->GameObjectID = in_gameObjID;
+	INC_DWORD_STAT(STAT_AkCallbackPackages);
+	return pPackage;
+}
+
+void FAkComponentCallbackManager::FreePackage(IAkUserEventCallbackPackage* in_pPackage)
+{
+	in_pPackage->~IAkUserEventCallbackPackage();
+	PackageAllocator.Free(in_pPackage);
+	DEC_DWORD_STAT(STAT_AkCallbackPackages);
+}
+
+void FAkComponentCallbackManager::EnqueueBlueprintCallback(AkCallbackInfo* in_pCallbackInfoCopy, EAkCallbackType in_CallbackType, const FOnAkPostEventCallback& in_Callback)
+{
+	auto pPending = new (PendingBlueprintCallbackAllocator.Allocate()) FPendingBlueprintCallback{ in_pCallbackInfoCopy, in_CallbackType, in_Callback };
+	PendingBlueprintCallbacks.Push(pPending);
+}
+
+void FAkComponentCallbackManager::FreePendingBlueprintCallback(FPendingBlueprintCallback* in_pPending)
+{
+	in_pPending->~FPendingBlueprintCallback();
+	PendingBlueprintCallbackAllocator.Free(in_pPending);
+}
+
+void FAkComponentCallbackManager::DispatchPendingCallbacks()
+{
+	check(IsInGameThread());
+	SCOPE_CYCLE_COUNTER(STAT_AkDispatchPendingCallbacks);
+
+	TArray<FPendingBlueprintCallback*, TInlineAllocator<64>> PendingCallbacks;
+	PendingBlueprintCallbacks.PopAll(PendingCallbacks);
+	if (PendingCallbacks.Num() > 0)
+	{
+		FAkAudioDevice* AudioDevice = FAkAudioDevice::Get();
+		AkCallbackInfoPool* CallbackInfoPool = AudioDevice ? AudioDevice->GetAkCallbackInfoPool() : nullptr;
+
+		for (auto pPending : PendingCallbacks)
+		{
+			ON_SCOPE_EXIT {
+				FMemory::Free(pPending->CallbackInfo);
+				FreePendingBlueprintCallback(pPending);
+			};
+
+			if (!pPending->Callback.IsBound())
+			{
+				continue;
+			}
+
+			UAkComponent* akComponent = (UAkComponent*)pPending->CallbackInfo->gameObjID;
+			if (!IsValid(akComponent))
+			{
+				continue;
+			}
+
+			UAkCallbackInfo* BlueprintAkCallbackInfo = AkCallbackTypeHelpers::GetBlueprintableCallbackInfo(pPending->CallbackType, pPending->CallbackInfo);
+			pPending->Callback.ExecuteIfBound(pPending->CallbackType, BlueprintAkCallbackInfo);
+
+			if (CallbackInfoPool)
+			{
+				CallbackInfoPool->Release(BlueprintAkCallbackInfo);
+			}
+		}
+		INC_DWORD_STAT_BY(STAT_AkBlueprintCallbacksDispatched, PendingCallbacks.Num());
+	}
+
+	TArray<IAkUserEventCallbackPackage*, TInlineAllocator<64>> Packages;
+	EndedPackages.PopAll(Packages);
+	if (Packages.Num() > 0)
+	{
+		{
+			FScopeLock Lock(&CriticalSection);
+			for (auto pPackage : Packages)
+			{
+				auto pPackageSet = GameObjectToPackagesMap.Find(pPackage->GameObjectID);
+				if (pPackageSet)
+				{
+					RemovePackageFromSet(pPackageSet, pPackage, pPackage->GameObjectID);
+				}
+			}
+		}
+
+		for (auto pPackage : Packages)
+		{
+			FreePackage(pPackage);
+		}
+		INC_DWORD_STAT_BY(STAT_AkEndedPackagesReleased, Packages.Num());
+	}
+}
+
 IAkUserEventCallbackPackage* FAkComponentCallbackManager::CreateCallbackPackage(AkCallbackFunc in_cbFunc, void* in_Cookie, uint32 in_Flags, AkGameObjectID in_gameObjID, bool HasExternalSources)
 {
 	uint32 KeyHash = GetKeyHash(in_Cookie);
-	auto pPackage = new FAkFunctionPtrEventCallbackPackage(in_cbFunc, in_Cookie, in_Flags, KeyHash, HasExternalSources);
+	auto pPackage = AllocatePackage<FAkFunctionPtrEventCallbackPackage>(in_gameObjID, in_cbFunc, in_Cookie, in_Flags, KeyHash, HasExternalSources);
 	if (pPackage)
 	{
 		FScopeLock Lock(&CriticalSection);
@@ -216,7 +294,7 @@ IAkUserEventCallbackPackage* FAkComponentCallbackManager::CreateCallbackPackage(
 IAkUserEventCallbackPackage* FAkComponentCallbackManager::CreateCallbackPackage(FOnAkPostEventCallback BlueprintCallback, uint32 in_Flags, AkGameObjectID in_gameObjID, bool HasExternalSources)
 {
 	uint32 KeyHash = GetKeyHash(BlueprintCallback);
-	auto pPackage = new FAkBlueprintDelegateEventCallbackPackage(BlueprintCallback, in_Flags, KeyHash, HasExternalSources);
+	auto pPackage = AllocatePackage<FAkBlueprintDelegateEventCallbackPackage>(in_gameObjID, BlueprintCallback, in_Flags, KeyHash, HasExternalSources);
 	if (pPackage)
 	{
 		FScopeLock Lock(&CriticalSection);
@@ -229,7 +307,7 @@ IAkUserEventCallbackPackage* FAkComponentCallbackManager::CreateCallbackPackage(
 
 IAkUserEventCallbackPackage* FAkComponentCallbackManager::CreateCallbackPackage(FWaitEndOfEventAction* LatentAction, AkGameObjectID in_gameObjID, bool HasExternalSources)
 {
-	auto pPackage = new FAkLatentActionEventCallbackPackage(LatentAction, 0, HasExternalSources);
+	auto pPackage = AllocatePackage<FAkLatentActionEventCallbackPackage>(in_gameObjID, LatentAction, 0, HasExternalSources);
 	if (pPackage)
 	{
 		FScopeLock Lock(&CriticalSection);
@@ -250,7 +328,7 @@ void FAkComponentCallbackManager::RemoveCallbackPackage(IAkUserEventCallbackPack
 		}
 	}
 
-	delete in_Package;
+	FreePackage(in_Package);
 }
 
 void FAkComponentCallbackManager::CancelEventCallback(void* in_Cookie)
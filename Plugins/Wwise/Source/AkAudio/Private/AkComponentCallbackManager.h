@@ -17,6 +17,8 @@ Copyright (c) 2021 Audiokinetic Inc.
 #pragma once
 
 #include "AkAudioDevice.h"
+#include "Containers/LockFreeList.h"
+#include "Containers/LockFreeFixedSizeAllocator.h"
 
 
 class IAkUserEventCallbackPackage
@@ -29,6 +31,9 @@ public:
 
 	bool HasExternalSources = false;
 
+	/** Game object the event was posted on, used to remove the package from its set once the event ended */
+	AkGameObjectID GameObjectID = AK_INVALID_GAME_OBJECT;
+
 	IAkUserEventCallbackPackage()
 		: uUserFlags(0)
 	{}
@@ -125,11 +130,41 @@ public:
 
 	bool HasActiveEvents(AkGameObjectID in_gameObjID);
 
+	/** Executes the Blueprint callbacks and releases the packages of the events that ended since the last call. Called once per frame on the game thread. */
+	void DispatchPendingCallbacks();
+
 private:
+	friend class FAkBlueprintDelegateEventCallbackPackage;
+
 	typedef TSet<IAkUserEventCallbackPackage*> PackageSet;
 
 	void RemovePackageFromSet(PackageSet* in_pPackageSet, IAkUserEventCallbackPackage* in_pPackage, AkGameObjectID in_gameObjID);
 
+	template<typename PackageType, typename... ArgTypes>
+	PackageType* AllocatePackage(AkGameObjectID in_gameObjID, ArgTypes&&... Args);
+	void FreePackage(IAkUserEventCallbackPackage* in_pPackage);
+
+	/** Packages are placement-constructed in fixed-size slots recycled through a lock-free free list */
+	static constexpr int32 PackageSlotSize = Align(FMath::Max(sizeof(FAkFunctionPtrEventCallbackPackage), FMath::Max(sizeof(FAkBlueprintDelegateEventCallbackPackage), sizeof(FAkLatentActionEventCallbackPackage))), 16);
+	TLockFreeFixedSizeAllocator<PackageSlotSize, PLATFORM_CACHE_LINE_SIZE> PackageAllocator;
+
+	/** Packages of ended events, pushed by the audio thread and released by DispatchPendingCallbacks */
+	TLockFreePointerListUnordered<IAkUserEventCallbackPackage, PLATFORM_CACHE_LINE_SIZE> EndedPackages;
+
+	struct FPendingBlueprintCallback
+	{
+		AkCallbackInfo* CallbackInfo;
+		EAkCallbackType CallbackType;
+		FOnAkPostEventCallback Callback;
+	};
+
+	void EnqueueBlueprintCallback(AkCallbackInfo* in_pCallbackInfoCopy, EAkCallbackType in_CallbackType, const FOnAkPostEventCallback& in_Callback);
+	void FreePendingBlueprintCallback(FPendingBlueprintCallback* in_pPending);
+
+	/** Blueprint callbacks queued by the audio thread, executed in order by DispatchPendingCallbacks */
+	TLockFreeFixedSizeAllocator<sizeof(FPendingBlueprintCallback), PLATFORM_CACHE_LINE_SIZE> PendingBlueprintCallbackAllocator;
+	TLockFreePointerListFIFO<FPendingBlueprintCallback, PLATFORM_CACHE_LINE_SIZE> PendingBlueprintCallbacks;
+
 	FCriticalSection CriticalSection;
 
 	typedef AkGameObjectIdKeyFuncs<PackageSet, false> PackageSetGameObjectIDKeyFuncs;
@@ -16,44 +16,105 @@ Copyright (c) 2021 Audiokinetic Inc.
 
 #include "AkEnvironmentIndex.h"
 #include "AkAudioDevice.h"
+#include "AkLateReverbComponent.h"
+#include "AkRoomComponent.h"
 #include "AkUEFeatures.h"
 
-void FAkEnvironmentOctreeSemantics::SetElementId(AK_OCTREE_TYPE<FAkEnvironmentOctreeElement, FAkEnvironmentOctreeSemantics>& OctreeOwner, const FAkEnvironmentOctreeElement& Element, AK_OCTREE_ELEMENT_ID Id)
+namespace FAkEnvironmentIndex_Helpers
 {
-	static_cast<UAkEnvironmentOctree&>(OctreeOwner).ObjectToOctreeId.Add(Element.Component->GetUniqueID(), Id);
+	static float GetPriority(const USceneComponent* Component)
+	{
+		if (const auto* Room = Cast<UAkRoomComponent>(Component))
+		{
+			return Room->Priority;
+		}
+		if (const auto* LateReverb = Cast<UAkLateReverbComponent>(Component))
+		{
+			return LateReverb->Priority;
+		}
+		return 0.f;
+	}
 }
 
-void FAkEnvironmentIndex::Add(USceneComponent* EnvironmentToAdd)
+void FAkEnvironmentWorldIndex::Rebuild()
 {
-	UWorld* CurrentWorld = EnvironmentToAdd->GetWorld();
-	TUniquePtr<UAkEnvironmentOctree>& Octree = Map.FindOrAdd(CurrentWorld);
-	
-	if (Octree == nullptr)
+	Components.RemoveAll([](const USceneComponent* Component)
+	{
+		return !IsValid(Component);
+	});
+
+	const int32 Count = Components.Num();
+	Priorities.Reset(Count);
+	for (const auto* Component : Components)
+	{
+		Priorities.Add(FAkEnvironmentIndex_Helpers::GetPriority(Component));
+	}
+
+	// Sort the components by decreasing priority. Ties keep their indexing order.
+	TArray<int32> Order;
+	Order.Reserve(Count);
+	for (int32 Index = 0; Index < Count; ++Index)
 	{
-		Octree = MakeUnique<UAkEnvironmentOctree>();
+		Order.Add(Index);
 	}
+	Algo::StableSort(Order, [this](int32 A, int32 B)
+	{
+		return Priorities[A] > Priorities[B];
+	});
 
-	if (Octree != nullptr)
+	TArray<USceneComponent*> SortedComponents;
+	TArray<float> SortedPriorities;
+	SortedComponents.Reserve(Count);
+	SortedPriorities.Reserve(Count);
+	MinX.Reset(Count);
+	MinY.Reset(Count);
+	MinZ.Reset(Count);
+	MaxX.Reset(Count);
+	MaxY.Reset(Count);
+	MaxZ.Reset(Count);
+	TotalBounds = FBox(ForceInit);
+	for (const int32 Index : Order)
 	{
-		FAkEnvironmentOctreeElement Element(EnvironmentToAdd);
-		Octree->AddElement(Element);
+		USceneComponent* Component = Components[Index];
+		const FBox Box = Component->Bounds.GetBox();
+		SortedComponents.Add(Component);
+		SortedPriorities.Add(Priorities[Index]);
+		MinX.Add(Box.Min.X);
+		MinY.Add(Box.Min.Y);
+		MinZ.Add(Box.Min.Z);
+		MaxX.Add(Box.Max.X);
+		MaxY.Add(Box.Max.Y);
+		MaxZ.Add(Box.Max.Z);
+		TotalBounds += Box;
 	}
+	Components = MoveTemp(SortedComponents);
+	Priorities = MoveTemp(SortedPriorities);
+	bDirty = false;
+}
+
+void FAkEnvironmentIndex::Add(USceneComponent* EnvironmentToAdd)
+{
+	UWorld* CurrentWorld = EnvironmentToAdd->GetWorld();
+	FAkEnvironmentWorldIndex& WorldIndex = Map.FindOrAdd(CurrentWorld);
+
+	WorldIndex.Components.AddUnique(EnvironmentToAdd);
+	WorldIndex.bDirty = true;
 }
 
 bool FAkEnvironmentIndex::Remove(USceneComponent* EnvironmentToRemove)
 {
+	if (EnvironmentToRemove == nullptr)
+	{
+		return false;
+	}
+
 	UWorld* CurrentWorld = EnvironmentToRemove->GetWorld();
-	TUniquePtr<UAkEnvironmentOctree>* Octree = Map.Find(CurrentWorld);
+	FAkEnvironmentWorldIndex* WorldIndex = Map.Find(CurrentWorld);
 
-	if (Octree != nullptr && EnvironmentToRemove != nullptr)
+	if (WorldIndex != nullptr)
 	{
-		AK_OCTREE_ELEMENT_ID* Id = (*Octree)->ObjectToOctreeId.Find(EnvironmentToRemove->GetUniqueID());
-		if (Id != nullptr && (*Octree)->IsValidElementId(*Id))
-		{
-			(*Octree)->RemoveElement(*Id);
-		}
-
-		(*Octree)->ObjectToOctreeId.Remove(EnvironmentToRemove->GetUniqueID());
+		WorldIndex->Components.RemoveSingle(EnvironmentToRemove);
+		WorldIndex->bDirty = true;
 		return true;
 	}
 
@@ -62,7 +123,7 @@ bool FAkEnvironmentIndex::Remove(USceneComponent* EnvironmentToRemove)
 
 void FAkEnvironmentIndex::Update(USceneComponent* Environment)
 {
-	Remove(Environment);
+	// Bounds are read back when the world index gets rebuilt.
 	Add(Environment);
 }
 
@@ -73,6 +134,5 @@ void FAkEnvironmentIndex::Clear(const UWorld* World)
 
 bool FAkEnvironmentIndex::IsEmpty(const UWorld* World)
 {
-	TUniquePtr<UAkEnvironmentOctree>* Octree = Map.Find(World);
-	return Octree == nullptr;
+	return Map.Find(World) == nullptr;
 }
@@ -23,6 +23,8 @@ Copyright (c) 2021 Audiokinetic Inc.
 #include "Components/StaticMeshComponent.h"
 #include "Engine/Polys.h"
 #include "Engine/StaticMesh.h"
+#include "Hash/CityHash.h"
+#include "Misc/MemStack.h"
 
 #if PHYSICS_INTERFACE_PHYSX
 #include "PhysXPublic.h"
@@ -47,6 +49,23 @@ Copyright (c) 2021 Audiokinetic Inc.
 
 static const float kVertexNear = 0.0001;
 
+namespace AkGeometryComponent_Helpers
+{
+	// Surface names are not hashed: they are only used for profiling, so identical meshes on different actors still share a geometry set.
+	uint64 HashGeometry(TArrayView<const AkVertex> Vertices, TArrayView<const AkTriangle> Triangles, const TArray<FAkAcousticSurface>& Surfaces, const AkGeometryParams& Params)
+	{
+		uint64 Hash = CityHash64(reinterpret_cast<const char*>(Vertices.GetData()), Vertices.Num() * sizeof(AkVertex));
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(Triangles.GetData()), Triangles.Num() * sizeof(AkTriangle), Hash);
+		for (const FAkAcousticSurface& Surface : Surfaces)
+		{
+			Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Surface.Texture), sizeof(Surface.Texture), Hash);
+			Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Surface.Occlusion), sizeof(Surface.Occlusion), Hash);
+		}
+		const uint8 Flags = (Params.EnableDiffraction ? 1 : 0) | (Params.EnableDiffractionOnBoundaryEdges ? 2 : 0) | (Params.EnableTriangles ? 4 : 0);
+		return CityHash64WithSeed(reinterpret_cast<const char*>(&Flags), sizeof(Flags), Hash);
+	}
+}
+
 UAkGeometryComponent::UAkGeometryComponent(const class FObjectInitializer& ObjectInitializer) :
 	Super(ObjectInitializer)
 {
@@ -59,6 +78,7 @@ UAkGeometryComponent::UAkGeometryComponent(const class FObjectInitializer& Objec
 	CollisionMeshSurfaceOverride.bEnableOcclusionOverride = false;
 	CollisionMeshSurfaceOverride.OcclusionValue = 1.f;
 	WeldingThreshold = 0.001;
+	DiffractionSimplificationThreshold = 0.f;
 
 	bWasAddedByRoom = 0;
 	bEnableDiffraction = 1;
@@ -388,6 +408,14 @@ void DetermineVertsToWeld(TArray<int32>& VertRemap, TArray<int32>& UniqueVerts,
 	}
 }
 
+float UAkGeometryComponent::GetEffectiveWeldingThreshold() const
+{
+	if (bEnableDiffraction && DiffractionSimplificationThreshold > WeldingThreshold)
+		return DiffractionSimplificationThreshold;
+
+	return WeldingThreshold;
+}
+
 void UAkGeometryComponent::ConvertMesh()
 {
 	if (!(Parent && IsValid(Parent)))
@@ -440,12 +468,17 @@ void UAkGeometryComponent::ConvertStaticMesh(UStaticMeshComponent* StaticMeshCom
 	TArray<int32> VertRemap;
 	TArray<int32> UniqueVerts;
 
-	DetermineVertsToWeld(VertRemap, UniqueVerts, RenderMesh, WeldingThreshold);
+	const float EffectiveWeldingThreshold = GetEffectiveWeldingThreshold();
+	const bool bSimplify = EffectiveWeldingThreshold > WeldingThreshold;
+	DetermineVertsToWeld(VertRemap, UniqueVerts, RenderMesh, EffectiveWeldingThreshold);
 
 	for (int PosIndex = 0; PosIndex < UniqueVerts.Num(); ++PosIndex)
 	{
 		const int32 UnrealPosIndex = UniqueVerts[PosIndex];
 		auto VertexInActorSpace = RenderMesh.VertexBuffers.PositionVertexBuffer.VertexPosition(UnrealPosIndex);
+		// When simplifying, keep the vertices on the coarse grid so that welded neighbours stay aligned.
+		if (bSimplify)
+			VertexInActorSpace = VertexInActorSpace.GridSnap(EffectiveWeldingThreshold);
 		GeometryData.Vertices.Add(FVector(VertexInActorSpace));
 	}
 
@@ -502,26 +535,27 @@ void UAkGeometryComponent::ConvertStaticMesh(UStaticMeshComponent* StaticMeshCom
 			uint32 UniqueVertIndex2 = VertRemap[RawVertIndex2];
 
 			Edge0.Empty(8);
-			bool succeeded = AddVertsForEdge(RenderMesh.VertexBuffers.PositionVertexBuffer, UniqueVerts, RawVertIndex0, UniqueVertIndex0, RawVertIndex1, UniqueVertIndex1, Edge0, WeldingThreshold);
+			bool succeeded = AddVertsForEdge(RenderMesh.VertexBuffers.PositionVertexBuffer, UniqueVerts, RawVertIndex0, UniqueVertIndex0, RawVertIndex1, UniqueVertIndex1, Edge0, EffectiveWeldingThreshold);
 			if (!succeeded)
 			{
-				UE_LOG(LogAkAudio, Warning, TEXT("%s: UAkGeometryComponent::ConvertStaticMesh Vertex IDs %i and %i are too close resulting in a triangle with an area of 0. The triangle will be skipped."), *GetOwner()->GetName(), RawVertIndex0, RawVertIndex1);
+				// Simplification is expected to collapse small triangles.
+				UE_CLOG(!bSimplify, LogAkAudio, Warning, TEXT("%s: UAkGeometryComponent::ConvertStaticMesh Vertex IDs %i and %i are too close resulting in a triangle with an area of 0. The triangle will be skipped."), *GetOwner()->GetName(), RawVertIndex0, RawVertIndex1);
 				continue;
 			}
 
 			Edge1.Empty(8);
-			succeeded = AddVertsForEdge(RenderMesh.VertexBuffers.PositionVertexBuffer, UniqueVerts, RawVertIndex1, UniqueVertIndex1, RawVertIndex2, UniqueVertIndex2, Edge1, WeldingThreshold);
+			succeeded = AddVertsForEdge(RenderMesh.VertexBuffers.PositionVertexBuffer, UniqueVerts, RawVertIndex1, UniqueVertIndex1, RawVertIndex2, UniqueVertIndex2, Edge1, EffectiveWeldingThreshold);
 			if (!succeeded)
 			{
-				UE_LOG(LogAkAudio, Warning, TEXT("%s: UAkGeometryComponent::ConvertStaticMesh Vertex IDs %i and %i are too close resulting in a triangle with an area of 0. The triangle will be skipped."), *GetOwner()->GetName(), RawVertIndex1, RawVertIndex2);
+				UE_CLOG(!bSimplify, LogAkAudio, Warning, TEXT("%s: UAkGeometryComponent::ConvertStaticMesh Vertex IDs %i and %i are too close resulting in a triangle with an area of 0. The triangle will be skipped."), *GetOwner()->GetName(), RawVertIndex1, RawVertIndex2);
 				continue;
 			}
 
 			Edge2.Empty(8);
-			succeeded = AddVertsForEdge(RenderMesh.VertexBuffers.PositionVertexBuffer, UniqueVerts, RawVertIndex2, UniqueVertIndex2, RawVertIndex0, UniqueVertIndex0, Edge2, WeldingThreshold);
+			succeeded = AddVertsForEdge(RenderMesh.VertexBuffers.PositionVertexBuffer, UniqueVerts, RawVertIndex2, UniqueVertIndex2, RawVertIndex0, UniqueVertIndex0, Edge2, EffectiveWeldingThreshold);
 			if (!succeeded)
 			{
-				UE_LOG(LogAkAudio, Warning, TEXT("%s: UAkGeometryComponent::ConvertStaticMesh Vertex IDs %i and %i are too close resulting in a triangle with an area of 0. The triangle will be skipped."), *GetOwner()->GetName(), RawVertIndex2, RawVertIndex0);
+				UE_CLOG(!bSimplify, LogAkAudio, Warning, TEXT("%s: UAkGeometryComponent::ConvertStaticMesh Vertex IDs %i and %i are too close resulting in a triangle with an area of 0. The triangle will be skipped."), *GetOwner()->GetName(), RawVertIndex2, RawVertIndex0);
 				continue;
 			}
 
@@ -922,11 +956,37 @@ void UAkGeometryComponent::SendGeometry()
 	{
 		if (GeometryData.Triangles.Num() > 0 && GeometryData.Vertices.Num() > 0)
 		{
+			check(IsInGameThread());
+
+			// Temporary triangle and vertex buffers come from the game thread's memory stack, released when leaving this scope.
+			// Wwise copies the geometry in SetGeometry, and the hash doesn't keep them.
+			FMemMark Mark(FMemStack::Get());
+
+			TArray<AkTriangle, TMemStackAllocator<>> Triangles;
+			Triangles.Reserve(GeometryData.Triangles.Num());
+			for (const FAkTriangle& Triangle : GeometryData.Triangles)
+				Triangles.Emplace(Triangle.Point0, Triangle.Point1, Triangle.Point2, Triangle.Surface);
+
+			TArray<AkVertex, TMemStackAllocator<>> Vertices;
+			Vertices.Reserve(GeometryData.Vertices.Num());
+			for (const FVector& Vertex : GeometryData.Vertices)
+				Vertices.Emplace((AkReal32)Vertex.X, (AkReal32)Vertex.Y, (AkReal32)Vertex.Z);
+
 			AkGeometryParams params;
 			params.NumSurfaces = GeometryData.Surfaces.Num();
-			params.NumTriangles = GeometryData.Triangles.Num();
-			params.NumVertices = GeometryData.Vertices.Num();
-			
+			params.NumTriangles = Triangles.Num();
+			params.NumVertices = Vertices.Num();
+			params.Triangles = Triangles.GetData();
+			params.Vertices = Vertices.GetData();
+			params.EnableDiffraction = bEnableDiffraction;
+			params.EnableDiffractionOnBoundaryEdges = bEnableDiffractionOnBoundaryEdges;
+			params.EnableTriangles = !bWasAddedByRoom;
+
+			// Identical meshes share a single geometry set, only the instances differ.
+			const uint64 GeometryHash = AkGeometryComponent_Helpers::HashGeometry(Vertices, Triangles, GeometryData.Surfaces, params);
+			if (AcquireSharedGeometry(GeometryHash))
+				return;
+
 			TArray<AkAcousticSurface> Surfaces;
 			TArray< TSharedPtr< decltype(StringCast<ANSICHAR>(TEXT(""))) > > SurfaceNames;
 			Surfaces.SetNum(params.NumSurfaces);
@@ -948,30 +1008,7 @@ void UAkGeometryComponent::SendGeometry()
 			}
 			params.Surfaces = Surfaces.GetData();
 
-			TUniquePtr<AkTriangle[]> Triangles = MakeUnique<AkTriangle[]>(params.NumTriangles);// temp triangle buffer
-			for (int i = 0; i < params.NumTriangles; ++i)
-			{
-				Triangles[i].point0 = GeometryData.Triangles[i].Point0;
-				Triangles[i].point1 = GeometryData.Triangles[i].Point1;
-				Triangles[i].point2 = GeometryData.Triangles[i].Point2;
-				Triangles[i].surface = GeometryData.Triangles[i].Surface;
-			}
-			params.Triangles = Triangles.Get();
-
-			TUniquePtr<AkVertex[]> Vertices = MakeUnique<AkVertex[]>(params.NumVertices); // temp vertex buffer
-			for (int i = 0; i < params.NumVertices; ++i)
-			{
-				Vertices[i].X = GeometryData.Vertices[i].X;
-				Vertices[i].Y = GeometryData.Vertices[i].Y;
-				Vertices[i].Z = GeometryData.Vertices[i].Z;
-			}
-			params.Vertices = Vertices.Get();
-			
-			params.EnableDiffraction = bEnableDiffraction;
-			params.EnableDiffractionOnBoundaryEdges = bEnableDiffractionOnBoundaryEdges;
-			params.EnableTriangles = !bWasAddedByRoom;
-
-			SendGeometryToWwise(params);
+			SendSharedGeometryToWwise(GeometryHash, params);
 		}
 	}
 }
@@ -1060,7 +1097,9 @@ void UAkGeometryComponent::PostEditChangeProperty(FPropertyChangedEvent& Propert
 		RecalculateHFDamping();
 	}
 	if (MeshType == AkMeshType::StaticMesh &&
-		memberPropertyName == GET_MEMBER_NAME_CHECKED(UAkGeometryComponent, WeldingThreshold) &&
+		(memberPropertyName == GET_MEMBER_NAME_CHECKED(UAkGeometryComponent, WeldingThreshold) ||
+		memberPropertyName == GET_MEMBER_NAME_CHECKED(UAkGeometryComponent, DiffractionSimplificationThreshold) ||
+		(memberPropertyName == GET_MEMBER_NAME_CHECKED(UAkGeometryComponent, bEnableDiffraction) && DiffractionSimplificationThreshold > WeldingThreshold)) &&
 		PropertyChangedEvent.ChangeType == EPropertyChangeType::ValueSet)
 	{
 		ConvertMesh();
@@ -1169,8 +1208,13 @@ void UAkGeometryComponent::Serialize(FArchive& Ar)
 {
 #if WITH_EDITORONLY_DATA
 	UWorld* World = GetWorld();
-	if (Ar.IsSaving() && World != nullptr && !World->IsGameWorld())
+	// Also convert when cooking, so that cooked builds never weld vertices at runtime: BeginPlay only converts when no data was saved.
+	if (Ar.IsSaving() && (Ar.IsCooking() || (World != nullptr && !World->IsGameWorld())))
+	{
+		if (Parent == nullptr)
+			InitializeParent();
 		ConvertMesh();
+	}
 #endif
 
 	Super::Serialize(Ar);
@@ -15,29 +15,42 @@ Copyright (c) 2021 Audiokinetic Inc.
 
 #include "AkJobWorkerScheduler.h"
 #include "AkAudioDevice.h"
+#include "AkSettings.h"
 
-#define AK_DECLARE_JOB_TYPE(__job__, __desc__, __thread__) \
+DECLARE_STATS_GROUP(TEXT("AkJobWorkers"), STATGROUP_AkJobWorkers, STATCAT_Wwise);
+
+#define AK_DECLARE_JOB_TYPE(__job__, __desc__) \
 	DECLARE_CYCLE_STAT(TEXT(__desc__), STAT_AkJob##__job__, STATGROUP_Audio); \
-	static ENamedThreads::Type kThread##__job__ = __thread__;
+	DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT(__desc__ " Queue Wait (ms)"), STAT_AkJob##__job__##QueueWait, STATGROUP_AkJobWorkers); \
+	DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT(__desc__ " Run Time (ms)"), STAT_AkJob##__job__##RunTime, STATGROUP_AkJobWorkers); \
+	DECLARE_DWORD_COUNTER_STAT(TEXT(__desc__ " Workers"), STAT_AkJob##__job__##Workers, STATGROUP_AkJobWorkers);
 
 #define AK_DEFINE_JOB_CASE(__job__) \
 	case AkJobType_##__job__: \
+	{ \
+		const uint64 DispatchCycles = FPlatformTime::Cycles64(); \
+		INC_DWORD_STAT_BY(STAT_AkJob##__job__##Workers, in_uNumWorkers); \
 		for (int i=0; i < (int)in_uNumWorkers; i++) { \
 			FFunctionGraphTask::CreateAndDispatchWhenReady([=]() { \
+				const uint64 StartCycles = FPlatformTime::Cycles64(); \
+				INC_FLOAT_STAT_BY(STAT_AkJob##__job__##QueueWait, FPlatformTime::ToMilliseconds64(StartCycles - DispatchCycles)); \
 				in_fnJobWorker(AkJobType_##__job__, uMaxExecutionTime); \
-			}, GET_STATID(STAT_AkJob##__job__), nullptr, kThread##__job__); \
+				INC_FLOAT_STAT_BY(STAT_AkJob##__job__##RunTime, FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles)); \
+			}, GET_STATID(STAT_AkJob##__job__), nullptr, Thread); \
 		} \
-		break;
+		break; \
+	}
 
-static_assert(AK_NUM_JOB_TYPES == 3, "Update the stat groups and switch cases below for new job types!");
-AK_DECLARE_JOB_TYPE(Generic, "Wwise Generic Job", ENamedThreads::AnyHiPriThreadNormalTask);
-AK_DECLARE_JOB_TYPE(AudioProcessing, "Wwise Audio Processing Job", ENamedThreads::AnyHiPriThreadNormalTask);
-AK_DECLARE_JOB_TYPE(SpatialAudio, "Wwise Spatial Audio Job", ENamedThreads::AnyHiPriThreadNormalTask);
+static_assert(AK_NUM_JOB_TYPES == 3, "Update the stat groups, switch cases and UAkSettings below for new job types!");
+AK_DECLARE_JOB_TYPE(Generic, "Wwise Generic Job");
+AK_DECLARE_JOB_TYPE(AudioProcessing, "Wwise Audio Processing Job");
+AK_DECLARE_JOB_TYPE(SpatialAudio, "Wwise Spatial Audio Job");
 
 static void OnJobWorkerRequest(AkJobWorkerFunc in_fnJobWorker, AkJobType in_jobType, AkUInt32 in_uNumWorkers, void* in_pUserData)
 {
 	FAkJobWorkerScheduler* pScheduler = static_cast<FAkJobWorkerScheduler*>(in_pUserData);
-	AkUInt32 uMaxExecutionTime = pScheduler->uMaxExecutionTime;
+	const AkUInt32 uMaxExecutionTime = pScheduler->JobTypeMaxExecutionTime[in_jobType];
+	const ENamedThreads::Type Thread = pScheduler->JobTypeThread[in_jobType];
 	switch (in_jobType)
 	{
 		AK_DEFINE_JOB_CASE(Generic);
@@ -46,6 +59,24 @@ static void OnJobWorkerRequest(AkJobWorkerFunc in_fnJobWorker, AkJobType in_jobT
 	}
 }
 
+namespace AkJobWorkerScheduler_Helpers
+{
+	ENamedThreads::Type GetThread(EAkJobWorkerThreadPriority Priority)
+	{
+		switch (Priority)
+		{
+		case EAkJobWorkerThreadPriority::Background:
+			return ENamedThreads::bHasBackgroundThreads ? ENamedThreads::AnyBackgroundThreadNormalTask : ENamedThreads::AnyNormalThreadNormalTask;
+		case EAkJobWorkerThreadPriority::Normal:
+			return ENamedThreads::AnyNormalThreadNormalTask;
+		case EAkJobWorkerThreadPriority::High:
+		default:
+			check(ENamedThreads::bHasHighPriorityThreads);
+			return ENamedThreads::AnyHiPriThreadNormalTask;
+		}
+	}
+}
+
 void FAkJobWorkerScheduler::InstallJobWorkerScheduler(uint32 in_uMaxExecutionTime, AkJobMgrSettings & out_settings)
 {
 	if (!FTaskGraphInterface::Get().IsRunning())
@@ -58,15 +89,28 @@ void FAkJobWorkerScheduler::InstallJobWorkerScheduler(uint32 in_uMaxExecutionTim
 	}
 	else
 	{
-		check(ENamedThreads::bHasHighPriorityThreads);
 		uMaxExecutionTime = in_uMaxExecutionTime;
 
 		out_settings.fnRequestJobWorker = OnJobWorkerRequest;
 		out_settings.pClientData = this;
-		AkUInt32 uMaxActiveWorkers = FTaskGraphInterface::Get().GetNumWorkerThreads();
+
+		const FAkJobWorkerSettings DefaultJobWorkerSettings;
+		const UAkSettings* AkSettings = GetDefault<UAkSettings>();
+		const FAkJobWorkerSettings* JobWorkerSettings[AK_NUM_JOB_TYPES];
+		JobWorkerSettings[AkJobType_Generic] = AkSettings ? &AkSettings->GenericJobWorkerSettings : &DefaultJobWorkerSettings;
+		JobWorkerSettings[AkJobType_AudioProcessing] = AkSettings ? &AkSettings->AudioProcessingJobWorkerSettings : &DefaultJobWorkerSettings;
+		JobWorkerSettings[AkJobType_SpatialAudio] = AkSettings ? &AkSettings->SpatialAudioJobWorkerSettings : &DefaultJobWorkerSettings;
+
+		const AkUInt32 uNumWorkerThreads = FTaskGraphInterface::Get().GetNumWorkerThreads();
 		for (int i = 0; i < AK_NUM_JOB_TYPES; i++)
 		{
-			out_settings.uMaxActiveWorkers[i] = uMaxActiveWorkers;
+			const FAkJobWorkerSettings& Settings = *JobWorkerSettings[i];
+			JobTypeThread[i] = AkJobWorkerScheduler_Helpers::GetThread(Settings.ThreadPriority);
+			JobTypeMaxExecutionTime[i] = Settings.MaxExecutionTimeUSec > 0 ? (uint32)Settings.MaxExecutionTimeUSec : uMaxExecutionTime;
+			out_settings.uMaxActiveWorkers[i] = Settings.MaxActiveWorkers > 0 ? FMath::Min((AkUInt32)Settings.MaxActiveWorkers, uNumWorkerThreads) : uNumWorkerThreads;
+
+			UE_LOG(LogAkAudio, Verbose, TEXT("Job type %d: %u max active workers, %u us max execution time, thread priority %d."),
+				i, out_settings.uMaxActiveWorkers[i], JobTypeMaxExecutionTime[i], (int32)Settings.ThreadPriority);
 		}
 	}
 }
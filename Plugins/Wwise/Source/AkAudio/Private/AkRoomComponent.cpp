@@ -363,7 +363,7 @@ void UAkRoomComponent::GetRoomParams(AkRoomParams& outParams)
 	}
 
 	if (GeometryComponent != nullptr)
-		outParams.GeometryInstanceID = GeometryComponent->GetGeometrySetID();
+		outParams.GeometryInstanceID = GeometryComponent->GetGeometryInstanceID();
 	
 	outParams.RoomGameObj_AuxSendLevelToSelf = AuxSendLevel;
 	outParams.RoomGameObj_KeepRegistered = AkAudioEvent == NULL && EventName.IsEmpty() ? false : true;
@@ -20,6 +20,7 @@ AkSubmixInputComponent.cpp:
 
 #include "AkSubmixInputComponent.h"
 #include "AkAudioDevice.h"
+#include "AkAudioBufferUtils.h"
 #include "AudioMixerDevice.h"
 
 UAkSubmixInputComponent::UAkSubmixInputComponent(const class FObjectInitializer& ObjectInitializer) :
@@ -96,14 +97,7 @@ bool UAkSubmixInputComponent::FillSamplesBuffer(uint32 InNumChannels, uint32 InN
 		auto NumPopped = SampleBuffer.Pop(PoppedSamples.GetData(), InNumChannels * InNumSamples);
 		if (NumPopped == InNumChannels * InNumSamples)
 		{
-			for (uint32 Channel = 0; Channel < InNumChannels; Channel++)
-			{
-				for (uint32 Sample = 0; Sample < InNumSamples; Sample++)
-				{
-					InOutBufferToFill[Channel][Sample] = PoppedSamples[((NumChannels * Sample) + Channel)];
-				}
-			}
-
+			AkAudioBufferUtils::Deinterleave(PoppedSamples.GetData(), InOutBufferToFill, InNumChannels, InNumSamples);
 			return true;
 		}
 	}
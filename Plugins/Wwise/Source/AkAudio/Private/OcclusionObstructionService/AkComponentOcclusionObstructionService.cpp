@@ -47,4 +47,14 @@ void AkComponentOcclusionObstructionService::SetOcclusionObstruction(AkGameObjec
 			AkAudioDevice->SetOcclusionAndObstruction(gameObjId, ListenerId, 0.0f, Value);
 		}
 	}
+}
+
+bool AkComponentOcclusionObstructionService::IsAudible() const
+{
+	return AssociatedComponent && AssociatedComponent->HasActiveEvents();
+}
+
+float AkComponentOcclusionObstructionService::GetAudibleRadius() const
+{
+	return AssociatedComponent ? AssociatedComponent->GetAttenuationRadius() : 0.0f;
 }
\ No newline at end of file
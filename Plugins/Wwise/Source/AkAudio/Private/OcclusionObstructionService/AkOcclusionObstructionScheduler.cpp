@@ -0,0 +1,198 @@
+/*******************************************************************************
+The content of the files in this repository include portions of the
+AUDIOKINETIC Wwise Technology released in source code form as part of the SDK
+package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use these files in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+Copyright (c) 2021 Audiokinetic Inc.
+*******************************************************************************/
+
+
+/*=============================================================================
+AkOcclusionObstructionScheduler.cpp:
+=============================================================================*/
+
+#include "OcclusionObstructionService/AkOcclusionObstructionScheduler.h"
+#include "OcclusionObstructionService/AkOcclusionObstructionService.h"
+#include "AkAudioDevice.h"
+#include "AkSettings.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "GameFramework/PlayerController.h"
+
+DECLARE_STATS_GROUP(TEXT("AkOcclusionObstruction"), STATGROUP_AkOcclusionObstruction, STATCAT_Wwise);
+DECLARE_CYCLE_STAT(TEXT("Scheduler Tick"), STAT_AkOcclusionSchedulerTick, STATGROUP_AkOcclusionObstruction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Traces Issued"), STAT_AkOcclusionTracesIssued, STATGROUP_AkOcclusionObstruction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Listener Traces Shared"), STAT_AkOcclusionTracesShared, STATGROUP_AkOcclusionObstruction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Requests Served"), STAT_AkOcclusionRequestsServed, STATGROUP_AkOcclusionObstruction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Requests Delayed"), STAT_AkOcclusionRequestsDelayed, STATGROUP_AkOcclusionObstruction);
+
+namespace AkOcclusionObstructionScheduler_Helpers
+{
+	// Priority gained by a request every frame it is delayed, so far or silent sources are eventually refreshed.
+	constexpr float PriorityPerFrameOfAge = 0.25f;
+}
+
+void FAkOcclusionObstructionScheduler::RequestRefresh(UWorld* World, const FRequest& Request)
+{
+	check(Request.Service);
+	Worlds.FindOrAdd(World).Requests.Add(Request);
+}
+
+void FAkOcclusionObstructionScheduler::Unregister(AkOcclusionObstructionService* Service)
+{
+	for (auto& WorldState : Worlds)
+	{
+		FWorldState& State = WorldState.Value;
+		State.Requests.RemoveAll([Service](const FRequest& Request)
+		{
+			return Request.Service == Service;
+		});
+
+		// Keep the pending traces in place: their indices are used to share listener-side traces.
+		for (auto& PendingTrace : State.PendingTraces)
+		{
+			PendingTrace.Targets.RemoveAll([Service](const FTraceTarget& Target)
+			{
+				return Target.Service == Service;
+			});
+		}
+	}
+}
+
+void FAkOcclusionObstructionScheduler::ClearWorld(UWorld* World)
+{
+	Worlds.Remove(World);
+}
+
+void FAkOcclusionObstructionScheduler::Tick(UWorld* World)
+{
+	using namespace AkOcclusionObstructionScheduler_Helpers;
+
+	FWorldState* State = Worlds.Find(World);
+	if (State == nullptr)
+		return;
+
+	SCOPE_CYCLE_COUNTER(STAT_AkOcclusionSchedulerTick);
+
+	WriteBackResults(World, *State);
+
+	if (State->Requests.Num() == 0)
+		return;
+
+	const UAkSettings* AkSettings = GetDefault<UAkSettings>();
+	const int32 TraceBudget = FMath::Max(AkSettings->OcclusionTraceBudgetPerFrame, 1);
+	const float ShareDistance = AkSettings->OcclusionListenerTraceShareDistance;
+
+	const AActor* PlayerPawn = nullptr;
+	if (auto PlayerController = GEngine->GetFirstLocalPlayerController(World))
+		PlayerPawn = PlayerController->GetPawn();
+
+	State->Requests.Sort([](const FRequest& A, const FRequest& B)
+	{
+		return A.Priority + A.Age * PriorityPerFrameOfAge > B.Priority + B.Age * PriorityPerFrameOfAge;
+	});
+
+	State->ListenerTraces.Reset();
+	int32 UsedBudget = 0;
+	int32 NumServed = 0;
+	// A request's cost is only known once its direct path is traced, so the last request served can overshoot the budget.
+	// This also serves at least one request every frame, even with a budget smaller than a single request.
+	for (; NumServed < State->Requests.Num() && UsedBudget < TraceBudget; ++NumServed)
+	{
+		UsedBudget += ServeRequest(World, *State, State->Requests[NumServed], PlayerPawn, ShareDistance);
+	}
+	State->Requests.RemoveAt(0, NumServed, false);
+
+	for (auto& Request : State->Requests)
+	{
+		++Request.Age;
+	}
+
+	INC_DWORD_STAT_BY(STAT_AkOcclusionTracesIssued, UsedBudget);
+	INC_DWORD_STAT_BY(STAT_AkOcclusionRequestsServed, NumServed);
+	INC_DWORD_STAT_BY(STAT_AkOcclusionRequestsDelayed, State->Requests.Num());
+}
+
+void FAkOcclusionObstructionScheduler::WriteBackResults(UWorld* World, FWorldState& State)
+{
+	for (int32 TraceIndex = State.PendingTraces.Num() - 1; TraceIndex >= 0; --TraceIndex)
+	{
+		FPendingTrace& PendingTrace = State.PendingTraces[TraceIndex];
+		FTraceDatum OutData;
+		if (World->QueryTraceData(PendingTrace.Handle, OutData))
+		{
+			const bool bCollision = OutData.OutHits.Num() > 0;
+			for (const auto& Target : PendingTrace.Targets)
+			{
+				Target.Service->OnRayCollision(Target.ListenerID, Target.PointIndex, Target.bFromListener, bCollision);
+			}
+			State.PendingTraces.RemoveAtSwap(TraceIndex, 1, false);
+		}
+		else if (!World->IsTraceHandleValid(PendingTrace.Handle, false))
+		{
+			// The results were discarded by the world before we could read them.
+			State.PendingTraces.RemoveAtSwap(TraceIndex, 1, false);
+		}
+	}
+}
+
+int32 FAkOcclusionObstructionScheduler::ServeRequest(UWorld* World, FWorldState& State, const FRequest& Request, const AActor* PlayerPawn, float ShareDistance)
+{
+	static const FName NAME_SoundOcclusion = TEXT("SoundOcclusion");
+	FCollisionQueryParams CollisionParams(NAME_SoundOcclusion, true, Request.Actor.Get());
+	if (PlayerPawn)
+		CollisionParams.AddIgnoredActor(PlayerPawn);
+
+	FHitResult OutHit;
+	const bool bOccluded = World->LineTraceSingleByChannel(OutHit, Request.SourcePosition, Request.ListenerPosition, Request.CollisionChannel, CollisionParams);
+	Request.Service->OnRefreshServed(Request.ListenerID, bOccluded);
+	if (!bOccluded)
+		return 1;
+
+	FVector Points[NUM_BOUNDING_BOX_TRACE_POINTS];
+	AkOcclusionObstructionService::GetBoundingBoxTracePoints(OutHit, Points);
+
+	int32 NumTraces = 1;
+	for (int32 PointIndex = 0; PointIndex < NUM_BOUNDING_BOX_TRACE_POINTS; ++PointIndex)
+	{
+		const FVector& Point = Points[PointIndex];
+
+		FPendingTrace& SourceTrace = State.PendingTraces.AddDefaulted_GetRef();
+		SourceTrace.Handle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Request.SourcePosition, Point, Request.CollisionChannel, CollisionParams);
+		SourceTrace.Targets.Add({ Request.Service, Request.ListenerID, PointIndex, false });
+		++NumTraces;
+
+		// Sources occluded by the same obstacle trace from the listener to the same points of its bounding box.
+		FListenerTraceKey Key{ Request.ListenerID, FIntVector::ZeroValue, Request.CollisionChannel };
+		const int32* SharedTraceIndex = nullptr;
+		if (ShareDistance > 0.f)
+		{
+			Key.EndCell = FIntVector((int32)FMath::FloorToFloat(Point.X / ShareDistance), (int32)FMath::FloorToFloat(Point.Y / ShareDistance), (int32)FMath::FloorToFloat(Point.Z / ShareDistance));
+			SharedTraceIndex = State.ListenerTraces.Find(Key);
+		}
+
+		if (SharedTraceIndex)
+		{
+			State.PendingTraces[*SharedTraceIndex].Targets.Add({ Request.Service, Request.ListenerID, PointIndex, true });
+			INC_DWORD_STAT(STAT_AkOcclusionTracesShared);
+		}
+		else
+		{
+			const int32 ListenerTraceIndex = State.PendingTraces.AddDefaulted();
+			FPendingTrace& ListenerTrace = State.PendingTraces[ListenerTraceIndex];
+			ListenerTrace.Handle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Request.ListenerPosition, Point, Request.CollisionChannel, CollisionParams);
+			ListenerTrace.Targets.Add({ Request.Service, Request.ListenerID, PointIndex, true });
+			if (ShareDistance > 0.f)
+				State.ListenerTraces.Add(Key, ListenerTraceIndex);
+			++NumTraces;
+		}
+	}
+	return NumTraces;
+}
@@ -19,6 +19,7 @@ AkOcclusionObstructionService.cpp:
 =============================================================================*/
 
 #include "OcclusionObstructionService/AkOcclusionObstructionService.h"
+#include "OcclusionObstructionService/AkOcclusionObstructionScheduler.h"
 #include "AkAudioDevice.h"
 #include "AkComponent.h"
 #include "AkSpatialAudioHelper.h"
@@ -87,9 +88,6 @@ FAkListenerOcclusionObstructionPair::FAkListenerOcclusionObstructionPair()
 {
 	SourceRayCollisions.AddZeroed(NUM_BOUNDING_BOX_TRACE_POINTS);
 	ListenerRayCollisions.AddZeroed(NUM_BOUNDING_BOX_TRACE_POINTS);
-
-	SourceTraceHandles.AddDefaulted(NUM_BOUNDING_BOX_TRACE_POINTS);
-	ListenerTraceHandles.AddDefaulted(NUM_BOUNDING_BOX_TRACE_POINTS);
 }
 
 bool FAkListenerOcclusionObstructionPair::Update(float DeltaTime)
@@ -119,23 +117,15 @@ bool FAkListenerOcclusionObstructionPair::ReachedTarget()
 	return Obs.ReachedTarget() && Occ.ReachedTarget();
 }
 
-void FAkListenerOcclusionObstructionPair::AsyncTraceFromSource(const FVector& SourcePosition, const FVector& EndPosition, int BoundingBoxPointIndex, ECollisionChannel CollisionChannel, UWorld* World, const FCollisionQueryParams& CollisionParams)
-{
-	ensure(BoundingBoxPointIndex < NUM_BOUNDING_BOX_TRACE_POINTS);
-	// Check that we're not stacking another async trace on top of one that hasn't completed yet.
-	if (!World->IsTraceHandleValid(SourceTraceHandles[BoundingBoxPointIndex], false))
-	{
-		SourceTraceHandles[BoundingBoxPointIndex] = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, SourcePosition, EndPosition, CollisionChannel, CollisionParams);
-	}
-}
-void FAkListenerOcclusionObstructionPair::AsyncTraceFromListener(const FVector& ListenerPosition, const FVector& EndPosition, int BoundingBoxPointIndex, ECollisionChannel CollisionChannel, UWorld* World, const FCollisionQueryParams& CollisionParams)
+void FAkListenerOcclusionObstructionPair::SetRayCollision(int BoundingBoxPointIndex, bool bFromListener, bool bCollision)
 {
-	ensure(BoundingBoxPointIndex < NUM_BOUNDING_BOX_TRACE_POINTS);
-	// Check that we're not stacking another async trace on top of one that hasn't completed yet.
-	if (!World->IsTraceHandleValid(ListenerTraceHandles[BoundingBoxPointIndex], false))
-	{
-		ListenerTraceHandles[BoundingBoxPointIndex] = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, ListenerPosition, EndPosition, CollisionChannel, CollisionParams);
-	}
+	if (!ensure(BoundingBoxPointIndex >= 0 && BoundingBoxPointIndex < NUM_BOUNDING_BOX_TRACE_POINTS))
+		return;
+
+	if (bFromListener)
+		ListenerRayCollisions[BoundingBoxPointIndex] = bCollision;
+	else
+		SourceRayCollisions[BoundingBoxPointIndex] = bCollision;
 }
 
 int FAkListenerOcclusionObstructionPair::GetCollisionCount()
@@ -148,48 +138,19 @@ int FAkListenerOcclusionObstructionPair::GetCollisionCount()
 	return CollisionCount;
 }
 
-void FAkListenerOcclusionObstructionPair::CheckTraceResults(UWorld* World)
-{
-	CheckListenerTraceHandles(World);
-	CheckSourceTraceHandles(World);
-}
-
-void FAkListenerOcclusionObstructionPair::CheckListenerTraceHandles(UWorld* World)
-{
-	for (int BoundingBoxPointIndex = 0; BoundingBoxPointIndex < NUM_BOUNDING_BOX_TRACE_POINTS; ++BoundingBoxPointIndex)
-	{
-		if (ListenerTraceHandles[BoundingBoxPointIndex]._Data.FrameNumber != 0)
-		{
-			FTraceDatum OutData;
-			if (World->QueryTraceData(ListenerTraceHandles[BoundingBoxPointIndex], OutData))
-			{
-				ListenerTraceHandles[BoundingBoxPointIndex]._Data.FrameNumber = 0;
-				ListenerRayCollisions[BoundingBoxPointIndex] = OutData.OutHits.Num() > 0;
-			}
-		}
-	}
-}
+//=====================================================================================
+// AkOcclusionObstructionService
+//=====================================================================================
 
-void FAkListenerOcclusionObstructionPair::CheckSourceTraceHandles(UWorld* World)
+AkOcclusionObstructionService::~AkOcclusionObstructionService()
 {
-	for (int BoundingBoxPointIndex = 0; BoundingBoxPointIndex < NUM_BOUNDING_BOX_TRACE_POINTS; ++BoundingBoxPointIndex)
+	if (bRegisteredWithScheduler)
 	{
-		if (SourceTraceHandles[BoundingBoxPointIndex]._Data.FrameNumber != 0)
-		{
-			FTraceDatum OutData;
-			if (World->QueryTraceData(SourceTraceHandles[BoundingBoxPointIndex], OutData))
-			{
-				SourceTraceHandles[BoundingBoxPointIndex]._Data.FrameNumber = 0;
-				SourceRayCollisions[BoundingBoxPointIndex] = OutData.OutHits.Num() > 0;
-			}
-		}
+		if (auto AudioDevice = FAkAudioDevice::Get())
+			AudioDevice->GetOcclusionObstructionScheduler().Unregister(this);
 	}
 }
 
-//=====================================================================================
-// AkOcclusionObstructionService
-//=====================================================================================
-
 void AkOcclusionObstructionService::_Init(UWorld* in_world, float in_refreshInterval)
 {
 	if (in_refreshInterval > 0 && in_world != nullptr)
@@ -216,7 +177,6 @@ void AkOcclusionObstructionService::RefreshObstructionOcclusion(const UAkCompone
 		}
 
 		FAkListenerOcclusionObstructionPair& ObsOccPair = It->Value;
-		ObsOccPair.CheckTraceResults(Actor->GetWorld());
 		if (ObsOccPair.Update(DeltaTime) && AudioDevice)
 		{
 			SetOcclusionObstruction(Listener, ObsOccPair.Obs.CurrentValue);
@@ -255,12 +215,107 @@ void AkOcclusionObstructionService::RefreshObstructionOcclusion(const UAkCompone
 				auto& MapEntry = ListenerInfoMap.FindOrAdd(Listener->GetAkGameObjectID());
 				MapEntry.Position = Listener->GetPosition();
 			}
-			CalculateObstructionOcclusionValues(in_Listeners, SourcePosition, Actor, RoomID, in_collisionChannel);
+			RequestObstructionOcclusionValues(in_Listeners, SourcePosition, Actor, RoomID, in_collisionChannel);
 		}
 	}
 }
 
-void AkOcclusionObstructionService::CalculateObstructionOcclusionValues(const UAkComponentSet& in_Listeners, const FVector& SourcePosition, const AActor* Actor, AkRoomID RoomID, ECollisionChannel in_collisionChannel, bool bAsync /* = true */)
+void AkOcclusionObstructionService::GetBoundingBoxTracePoints(const FHitResult& OutHit, FVector (&OutPoints)[NUM_BOUNDING_BOX_TRACE_POINTS], FBox* OutBoundingBox /* = nullptr */)
+{
+	FBox BoundingBox(ForceInit);
+	AActor* HitActor = AkSpatialAudioHelper::GetActorFromHitResult(OutHit);
+	if (HitActor)
+	{
+		BoundingBox = HitActor->GetComponentsBoundingBox();
+	}
+	else if (OutHit.Component.IsValid())
+	{
+		BoundingBox = OutHit.Component->Bounds.GetBox();
+	}
+
+	// Translate the impact point to the bounding box of the obstacle
+	OutPoints[0] = FVector(OutHit.ImpactPoint.X, BoundingBox.Min.Y, BoundingBox.Min.Z);
+	OutPoints[1] = FVector(OutHit.ImpactPoint.X, BoundingBox.Min.Y, BoundingBox.Max.Z);
+	OutPoints[2] = FVector(OutHit.ImpactPoint.X, BoundingBox.Max.Y, BoundingBox.Min.Z);
+	OutPoints[3] = FVector(OutHit.ImpactPoint.X, BoundingBox.Max.Y, BoundingBox.Max.Z);
+
+	OutPoints[4] = FVector(BoundingBox.Min.X, OutHit.ImpactPoint.Y, BoundingBox.Min.Z);
+	OutPoints[5] = FVector(BoundingBox.Min.X, OutHit.ImpactPoint.Y, BoundingBox.Max.Z);
+	OutPoints[6] = FVector(BoundingBox.Max.X, OutHit.ImpactPoint.Y, BoundingBox.Min.Z);
+	OutPoints[7] = FVector(BoundingBox.Max.X, OutHit.ImpactPoint.Y, BoundingBox.Max.Z);
+
+	OutPoints[8] = FVector(BoundingBox.Min.X, BoundingBox.Min.Y, OutHit.ImpactPoint.Z);
+	OutPoints[9] = FVector(BoundingBox.Min.X, BoundingBox.Max.Y, OutHit.ImpactPoint.Z);
+	OutPoints[10] = FVector(BoundingBox.Max.X, BoundingBox.Min.Y, OutHit.ImpactPoint.Z);
+	OutPoints[11] = FVector(BoundingBox.Max.X, BoundingBox.Max.Y, OutHit.ImpactPoint.Z);
+
+	if (OutBoundingBox)
+		*OutBoundingBox = BoundingBox;
+}
+
+void AkOcclusionObstructionService::RequestObstructionOcclusionValues(const UAkComponentSet& in_Listeners, const FVector& SourcePosition, const AActor* Actor, AkRoomID RoomID, ECollisionChannel in_collisionChannel)
+{
+	auto AudioDevice = FAkAudioDevice::Get();
+	auto CurrentWorld = Actor->GetWorld();
+	if (!AudioDevice || !CurrentWorld)
+		return;
+
+	const bool bAudible = IsAudible();
+	const float AudibleRadius = GetAudibleRadius();
+
+	for (auto& Listener : in_Listeners)
+	{
+		if (RoomID != Listener->GetSpatialAudioRoom())
+			continue;
+
+		auto MapEntry = ListenerInfoMap.Find(Listener->GetAkGameObjectID());
+		if (MapEntry == nullptr || MapEntry->bRefreshPending)
+			continue;
+
+		// Audible sources come first, then the closest ones to the listener.
+		const float Distance = FVector::Dist(SourcePosition, MapEntry->Position);
+		const float Proximity = AudibleRadius > 0.0f ? 1.0f - FMath::Min(Distance / AudibleRadius, 1.0f) : 1.0f / (1.0f + Distance / 1000.0f);
+
+		FAkOcclusionObstructionScheduler::FRequest Request;
+		Request.Service = this;
+		Request.ListenerID = Listener->GetAkGameObjectID();
+		Request.SourcePosition = SourcePosition;
+		Request.ListenerPosition = MapEntry->Position;
+		Request.Actor = Actor;
+		Request.CollisionChannel = in_collisionChannel;
+		Request.Priority = (bAudible ? 1.0f : 0.0f) + Proximity;
+
+		AudioDevice->GetOcclusionObstructionScheduler().RequestRefresh(CurrentWorld, Request);
+		MapEntry->bRefreshPending = true;
+		bRegisteredWithScheduler = true;
+	}
+}
+
+void AkOcclusionObstructionService::OnRefreshServed(AkGameObjectID ListenerID, bool bDirectPathOccluded)
+{
+	auto MapEntry = ListenerInfoMap.Find(ListenerID);
+	if (MapEntry == nullptr)
+		return;
+
+	MapEntry->bRefreshPending = false;
+	if (!bDirectPathOccluded)
+	{
+		MapEntry->Occ.SetTarget(0.0f);
+		MapEntry->Obs.SetTarget(0.0f);
+		MapEntry->Reset();
+	}
+}
+
+void AkOcclusionObstructionService::OnRayCollision(AkGameObjectID ListenerID, int BoundingBoxPointIndex, bool bFromListener, bool bCollision)
+{
+	auto MapEntry = ListenerInfoMap.Find(ListenerID);
+	if (MapEntry == nullptr)
+		return;
+
+	MapEntry->SetRayCollision(BoundingBoxPointIndex, bFromListener, bCollision);
+}
+
+void AkOcclusionObstructionService::CalculateObstructionOcclusionValues(const UAkComponentSet& in_Listeners, const FVector& SourcePosition, const AActor* Actor, AkRoomID RoomID, ECollisionChannel in_collisionChannel)
 {
 	auto CurrentWorld = Actor->GetWorld();
 	if (!CurrentWorld)
@@ -289,59 +344,22 @@ void AkOcclusionObstructionService::CalculateObstructionOcclusionValues(const UA
 		if (bNowOccluded)
 		{
 			FBox BoundingBox;
-			AActor* HitActor = AkSpatialAudioHelper::GetActorFromHitResult(OutHit);
-			if (HitActor)
-			{
-				BoundingBox = HitActor->GetComponentsBoundingBox();
-			}
-			else if (OutHit.Component.IsValid())
-			{
-				BoundingBox = OutHit.Component->Bounds.GetBox();
-			}
-			// Translate the impact point to the bounding box of the obstacle
-			const FVector Points[] =
-			{
-				FVector(OutHit.ImpactPoint.X, BoundingBox.Min.Y, BoundingBox.Min.Z),
-				FVector(OutHit.ImpactPoint.X, BoundingBox.Min.Y, BoundingBox.Max.Z),
-				FVector(OutHit.ImpactPoint.X, BoundingBox.Max.Y, BoundingBox.Min.Z),
-				FVector(OutHit.ImpactPoint.X, BoundingBox.Max.Y, BoundingBox.Max.Z),
-
-				FVector(BoundingBox.Min.X, OutHit.ImpactPoint.Y, BoundingBox.Min.Z),
-				FVector(BoundingBox.Min.X, OutHit.ImpactPoint.Y, BoundingBox.Max.Z),
-				FVector(BoundingBox.Max.X, OutHit.ImpactPoint.Y, BoundingBox.Min.Z),
-				FVector(BoundingBox.Max.X, OutHit.ImpactPoint.Y, BoundingBox.Max.Z),
-
-				FVector(BoundingBox.Min.X, BoundingBox.Min.Y, OutHit.ImpactPoint.Z),
-				FVector(BoundingBox.Min.X, BoundingBox.Max.Y, OutHit.ImpactPoint.Z),
-				FVector(BoundingBox.Max.X, BoundingBox.Min.Y, OutHit.ImpactPoint.Z),
-				FVector(BoundingBox.Max.X, BoundingBox.Max.Y, OutHit.ImpactPoint.Z)
-			};
-
-			if (bAsync)
-			{
-				for (int PointIndex = 0; PointIndex < NUM_BOUNDING_BOX_TRACE_POINTS; ++PointIndex)
-				{
-					auto Point = Points[PointIndex];
-					MapEntry->AsyncTraceFromListener(ListenerPosition, Point, PointIndex, in_collisionChannel, CurrentWorld, CollisionParams);
-					MapEntry->AsyncTraceFromSource(SourcePosition, Point, PointIndex, in_collisionChannel, CurrentWorld, CollisionParams);
-				}
-			}
-			else
+			FVector Points[NUM_BOUNDING_BOX_TRACE_POINTS];
+			GetBoundingBoxTracePoints(OutHit, Points, &BoundingBox);
+
+			// Compute the number of "second order paths" that are also obstructed. This will allow us to approximate
+			// "how obstructed" the source is.
+			int32 NumObstructedPaths = 0;
+			for (const auto& Point : Points)
 			{
-				// Compute the number of "second order paths" that are also obstructed. This will allow us to approximate
-				// "how obstructed" the source is.
-				int32 NumObstructedPaths = 0;
-				for (const auto& Point : Points)
-				{
-					if (CurrentWorld->LineTraceSingleByChannel(OutHit, ListenerPosition, Point, in_collisionChannel, CollisionParams) ||
-						CurrentWorld->LineTraceSingleByChannel(OutHit, SourcePosition, Point, in_collisionChannel, CollisionParams))
-						++NumObstructedPaths;
-				}
-				// Modulate occlusion by blocked secondary paths. 
-				const float ratio = (float)NumObstructedPaths / NUM_BOUNDING_BOX_TRACE_POINTS;
-				MapEntry->Occ.SetTarget(ratio);
-				MapEntry->Obs.SetTarget(ratio);
+				if (CurrentWorld->LineTraceSingleByChannel(OutHit, ListenerPosition, Point, in_collisionChannel, CollisionParams) ||
+					CurrentWorld->LineTraceSingleByChannel(OutHit, SourcePosition, Point, in_collisionChannel, CollisionParams))
+					++NumObstructedPaths;
 			}
+			// Modulate occlusion by blocked secondary paths. 
+			const float ratio = (float)NumObstructedPaths / NUM_BOUNDING_BOX_TRACE_POINTS;
+			MapEntry->Occ.SetTarget(ratio);
+			MapEntry->Obs.SetTarget(ratio);
 
 #if AK_DEBUG_OCCLUSION
 			check(IsInGameThread());
@@ -438,7 +456,7 @@ void AkOcclusionObstructionService::UpdateObstructionOcclusion(const UAkComponen
 			auto& MapEntry = ListenerInfoMap.FindOrAdd(Listener->GetAkGameObjectID());
 			MapEntry.Position = Listener->GetPosition();
 		}
-		CalculateObstructionOcclusionValues(in_Listeners, SourcePosition, Actor, RoomID, in_collisionChannel, false);
+		CalculateObstructionOcclusionValues(in_Listeners, SourcePosition, Actor, RoomID, in_collisionChannel);
 		for (auto& ListenerPair : ListenerInfoMap)
 		{
 			ListenerPair.Value.Obs.CurrentValue = ListenerPair.Value.Obs.TargetValue;
@@ -29,6 +29,7 @@ Copyright (c) 2021 Audiokinetic Inc.
 #include "AkGroupValue.h"
 #include "AkInclude.h"
 #include "AkJobWorkerScheduler.h"
+#include "OcclusionObstructionService/AkOcclusionObstructionScheduler.h"
 #include "Wwise/WwiseSharedLanguageId.h"
 #include "Engine/StreamableManager.h"
 #include "Engine/EngineTypes.h"
@@ -1360,6 +1361,12 @@ public:
 	 */
 	void UnregisterComponent(UAkComponent * in_pComponent);
 
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnAkComponentRegistration, UAkComponent*);
+	/** Broadcast when an AkComponent is registered with the sound engine */
+	FOnAkComponentRegistration OnAkComponentRegistered;
+	/** Broadcast when an AkComponent is unregistered from the sound engine */
+	FOnAkComponentRegistration OnAkComponentUnregistered;
+
 	/**
 	 * Unregister an ak game object with ak sound engine
 	 *
@@ -1387,6 +1394,23 @@ public:
 	*/
 	AKRESULT RemoveGeometryInstance(AkGeometryInstanceID GeometryInstanceID);
 
+	/**
+	* Add a reference to the shared geometry set sent with the given content hash, if any.
+	* Returns false when no geometry with this hash has been sent yet; see AddSharedGeometrySet.
+	*/
+	bool AcquireSharedGeometrySet(uint64 GeometryHash, AkGeometrySetID& OutGeometrySetID);
+
+	/**
+	* Send a set of triangles that is shared by every caller sending geometry with the same content hash.
+	* The new set starts with a single reference.
+	*/
+	AKRESULT AddSharedGeometrySet(uint64 GeometryHash, const AkGeometryParams& Params, AkGeometrySetID& OutGeometrySetID);
+
+	/**
+	* Release a reference to a shared geometry set. The set is removed from Spatial Audio with its last reference.
+	*/
+	void ReleaseSharedGeometrySet(uint64 GeometryHash);
+
 	/**
 	* Set the early reflections aux bus for an AK Component
 	*/
@@ -1642,6 +1666,12 @@ public:
 		out_AkTransform.Set(FVectorToAKVector64(in_Position), FVectorToAKVector(in_Front), FVectorToAKVector(in_Up));
 	}
 
+	/**
+	 * FVectorsToAKWorldTransform for structure-of-arrays inputs, all of the same size as out_AkTransforms.
+	 * Front and up vectors are converted to float in one pass over flat arrays, then every transform is Set. Positions stay 64-bit.
+	 */
+	static void FVectorsToAKWorldTransforms(TArrayView<const FVector> in_Positions, TArrayView<const FVector> in_Fronts, TArrayView<const FVector> in_Ups, TArrayView<AkWorldTransform> out_AkTransforms);
+
 	static inline void AKVectorToFVector(const AkVector & in_vect, FVector & out_vect)
 	{
 		out_vect.X = in_vect.X;
@@ -1706,6 +1736,29 @@ public:
 	/** Find UAkRoomComponents at a given location. */
 	TArray<class UAkRoomComponent*> FindRoomComponentsAtLocation(const FVector& Loc, const UWorld* World);
 
+	/**
+	 * Queue the room and late reverb lookup of an AkComponent that moved.
+	 * All the queued components are resolved in a single batch on the next Update, before rendering audio.
+	 *
+	 * @param Component			The AkComponent to update
+	 * @param RoomLocation		The location used to find the Spatial Audio room of the component
+	 * @param ReverbLocation	The location used to find the late reverb components of the component
+	 */
+	void QueueEnvironmentUpdate(UAkComponent* Component, const FVector& RoomLocation, const FVector& ReverbLocation);
+
+	/**
+	 * Queue the position update of an AkComponent that moved. A component moving several times in a frame is queued once.
+	 * All the queued positions are gathered, converted and sent to Wwise in a single pass at the end of the world tick, and before rendering audio.
+	 * The rooms and late reverbs of the components that moved are then queued with QueueEnvironmentUpdate.
+	 *
+	 * @param Component			The AkComponent to update
+	 * @param bForce			Send the position even if the component didn't move past its PositionUpdateThreshold
+	 */
+	void QueuePositionUpdate(UAkComponent* Component, bool bForce = false);
+
+	/** Send the queued position update of an AkComponent right away, e.g. before posting an event on it. */
+	void FlushQueuedPositionUpdate(UAkComponent* Component);
+
 	/** Return true if any UAkRoomComponents have been added to the prioritized list of rooms for the in_World**/
 	bool UsingSpatialAudioRooms(const UWorld* World);
 
@@ -1771,6 +1824,8 @@ public:
 	static void GetChannelConfig(FAkChannelMask SpeakerConfiguration, AkChannelConfig& config);
 
 	FAkEnvironmentIndex& GetRoomIndex() { return RoomIndex; }
+	FAkEnvironmentIndex& GetLateReverbIndex() { return LateReverbIndex; }
+	FAkOcclusionObstructionScheduler& GetOcclusionObstructionScheduler() { return OcclusionObstructionScheduler; }
 
 	friend class UAkInitBank;
 	struct SetCurrentAudioCultureAsyncTask
@@ -1873,6 +1928,73 @@ private:
 	 */
 	FAkEnvironmentIndex RoomIndex;
 
+	/** Issues the occlusion and obstruction traces of all the AkComponents and portals, within a per-frame budget. */
+	FAkOcclusionObstructionScheduler OcclusionObstructionScheduler;
+
+	/** Geometry sets shared by all the components sending identical geometry, keyed by content hash. Game thread only. */
+	struct FSharedGeometrySet
+	{
+		AkGeometrySetID GeometrySetID;
+		int32 RefCount = 0;
+	};
+	TMap<uint64, FSharedGeometrySet> SharedGeometrySets;
+	/** Shared set IDs have their high bit set, so they never clash with the component-address IDs of unshared sets. */
+	uint64 NextSharedGeometrySetID = 1ull << 63;
+
+	/** AkComponents that moved since the last Update, with the locations to look up. See QueueEnvironmentUpdate. */
+	struct FQueuedEnvironmentUpdate
+	{
+		TWeakObjectPtr<UAkComponent> Component;
+		FVector RoomLocation;
+		FVector ReverbLocation;
+	};
+	TArray<FQueuedEnvironmentUpdate> QueuedEnvironmentUpdates;
+
+	/** Updates being processed, swapped with QueuedEnvironmentUpdates at the start of UpdateQueuedEnvironments. */
+	TArray<FQueuedEnvironmentUpdate> ProcessedEnvironmentUpdates;
+
+	/** Scratch buffers of UpdateQueuedEnvironments, kept between frames to avoid allocating. */
+	struct FEnvironmentUpdateBuffers
+	{
+		TArray<UAkComponent*> Components;
+		TArray<FVector> RoomLocations;
+		TArray<FVector> ReverbLocations;
+		TArray<class UAkRoomComponent*> Rooms;
+		TArray<int32> RoomOffsets;
+		TArray<class UAkLateReverbComponent*> LateReverbs;
+		TArray<int32> LateReverbOffsets;
+	};
+	FEnvironmentUpdateBuffers EnvironmentUpdateBuffers;
+
+	/** Resolves the rooms and late reverbs of all queued AkComponents, batched per world. */
+	void UpdateQueuedEnvironments();
+
+	/** AkComponents that moved since the last batch of position updates. See QueuePositionUpdate. */
+	struct FQueuedPositionUpdate
+	{
+		TWeakObjectPtr<UAkComponent> Component;
+		bool bForce;
+	};
+	TArray<FQueuedPositionUpdate> QueuedPositionUpdates;
+
+	/** Updates being submitted, swapped with QueuedPositionUpdates so components can queue themselves while they are submitted. */
+	TArray<FQueuedPositionUpdate> SubmittedPositionUpdates;
+
+	/** Scratch buffers of SubmitPositionUpdates, kept between frames to avoid allocating. */
+	struct FPositionUpdateBuffers
+	{
+		TArray<UAkComponent*> Components;
+		TArray<FVector> Locations;
+		TArray<FVector> Fronts;
+		TArray<FVector> Ups;
+		TArray<AkSoundPosition> SoundPositions;
+	};
+	FPositionUpdateBuffers PositionUpdateBuffers;
+
+	/** Sends the positions of all queued AkComponents to Wwise. */
+	void UpdateQueuedPositions();
+	void SubmitPositionUpdates(TArrayView<const FQueuedPositionUpdate> Updates);
+
 	/** We keep track of the portals in each world so their rooms can be updated when room and portal parameters change.
 	*/
 	TMap<UWorld*, TArray<class UAkPortalComponent*>> WorldPortalsMap;
@@ -60,9 +60,11 @@ public:
 	FAkAudioDevice * GetAkAudioDevice();
 #if WITH_EDITOR
 	void AssetReloadPrompt();
+	void AssetRefsReloadPrompt(const TSet<FGuid>& InUpdatedGuids);
 	void OpenAssetReloadPopup();
 	void ReloadWwiseAssetDataAsync();
 	void ReloadWwiseAssetData();
+	void ReloadWwiseAssetData(const TSet<FGuid>& InUpdatedGuids);
 #endif
 
 	void UpdateWwiseResourceLoaderSettings() const;
@@ -87,6 +89,7 @@ private:
 	/** Handle for OnTick. */
 	FTickerDelegateHandle TickDelegateHandle;
 	FDelegateHandle OnDatabaseUpdateCompleteHandle;
+	FDelegateHandle OnDatabaseRefsUpdatedHandle;
 
 #if WITH_EDITOR
 	SReloadPopup ReloadPopup = SReloadPopup();
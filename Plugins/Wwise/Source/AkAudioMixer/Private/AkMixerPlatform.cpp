@@ -20,6 +20,7 @@ Copyright (c) 2021 Audiokinetic Inc.
 #include "UObject/UObjectGlobals.h"
 
 #include "AkSettings.h"
+#include "AkAudioBufferUtils.h"
 #include "AudioMixerInputComponent.h"
 
 #if WITH_ENGINE
@@ -66,10 +67,13 @@ bool FAkMixerPlatform::OnNextBuffer(uint32 NumChannels, uint32 NumSamples, float
 
 	checkf(OutputBufferByteLength == NumChannels * NumSamples * sizeof(float), TEXT("Please ensure the Wwise \"Samples per frame\" initialization setting matches the Unreal Audio \"Callback Buffer Size\" setting for the current platform."));
 
-	OutputBuffer = OutBufferToFill;
+	// ReadNextBuffer calls SubmitBuffer synchronously: no other thread consumes the buffer, so publishing the pointer is enough.
+	OutputBuffer.store(OutBufferToFill, std::memory_order_release);
 
 	ReadNextBuffer();
 
+	OutputBuffer.store(nullptr, std::memory_order_release);
+
 	return true;
 }
 
@@ -225,18 +229,14 @@ bool FAkMixerPlatform::CloseAudioStream()
 		return false;
 	}
 
+	if (this->AkAudioMixerInputComponent)
 	{
-		FScopeLock ScopedLock(&OutputBufferMutex);
-
-		if (this->AkAudioMixerInputComponent)
-		{
-			AkAudioMixerInputComponent->PostUnregisterGameObject();
-		}
-
-		OutputBuffer = nullptr;
-		OutputBufferByteLength = 0;
+		AkAudioMixerInputComponent->PostUnregisterGameObject();
 	}
 
+	OutputBuffer.store(nullptr, std::memory_order_release);
+	OutputBufferByteLength = 0;
+
 	bIsDeviceOpen = false;
 
 	if (bIsUsingNullDevice)
@@ -290,19 +290,10 @@ Audio::FAudioPlatformDeviceInfo FAkMixerPlatform::GetPlatformDeviceInfo() const
 
 void FAkMixerPlatform::SubmitBuffer(const uint8* Buffer)
 {
-	FScopeLock ScopedLock(&OutputBufferMutex);
-
-	if (OutputBuffer)
+	float** Planar = OutputBuffer.load(std::memory_order_acquire);
+	if (Planar)
 	{
-		for (int32 Channel = 0; Channel < AudioStreamInfo.DeviceInfo.NumChannels; Channel++)
-		{
-			for (int32 Frame = 0; Frame < AudioStreamInfo.NumOutputFrames; Frame++)
-			{
-				FMemory::Memcpy(&OutputBuffer[Channel][Frame],
-					&Buffer[sizeof(float) * ((AudioStreamInfo.DeviceInfo.NumChannels * Frame) + Channel)],
-					sizeof(float));
-			}
-		}
+		AkAudioBufferUtils::Deinterleave(reinterpret_cast<const float*>(Buffer), Planar, AudioStreamInfo.DeviceInfo.NumChannels, AudioStreamInfo.NumOutputFrames);
 	}
 }
 
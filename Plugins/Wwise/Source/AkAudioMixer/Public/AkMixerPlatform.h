@@ -18,6 +18,8 @@ Copyright (c) 2021 Audiokinetic Inc.
 #include "AudioMixer.h"
 #include "AkUEFeatures.h"
 
+#include <atomic>
+
 class FAudioMixerInputComponent;
 class UAkAudioEvent;
 
@@ -59,9 +61,10 @@ private:
 	bool bIsDeviceOpen;
 	bool bIsUsingNullDevice;
 	UAkAudioEvent* InputEvent;
-	float** OutputBuffer;
+
+	/** Planar buffer of the Wwise audio input callback, published by OnNextBuffer for the SubmitBuffer it triggers on the same thread. */
+	std::atomic<float**> OutputBuffer;
 	int OutputBufferByteLength;
-	FCriticalSection OutputBufferMutex;
 
 	bool OnNextBuffer(uint32 NumChannels, uint32 NumSamples, float** OutBufferToFill);
 	int32 GetAudioStreamChannelSize() { return sizeof(float); }
@@ -69,6 +69,13 @@ SWwisePicker::SWwisePicker(): CommandList(MakeShared<FUICommandList>())
 			this->ForceRefresh();
 		});
 	});
+	OnDatabaseRefsUpdatedHandle = FWwiseProjectDatabaseDelegates::Get().GetOnDatabaseRefsUpdatedDelegate().AddLambda([this](const TSet<FGuid>&)
+	{
+		AsyncTask(ENamedThreads::Type::GameThread, [this]
+		{
+			this->ForceRefresh();
+		});
+	});
 }
 
 void SWwisePicker::CreateWwisePickerCommands()
@@ -105,6 +112,11 @@ SWwisePicker::~SWwisePicker()
 		FWwiseProjectDatabaseDelegates::Get().GetOnDatabaseUpdateCompletedDelegate().Remove(OnDatabaseUpdateCompleteHandle);
 		OnDatabaseUpdateCompleteHandle.Reset();
 	}
+	if (OnDatabaseRefsUpdatedHandle.IsValid())
+	{
+		FWwiseProjectDatabaseDelegates::Get().GetOnDatabaseRefsUpdatedDelegate().Remove(OnDatabaseRefsUpdatedHandle);
+		OnDatabaseRefsUpdatedHandle.Reset();
+	}
 	RootItems.Empty();
 }
 
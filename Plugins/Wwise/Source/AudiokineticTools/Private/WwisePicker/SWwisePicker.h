@@ -146,4 +146,5 @@ private:
 
 	TUniquePtr<FWwisePickerDataLoader> DataLoader;
 	FDelegateHandle OnDatabaseUpdateCompleteHandle;
+	FDelegateHandle OnDatabaseRefsUpdatedHandle;
 };
\ No newline at end of file
@@ -39,10 +39,14 @@ DEFINE_STAT(STAT_WwiseFileHandlerOpenedStreams);
 DEFINE_STAT(STAT_WwiseFileHandlerPendingRequests);
 DEFINE_STAT(STAT_WwiseFileHandlerTotalRequests);
 DEFINE_STAT(STAT_WwiseFileHandlerTotalStreamedMB);
+DEFINE_STAT(STAT_WwiseFileHandlerPendingStreamingReads);
+DEFINE_STAT(STAT_WwiseFileHandlerStreamingDeadlineMisses);
 
 DEFINE_STAT(STAT_WwiseFileHandlerIORequestLatency); 
 DEFINE_STAT(STAT_WwiseFileHandlerFileOperationLatency);
 DEFINE_STAT(STAT_WwiseFileHandlerSoundEngineCallbackLatency);
 
+TAtomic<uint64> FWwiseFileHandlerCounters::TotalStreamedBytes(0);
+TAtomic<uint32> FWwiseFileHandlerCounters::StreamingDeadlineMisses(0);
 
 DEFINE_LOG_CATEGORY(LogWwiseFileHandler);
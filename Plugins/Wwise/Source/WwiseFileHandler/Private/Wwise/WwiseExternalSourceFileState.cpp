@@ -76,7 +76,15 @@ void FWwiseInMemoryExternalSourceFileState::OpenFile(FOpenFileCallback&& InCallb
 
 	const auto FullPathName = RootPath / MediaPathName;
 	int64 FileSize = 0;
-	if (LIKELY(GetFileToPtr(const_cast<const uint8*&>(reinterpret_cast<uint8*&>(pInMemory)), FileSize, FullPathName, bDeviceMemory, MemoryAlignment, true)))
+	if (GetMemoryMappedMedia(MappedHandle, MappedRegion, Ptr, FileSize, FullPathName, bDeviceMemory, MemoryAlignment))
+	{
+		UE_LOG(LogWwiseFileHandler, Verbose, TEXT("External Source %" PRIu32 " (%s): Loading Memory Mapped In-Memory Media."), MediaId, *MediaPathName);
+		pInMemory = const_cast<uint8*>(Ptr);
+		uiMemorySize = FileSize;
+		INC_DWORD_STAT(STAT_WwiseFileHandlerOpenedExternalSourceMedia);
+		OpenFileSucceeded(MoveTemp(InCallback));
+	}
+	else if (LIKELY(GetFileToPtr(const_cast<const uint8*&>(reinterpret_cast<uint8*&>(pInMemory)), FileSize, FullPathName, bDeviceMemory, MemoryAlignment, true)))
 	{
 		UE_LOG(LogWwiseFileHandler, Verbose, TEXT("External Source %" PRIu32 " (%s): Loading In-Memory Media."), MediaId, *MediaPathName);
 		uiMemorySize = FileSize;
@@ -105,7 +113,19 @@ void FWwiseInMemoryExternalSourceFileState::UnloadFromSoundEngine(FUnloadFromSou
 void FWwiseInMemoryExternalSourceFileState::CloseFile(FCloseFileCallback&& InCallback)
 {
 	UE_LOG(LogWwiseFileHandler, Verbose, TEXT("External Source %" PRIu32 " (%s): Closing In-Memory Media."), MediaId, *MediaPathName);
-	DeallocateMemory(const_cast<const uint8*&>(reinterpret_cast<uint8*&>(pInMemory)), uiMemorySize, bDeviceMemory, MemoryAlignment, true);
+	if (MappedHandle)
+	{
+		UnmapRegion(*MappedRegion);
+		UnmapHandle(*MappedHandle);
+
+		MappedRegion = nullptr;
+		MappedHandle = nullptr;
+	}
+	else
+	{
+		DeallocateMemory(const_cast<const uint8*&>(reinterpret_cast<uint8*&>(pInMemory)), uiMemorySize, bDeviceMemory, MemoryAlignment, true);
+	}
+	Ptr = nullptr;
 	pInMemory = nullptr;
 	uiMemorySize = 0;
 	DEC_DWORD_STAT(STAT_WwiseFileHandlerOpenedExternalSourceMedia);
@@ -14,6 +14,7 @@ Copyright (c) 2022 Audiokinetic Inc.
 *******************************************************************************/
 
 #include "Wwise/WwiseFileStateTools.h"
+#include "Wwise/WwiseStreamingReadScheduler.h"
 #include "Wwise/Stats/AsyncStats.h"
 #include "Wwise/Stats/FileHandler.h"
 
@@ -141,6 +142,49 @@ void FWwiseFileStateTools::UnmapHandle(IMappedFileHandle& InMappedHandle)
 	delete &InMappedHandle;
 }
 
+bool FWwiseFileStateTools::GetMemoryMappedMedia(IMappedFileHandle*& OutMappedHandle, IMappedFileRegion*& OutMappedRegion, const uint8*& OutPtr, int64& OutSize,
+	const FString& InFilePathname, bool bInDeviceMemory, int32 InMemoryAlignment)
+{
+#if WITH_EDITOR
+	// Media stays mapped for as long as it's loaded, which would prevent the SoundBanks from being regenerated.
+	return false;
+#else
+	if (bInDeviceMemory)
+	{
+		return false;
+	}
+
+	IMappedFileHandle* Handle = nullptr;
+	int64 Size = 0;
+	if (!GetMemoryMapped(Handle, Size, InFilePathname, InMemoryAlignment))
+	{
+		return false;
+	}
+
+	IMappedFileRegion* Region = nullptr;
+	if (UNLIKELY(!GetMemoryMappedRegion(Region, *Handle)))
+	{
+		UnmapHandle(*Handle);
+		return false;
+	}
+
+	const uint8* Ptr = Region->GetMappedPtr();
+	if (InMemoryAlignment > 0 && !IsAligned(Ptr, InMemoryAlignment))
+	{
+		UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("Memory mapped %s is not aligned on %" PRIi32 " bytes. Not using mapping."), *InFilePathname, InMemoryAlignment);
+		UnmapRegion(*Region);
+		UnmapHandle(*Handle);
+		return false;
+	}
+
+	OutMappedHandle = Handle;
+	OutMappedRegion = Region;
+	OutPtr = Ptr;
+	OutSize = Region->GetMappedSize();
+	return true;
+#endif
+}
+
 bool FWwiseFileStateTools::GetFileToPtr(const uint8*& OutPtr, int64& OutSize, const FString& InFilePathname,
 	bool bInDeviceMemory, int32 InMemoryAlignment, bool bInEnforceMemoryRequirements)
 {
@@ -216,6 +260,7 @@ bool FWwiseFileStateTools::Read(FArchive& InArchive, uint8* OutBuffer, int64 InP
 	{
 		ASYNC_INC_FLOAT_STAT_BY(STAT_WwiseFileHandlerTotalStreamedMB, static_cast<float>(InSize) / 1024 / 1024);
 		ASYNC_INC_FLOAT_STAT_BY(STAT_WwiseFileHandlerStreamingKB, static_cast<float>(InSize) / 1024);
+		FWwiseFileHandlerCounters::TotalStreamedBytes += InSize;
 	}
 	return !bError;
 }
@@ -224,10 +269,10 @@ void FWwiseFileStateTools::AsyncRead(FArchive& InArchive, FWwiseExecutionQueue::
                                      uint8* OutBuffer, int64 InPosition, uint32 InSize,
                                      FTimespan InDeadline, AkPriority InPriority)
 {
-	FileStateExecutionQueue.Async(MoveTemp(InCallback), [&InArchive, OutBuffer, InPosition, InSize, InPriority](FTimespan InDeadline)
+	FWwiseStreamingReadScheduler::Get().Schedule(InArchive, MoveTemp(InCallback), [&InArchive, OutBuffer, InPosition, InSize]
 	{
-		return Read(InArchive, OutBuffer, InPosition, InSize) ? FWwiseExecutionQueue::ETimedResult::Success : FWwiseExecutionQueue::ETimedResult::Failure;
-	}, InDeadline);
+		return Read(InArchive, OutBuffer, InPosition, InSize);
+	}, InDeadline, InPriority);
 }
 
 void FWwiseFileStateTools::AsyncRead(FArchive& InArchive, const TCHAR* InAssetType, uint32 InAssetId, const TCHAR* InAssetName, const AkIoHeuristics& InHeuristics, AkAsyncIOTransferInfo& OutTransferInfo, TFileOpDoneCallback&& InFileOpDoneCallback)
@@ -260,7 +305,7 @@ void FWwiseFileStateTools::AsyncRead(FArchive& InArchive, const TCHAR* InAssetTy
 		{
 			Result = AK_Success;
 			const auto DeadlineUS = static_cast<int>((Deadline - StartTime).GetTotalMicroseconds());
-			UE_LOG(LogWwiseFileHandler, Error, TEXT("AsyncRead: Timed out reading %s %" PRIu32 " (%s) in %dus: Timed out at %dus"), InAssetName, InAssetId, InAssetName, DeadlineUS, TimeSpan);
+			UE_LOG(LogWwiseFileHandler, Log, TEXT("AsyncRead: Missed deadline reading %s %" PRIu32 " (%s): Deadline was %dus, took %dus"), InAssetType, InAssetId, InAssetName, DeadlineUS, TimeSpan);
 		}
 		else // if (InResult == FWwiseExecutionQueue::ETimedResult::Failure)
 		{
@@ -274,16 +319,29 @@ void FWwiseFileStateTools::AsyncRead(FArchive& InArchive, const TCHAR* InAssetTy
 
 void FWwiseFileStateTools::AsyncClose(FArchive* InArchive, FWwiseExecutionQueue::FBasicFunction&& InCallback)
 {
-	if (LIKELY(InArchive)) FileStateExecutionQueue.Async([InArchive, InCallback = MoveTemp(InCallback)] {
-		UE_LOG(LogWwiseFileHandler, Verbose, TEXT("Closing archive for file %s."), *InArchive->GetArchiveName());
-		if (LIKELY(InArchive->Close()))
-		{
-			delete InArchive;
-		}
-		else
-		{
-			UE_LOG(LogWwiseFileHandler, Log, TEXT("Unable to close Archive for file %s. Leaking."), *InArchive->GetArchiveName());
-		}
-		InCallback();
-	});
+	if (UNLIKELY(!InArchive))
+	{
+		return;
+	}
+
+	// Reads are processed by the streaming scheduler. Go through it first, after every read on this archive, so
+	// the archive is not deleted while a worker is still using it.
+	FWwiseStreamingReadScheduler::Get().Schedule(*InArchive, [this, InArchive, InCallback = MoveTemp(InCallback)](FWwiseExecutionQueue::ETimedResult) mutable
+	{
+		FileStateExecutionQueue.Async([InArchive, InCallback = MoveTemp(InCallback)] {
+			UE_LOG(LogWwiseFileHandler, Verbose, TEXT("Closing archive for file %s."), *InArchive->GetArchiveName());
+			if (LIKELY(InArchive->Close()))
+			{
+				delete InArchive;
+			}
+			else
+			{
+				UE_LOG(LogWwiseFileHandler, Log, TEXT("Unable to close Archive for file %s. Leaking."), *InArchive->GetArchiveName());
+			}
+			InCallback();
+		});
+	}, []
+	{
+		return true;
+	}, FWwiseExecutionQueue::NoTimeLimit(), AK_MIN_PRIORITY);
 }
@@ -30,7 +30,9 @@ FWwiseMediaFileState::FWwiseMediaFileState(const FWwiseMediaCookedData& InCooked
 }
 
 FWwiseInMemoryMediaFileState::FWwiseInMemoryMediaFileState(const FWwiseMediaCookedData& InCookedData, const FString& InRootPath) :
-	FWwiseMediaFileState(InCookedData, InRootPath)
+	FWwiseMediaFileState(InCookedData, InRootPath),
+	MappedHandle(nullptr),
+	MappedRegion(nullptr)
 {
 	pMediaMemory = nullptr;
 	sourceID = MediaId;
@@ -49,7 +51,14 @@ void FWwiseInMemoryMediaFileState::OpenFile(FOpenFileCallback&& InCallback)
 	const auto FullPathName = RootPath / MediaPathName;
 
 	int64 FileSize = 0;
-	if (LIKELY(GetFileToPtr(const_cast<const uint8*&>(pMediaMemory), FileSize, FullPathName, bDeviceMemory, MemoryAlignment, true)))
+	if (GetMemoryMappedMedia(MappedHandle, MappedRegion, const_cast<const uint8*&>(pMediaMemory), FileSize, FullPathName, bDeviceMemory, MemoryAlignment))
+	{
+		UE_LOG(LogWwiseFileHandler, Verbose, TEXT("Media %" PRIu32 " (%s): Loading Memory Mapped In-Memory Media."), MediaId, *DebugName);
+		uMediaSize = FileSize;
+		INC_DWORD_STAT(STAT_WwiseFileHandlerOpenedMedia);
+		OpenFileSucceeded(MoveTemp(InCallback));
+	}
+	else if (LIKELY(GetFileToPtr(const_cast<const uint8*&>(pMediaMemory), FileSize, FullPathName, bDeviceMemory, MemoryAlignment, true)))
 	{
 		UE_LOG(LogWwiseFileHandler, Verbose, TEXT("Media %" PRIu32 " (%s): Loading In-Memory Media."), MediaId, *DebugName);
 		uMediaSize = FileSize;
@@ -118,7 +127,18 @@ void FWwiseInMemoryMediaFileState::UnloadFromSoundEngine(FUnloadFromSoundEngineC
 void FWwiseInMemoryMediaFileState::CloseFile(FCloseFileCallback&& InCallback)
 {
 	UE_LOG(LogWwiseFileHandler, Verbose, TEXT("Media %" PRIu32 " (%s): Closing In-Memory Media."), MediaId, *DebugName);
-	DeallocateMemory(pMediaMemory, uMediaSize, bDeviceMemory, MemoryAlignment, true);
+	if (MappedHandle)
+	{
+		UnmapRegion(*MappedRegion);
+		UnmapHandle(*MappedHandle);
+
+		MappedRegion = nullptr;
+		MappedHandle = nullptr;
+	}
+	else
+	{
+		DeallocateMemory(pMediaMemory, uMediaSize, bDeviceMemory, MemoryAlignment, true);
+	}
 	pMediaMemory = nullptr;
 	uMediaSize = 0;
 	DEC_DWORD_STAT(STAT_WwiseFileHandlerOpenedMedia);
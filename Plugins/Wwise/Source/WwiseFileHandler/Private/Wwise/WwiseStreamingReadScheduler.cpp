@@ -0,0 +1,138 @@
+/*******************************************************************************
+The content of the files in this repository include portions of the
+AUDIOKINETIC Wwise Technology released in source code form as part of the SDK
+package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use these files in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+Copyright (c) 2022 Audiokinetic Inc.
+*******************************************************************************/
+
+#include "Wwise/WwiseStreamingReadScheduler.h"
+#include "Wwise/Stats/AsyncStats.h"
+#include "Wwise/Stats/FileHandler.h"
+
+#include "Algo/BinarySearch.h"
+
+#include <inttypes.h>
+
+FWwiseStreamingReadScheduler& FWwiseStreamingReadScheduler::Get()
+{
+	static FWwiseStreamingReadScheduler Scheduler;
+	return Scheduler;
+}
+
+FWwiseStreamingReadScheduler::FWwiseStreamingReadScheduler() :
+	NextSequence(0),
+	ActiveWorkers(0),
+	MaxConcurrentReads(AK_UNREAL_MAX_CONCURRENT_STREAMING_READS)
+{
+}
+
+void FWwiseStreamingReadScheduler::Schedule(const FArchive& InArchive, FWwiseExecutionQueue::FTimedCallback&& InCallback, FReadFunction&& InRead,
+	FTimespan InDeadline, AkPriority InPriority)
+{
+	ASYNC_INC_DWORD_STAT(STAT_WwiseFileHandlerPendingStreamingReads);
+
+	FScopeLock ScopeLock(&Lock);
+	FPendingRead PendingRead{ &InArchive, InDeadline, InPriority, NextSequence++, MoveTemp(InRead), MoveTemp(InCallback) };
+	const auto Index = Algo::UpperBound(PendingReads, PendingRead);
+	PendingReads.Insert(MoveTemp(PendingRead), Index);
+
+	StartWorkersIfNeeded();
+}
+
+void FWwiseStreamingReadScheduler::SetMaxConcurrentReads(int32 InMaxConcurrentReads)
+{
+	UE_LOG(LogWwiseFileHandler, Verbose, TEXT("Streaming read scheduler: Setting %" PRIi32 " concurrent reads"), InMaxConcurrentReads);
+
+	FScopeLock ScopeLock(&Lock);
+	MaxConcurrentReads = FMath::Max(1, InMaxConcurrentReads);
+	StartWorkersIfNeeded();
+}
+
+bool FWwiseStreamingReadScheduler::TryDequeue(FPendingRead& OutRead)
+{
+	// PendingReads is sorted, so the first read on an idle archive is the most urgent one we can process.
+	for (int32 Index = 0; Index < PendingReads.Num(); ++Index)
+	{
+		if (BusyArchives.Contains(PendingReads[Index].Archive))
+		{
+			continue;
+		}
+
+		OutRead = MoveTemp(PendingReads[Index]);
+		PendingReads.RemoveAt(Index, 1, false);
+		BusyArchives.Add(OutRead.Archive);
+		return true;
+	}
+	return false;
+}
+
+void FWwiseStreamingReadScheduler::StartWorkersIfNeeded()
+{
+	const int32 WorkersToStart = FMath::Min(MaxConcurrentReads - ActiveWorkers, PendingReads.Num() - ActiveWorkers);
+	for (int32 Index = 0; Index < WorkersToStart; ++Index)
+	{
+		++ActiveWorkers;
+		AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [this]
+		{
+			Work();
+		});
+	}
+}
+
+void FWwiseStreamingReadScheduler::Work()
+{
+	FPendingRead Read;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!TryDequeue(Read))
+		{
+			--ActiveWorkers;
+			return;
+		}
+	}
+
+	while (true)
+	{
+		Process(Read);
+
+		FScopeLock ScopeLock(&Lock);
+		BusyArchives.Remove(Read.Archive);
+		if (ActiveWorkers > MaxConcurrentReads || !TryDequeue(Read))
+		{
+			--ActiveWorkers;
+			return;
+		}
+	}
+}
+
+void FWwiseStreamingReadScheduler::Process(FPendingRead& InRead)
+{
+	ASYNC_DEC_DWORD_STAT(STAT_WwiseFileHandlerPendingStreamingReads);
+
+	const bool bResult = InRead.Read();
+	auto Callback = MoveTemp(InRead.Callback);
+	InRead.Read.Reset();
+
+	if (UNLIKELY(!bResult))
+	{
+		Callback(FWwiseExecutionQueue::ETimedResult::Failure);
+	}
+	else if (InRead.Deadline != FWwiseExecutionQueue::NoTimeLimit() && UNLIKELY(FWwiseExecutionQueue::Now() > InRead.Deadline))
+	{
+		ASYNC_INC_DWORD_STAT(STAT_WwiseFileHandlerStreamingDeadlineMisses);
+		++FWwiseFileHandlerCounters::StreamingDeadlineMisses;
+		Callback(FWwiseExecutionQueue::ETimedResult::Timeout);
+	}
+	else
+	{
+		Callback(FWwiseExecutionQueue::ETimedResult::Success);
+	}
+}
@@ -17,6 +17,7 @@ Copyright (c) 2022 Audiokinetic Inc.
 
 #include "Stats/Stats.h"
 #include "Logging/LogMacros.h"
+#include "Templates/Atomic.h"
 
 DECLARE_STATS_GROUP(TEXT("File Handler"), STATGROUP_WwiseFileHandler, STATCAT_Wwise);
 
@@ -43,9 +44,21 @@ DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Opened Streams"), STAT_WwiseFileHand
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Requests"), STAT_WwiseFileHandlerPendingRequests, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Total Requests"), STAT_WwiseFileHandlerTotalRequests, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
 DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Total Streaming MB"), STAT_WwiseFileHandlerTotalStreamedMB, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Streaming Reads"), STAT_WwiseFileHandlerPendingStreamingReads, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Streaming Deadline Misses"), STAT_WwiseFileHandlerStreamingDeadlineMisses, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
 
 DECLARE_CYCLE_STAT_EXTERN(TEXT("IO Request Latency"), STAT_WwiseFileHandlerIORequestLatency, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("File Operation Latency"), STAT_WwiseFileHandlerFileOperationLatency, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("SoundEngine Callback Latency"), STAT_WwiseFileHandlerSoundEngineCallbackLatency, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
 
+/**
+ * Running totals mirroring some of the stats above, readable at runtime without the stats system
+ * (e.g. by on-screen performance displays or automated performance captures).
+ */
+struct WWISEFILEHANDLER_API FWwiseFileHandlerCounters
+{
+	static TAtomic<uint64> TotalStreamedBytes;
+	static TAtomic<uint32> StreamingDeadlineMisses;
+};
+
 WWISEFILEHANDLER_API DECLARE_LOG_CATEGORY_EXTERN(LogWwiseFileHandler, Log, All);
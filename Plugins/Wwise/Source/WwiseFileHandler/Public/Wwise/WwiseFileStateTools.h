@@ -38,6 +38,8 @@ protected:
 	static bool GetMemoryMappedRegion(IMappedFileRegion*& OutMappedRegion, IMappedFileHandle& InMappedHandle);
 	static void UnmapRegion(IMappedFileRegion& InMappedRegion);
 	static void UnmapHandle(IMappedFileHandle& InMappedHandle);
+	static bool GetMemoryMappedMedia(IMappedFileHandle*& OutMappedHandle, IMappedFileRegion*& OutMappedRegion, const uint8*& OutPtr, int64& OutSize,
+		const FString& InFilePathname, bool bInDeviceMemory, int32 InMemoryAlignment);
 
 	static bool GetFileToPtr(const uint8*& OutPtr, int64& OutSize,
 		const FString& InFilePathname, bool bInDeviceMemory, int32 InMemoryAlignment, bool bInEnforceMemoryRequirements);
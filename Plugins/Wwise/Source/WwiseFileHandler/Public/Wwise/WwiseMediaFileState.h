@@ -33,6 +33,9 @@ public:
 class WWISEFILEHANDLER_API FWwiseInMemoryMediaFileState : public FWwiseMediaFileState, public AkSourceSettings
 {
 public:
+	IMappedFileHandle* MappedHandle;
+	IMappedFileRegion* MappedRegion;
+
 	FWwiseInMemoryMediaFileState(const FWwiseMediaCookedData& InCookedData, const FString& InRootPath);
 	~FWwiseInMemoryMediaFileState() override { FileStateExecutionQueue.Stop(); }
 
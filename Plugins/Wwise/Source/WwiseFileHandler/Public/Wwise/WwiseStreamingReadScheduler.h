@@ -0,0 +1,87 @@
+/*******************************************************************************
+The content of the files in this repository include portions of the
+AUDIOKINETIC Wwise Technology released in source code form as part of the SDK
+package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use these files in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+Copyright (c) 2022 Audiokinetic Inc.
+*******************************************************************************/
+
+#pragma once
+
+#include "Wwise/WwiseExecutionQueue.h"
+#include "AkInclude.h"
+
+/**
+ * @brief Shared scheduler for streamed file reads.
+ *
+ * Pending reads from every streaming file state are kept in a single list ordered by deadline, then by
+ * priority. Up to MaxConcurrentReads are processed at the same time. A file is never read by two workers at
+ * once, since the FArchive of a file state is not thread-safe.
+*/
+class WWISEFILEHANDLER_API FWwiseStreamingReadScheduler
+{
+public:
+	using FReadFunction = TUniqueFunction<bool()>;
+
+	static FWwiseStreamingReadScheduler& Get();
+
+	FWwiseStreamingReadScheduler();
+
+	/**
+	 * @brief Queues a read operation.
+	 *
+	 * @param InArchive Archive the read operates on. Only one read per archive is processed at a time.
+	 * @param InCallback Called from a worker once the read is done. Timeout means the read succeeded past its deadline.
+	 * @param InRead Operation doing the actual read. Returns false on failure.
+	 * @param InDeadline Absolute time at which the data is required, or FWwiseExecutionQueue::NoTimeLimit().
+	 * @param InPriority Wwise stream priority. Used to order reads sharing the same deadline.
+	*/
+	void Schedule(const FArchive& InArchive, FWwiseExecutionQueue::FTimedCallback&& InCallback, FReadFunction&& InRead,
+		FTimespan InDeadline = FWwiseExecutionQueue::NoTimeLimit(), AkPriority InPriority = AK_DEFAULT_PRIORITY);
+
+	void SetMaxConcurrentReads(int32 InMaxConcurrentReads);
+	int32 GetMaxConcurrentReads() const { return MaxConcurrentReads; }
+
+private:
+	struct FPendingRead
+	{
+		const FArchive* Archive;
+		FTimespan Deadline;
+		AkPriority Priority;
+		uint64 Sequence;
+		FReadFunction Read;
+		FWwiseExecutionQueue::FTimedCallback Callback;
+
+		bool operator<(const FPendingRead& InRhs) const
+		{
+			if (Deadline != InRhs.Deadline)
+			{
+				return Deadline < InRhs.Deadline;
+			}
+			if (Priority != InRhs.Priority)
+			{
+				return Priority > InRhs.Priority;
+			}
+			return Sequence < InRhs.Sequence;
+		}
+	};
+
+	FCriticalSection Lock;
+	TArray<FPendingRead> PendingReads;
+	TSet<const FArchive*> BusyArchives;
+	uint64 NextSequence;
+	int32 ActiveWorkers;
+	int32 MaxConcurrentReads;
+
+	bool TryDequeue(FPendingRead& OutRead);
+	void StartWorkersIfNeeded();
+	void Work();
+	static void Process(FPendingRead& InRead);
+};
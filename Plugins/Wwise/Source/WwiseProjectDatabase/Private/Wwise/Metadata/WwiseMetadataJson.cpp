@@ -0,0 +1,789 @@
+/*******************************************************************************
+The content of the files in this repository include portions of the
+AUDIOKINETIC Wwise Technology released in source code form as part of the SDK
+package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use these files in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+Copyright (c) 2022 Audiokinetic Inc.
+*******************************************************************************/
+
+#include "Wwise/Metadata/WwiseMetadataJson.h"
+
+#include "Wwise/Stats/ProjectDatabase.h"
+
+#include "Containers/StringConv.h"
+
+#if !UE_BUILD_SHIPPING
+#include "Wwise/Metadata/WwiseMetadataRootFile.h"
+#include "Wwise/Metadata/WwiseMetadataSoundBanksInfo.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#endif
+
+namespace WwiseMetadataJson
+{
+	static bool IsWhitespace(uint8 InChar)
+	{
+		return InChar == ' ' || InChar == '\t' || InChar == '\n' || InChar == '\r';
+	}
+
+	static bool IsNumberChar(uint8 InChar)
+	{
+		return (InChar >= '0' && InChar <= '9') || InChar == '-' || InChar == '+' || InChar == '.' || InChar == 'e' || InChar == 'E';
+	}
+
+	static int32 HexValue(uint8 InChar)
+	{
+		if (InChar >= '0' && InChar <= '9') return InChar - '0';
+		if (InChar >= 'a' && InChar <= 'f') return InChar - 'a' + 10;
+		if (InChar >= 'A' && InChar <= 'F') return InChar - 'A' + 10;
+		return -1;
+	}
+
+	static bool ReadHex4(const ANSICHAR* InText, int32 InRemaining, uint32& OutValue)
+	{
+		if (InRemaining < 4)
+		{
+			return false;
+		}
+		OutValue = 0;
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			const int32 Digit = HexValue((uint8)InText[Index]);
+			if (Digit < 0)
+			{
+				return false;
+			}
+			OutValue = (OutValue << 4) | Digit;
+		}
+		return true;
+	}
+
+	static void AppendUtf8(TArray<ANSICHAR>& OutText, uint32 InCodePoint)
+	{
+		if (InCodePoint < 0x80)
+		{
+			OutText.Add((ANSICHAR)InCodePoint);
+		}
+		else if (InCodePoint < 0x800)
+		{
+			OutText.Add((ANSICHAR)(0xC0 | (InCodePoint >> 6)));
+			OutText.Add((ANSICHAR)(0x80 | (InCodePoint & 0x3F)));
+		}
+		else if (InCodePoint < 0x10000)
+		{
+			OutText.Add((ANSICHAR)(0xE0 | (InCodePoint >> 12)));
+			OutText.Add((ANSICHAR)(0x80 | ((InCodePoint >> 6) & 0x3F)));
+			OutText.Add((ANSICHAR)(0x80 | (InCodePoint & 0x3F)));
+		}
+		else
+		{
+			OutText.Add((ANSICHAR)(0xF0 | (InCodePoint >> 18)));
+			OutText.Add((ANSICHAR)(0x80 | ((InCodePoint >> 12) & 0x3F)));
+			OutText.Add((ANSICHAR)(0x80 | ((InCodePoint >> 6) & 0x3F)));
+			OutText.Add((ANSICHAR)(0x80 | (InCodePoint & 0x3F)));
+		}
+	}
+
+	static FString Utf8ToString(const ANSICHAR* InText, int32 InLength)
+	{
+		FUTF8ToTCHAR Converted(InText, InLength);
+		return FString(Converted.Length(), Converted.Get());
+	}
+}
+
+bool FWwiseMetadataJsonDocument::Parse(TArray<uint8>&& InUtf8Contents)
+{
+	using namespace WwiseMetadataJson;
+
+	Contents = MoveTemp(InUtf8Contents);
+	Tokens.Reset();
+	Tokens.Reserve(Contents.Num() / 16);
+
+	const uint8* Data = Contents.GetData();
+	const int32 Size = Contents.Num();
+	int32 Pos = 0;
+
+	// Skip UTF-8 BOM
+	if (Size >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+	{
+		Pos = 3;
+	}
+
+	enum class EExpect
+	{
+		Value,
+		ValueOrEnd,
+		Key,
+		KeyOrEnd,
+		Colon,
+		CommaOrEnd,
+		Done
+	};
+	EExpect Expect = EExpect::Value;
+	TArray<int32, TInlineAllocator<64>> OpenContainers;
+
+	const auto Fail = [this, &Pos](const TCHAR* InReason)
+	{
+		UE_LOG(LogWwiseProjectDatabase, Error, TEXT("Error while decoding json at offset %d: %s"), Pos, InReason);
+		Tokens.Empty();
+		return false;
+	};
+	const auto AddToken = [this](ETokenType InType, bool bInEscaped, int32 InStart, int32 InLength)
+	{
+		const int32 Index = Tokens.Num();
+		Tokens.Add(FToken{ InType, bInEscaped, InStart, InLength, Index + 1 });
+		return Index;
+	};
+	const auto ValueDone = [&OpenContainers, &Expect]
+	{
+		Expect = OpenContainers.Num() > 0 ? EExpect::CommaOrEnd : EExpect::Done;
+	};
+	const auto CloseContainer = [this, &OpenContainers, &Pos, &ValueDone](ETokenType InType)
+	{
+		const int32 Container = OpenContainers.Pop(false);
+		if (Tokens[Container].Type != InType)
+		{
+			return false;
+		}
+		Tokens[Container].End = Tokens.Num();
+		Tokens[Container].Length = Pos + 1 - Tokens[Container].Start;
+		++Pos;
+		ValueDone();
+		return true;
+	};
+
+	while (true)
+	{
+		while (Pos < Size && IsWhitespace(Data[Pos]))
+		{
+			++Pos;
+		}
+		if (Pos >= Size)
+		{
+			if (Expect != EExpect::Done)
+			{
+				return Fail(TEXT("Unexpected end of file"));
+			}
+			break;
+		}
+
+		const uint8 Char = Data[Pos];
+		switch (Expect)
+		{
+		case EExpect::Done:
+			return Fail(TEXT("Unexpected data after root object"));
+
+		case EExpect::Colon:
+			if (Char != ':')
+			{
+				return Fail(TEXT("Expected ':'"));
+			}
+			++Pos;
+			Expect = EExpect::Value;
+			continue;
+
+		case EExpect::CommaOrEnd:
+			if (Char == ',')
+			{
+				++Pos;
+				Expect = Tokens[OpenContainers.Last()].Type == ETokenType::Object ? EExpect::Key : EExpect::Value;
+				continue;
+			}
+			if ((Char == '}' && !CloseContainer(ETokenType::Object))
+				|| (Char == ']' && !CloseContainer(ETokenType::Array)))
+			{
+				return Fail(TEXT("Mismatched container end"));
+			}
+			if (Char != '}' && Char != ']')
+			{
+				return Fail(TEXT("Expected ',' or container end"));
+			}
+			continue;
+
+		case EExpect::KeyOrEnd:
+			if (Char == '}')
+			{
+				CloseContainer(ETokenType::Object);
+				continue;
+			}
+			// Fallthrough
+		case EExpect::Key:
+			if (Char != '"')
+			{
+				return Fail(TEXT("Expected field name"));
+			}
+			break;
+
+		case EExpect::ValueOrEnd:
+			if (Char == ']')
+			{
+				CloseContainer(ETokenType::Array);
+				continue;
+			}
+			// Fallthrough
+		case EExpect::Value:
+			break;
+		}
+
+		if (Char == '"')
+		{
+			const int32 Start = Pos + 1;
+			bool bEscaped = false;
+			int32 Current = Start;
+			while (Current < Size && Data[Current] != '"')
+			{
+				if (Data[Current] == '\\')
+				{
+					bEscaped = true;
+					++Current;
+				}
+				++Current;
+			}
+			if (Current >= Size)
+			{
+				return Fail(TEXT("Unterminated string"));
+			}
+			AddToken(ETokenType::String, bEscaped, Start, Current - Start);
+			Pos = Current + 1;
+			if (Expect == EExpect::Key || Expect == EExpect::KeyOrEnd)
+			{
+				Expect = EExpect::Colon;
+			}
+			else
+			{
+				ValueDone();
+			}
+		}
+		else if (Char == '{' || Char == '[')
+		{
+			OpenContainers.Add(AddToken(Char == '{' ? ETokenType::Object : ETokenType::Array, false, Pos, 0));
+			++Pos;
+			Expect = Char == '{' ? EExpect::KeyOrEnd : EExpect::ValueOrEnd;
+		}
+		else if (Char == 't' || Char == 'f' || Char == 'n')
+		{
+			const ANSICHAR* Literal = Char == 't' ? "true" : Char == 'f' ? "false" : "null";
+			const int32 Length = FCStringAnsi::Strlen(Literal);
+			if (Pos + Length > Size || FCStringAnsi::Strncmp((const ANSICHAR*)Data + Pos, Literal, Length) != 0)
+			{
+				return Fail(TEXT("Invalid literal"));
+			}
+			AddToken(Char == 'n' ? ETokenType::Null : ETokenType::Bool, false, Pos, Length);
+			Pos += Length;
+			ValueDone();
+		}
+		else if (Char == '-' || (Char >= '0' && Char <= '9'))
+		{
+			const int32 Start = Pos;
+			while (Pos < Size && IsNumberChar(Data[Pos]))
+			{
+				++Pos;
+			}
+			AddToken(ETokenType::Number, false, Start, Pos - Start);
+			ValueDone();
+		}
+		else
+		{
+			return Fail(TEXT("Unexpected character"));
+		}
+	}
+
+	if (Tokens.Num() == 0 || Tokens[0].Type != ETokenType::Object)
+	{
+		UE_LOG(LogWwiseProjectDatabase, Error, TEXT("Error while decoding json: Root is not an object"));
+		Tokens.Empty();
+		return false;
+	}
+	Tokens.Shrink();
+	return true;
+}
+
+bool FWwiseMetadataJsonDocument::TextEquals(const FToken& InToken, const FString& InText) const
+{
+	if (!InToken.bEscaped && InToken.Length == InText.Len())
+	{
+		const ANSICHAR* Text = GetText(InToken);
+		bool bAscii = true;
+		for (int32 Index = 0; Index < InToken.Length; ++Index)
+		{
+			const TCHAR Char = InText[Index];
+			if (Char >= 0x80)
+			{
+				bAscii = false;
+				break;
+			}
+			if ((ANSICHAR)Char != Text[Index])
+			{
+				return false;
+			}
+		}
+		if (bAscii)
+		{
+			return true;
+		}
+	}
+	else if (!InToken.bEscaped && InToken.Length < InText.Len())
+	{
+		// UTF-8 is never shorter than the TCHAR string it represents
+		return false;
+	}
+	return DecodeString(InToken) == InText;
+}
+
+FString FWwiseMetadataJsonDocument::DecodeString(const FToken& InToken) const
+{
+	using namespace WwiseMetadataJson;
+
+	const ANSICHAR* Text = GetText(InToken);
+	if (!InToken.bEscaped)
+	{
+		return Utf8ToString(Text, InToken.Length);
+	}
+
+	TArray<ANSICHAR, TInlineAllocator<256>> Unescaped;
+	Unescaped.Reserve(InToken.Length);
+	for (int32 Index = 0; Index < InToken.Length; ++Index)
+	{
+		const ANSICHAR Char = Text[Index];
+		if (Char != '\\' || Index + 1 >= InToken.Length)
+		{
+			Unescaped.Add(Char);
+			continue;
+		}
+
+		const ANSICHAR Escaped = Text[++Index];
+		switch (Escaped)
+		{
+		case 'b': Unescaped.Add('\b'); break;
+		case 'f': Unescaped.Add('\f'); break;
+		case 'n': Unescaped.Add('\n'); break;
+		case 'r': Unescaped.Add('\r'); break;
+		case 't': Unescaped.Add('\t'); break;
+		case 'u':
+		{
+			uint32 CodePoint;
+			if (!ReadHex4(Text + Index + 1, InToken.Length - Index - 1, CodePoint))
+			{
+				Unescaped.Add(Escaped);
+				break;
+			}
+			Index += 4;
+
+			// Combine UTF-16 surrogate pairs
+			uint32 LowSurrogate;
+			if (CodePoint >= 0xD800 && CodePoint < 0xDC00
+				&& Index + 2 < InToken.Length && Text[Index + 1] == '\\' && Text[Index + 2] == 'u'
+				&& ReadHex4(Text + Index + 3, InToken.Length - Index - 3, LowSurrogate)
+				&& LowSurrogate >= 0xDC00 && LowSurrogate < 0xE000)
+			{
+				CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+				Index += 6;
+			}
+			AppendUtf8(Unescaped, CodePoint);
+			break;
+		}
+		default:
+			// \" \\ \/ and unknown escapes
+			Unescaped.Add(Escaped);
+			break;
+		}
+	}
+	return Utf8ToString(Unescaped.GetData(), Unescaped.Num());
+}
+
+bool FWwiseMetadataJsonValue::IsObject() const
+{
+	return IsValid() && Document->GetToken(Token).Type == FWwiseMetadataJsonDocument::ETokenType::Object;
+}
+
+bool FWwiseMetadataJsonValue::IsArray() const
+{
+	return IsValid() && Document->GetToken(Token).Type == FWwiseMetadataJsonDocument::ETokenType::Array;
+}
+
+bool FWwiseMetadataJsonValue::TryGetBool(bool& OutValue) const
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+	const auto& Value = Document->GetToken(Token);
+	switch (Value.Type)
+	{
+	case FWwiseMetadataJsonDocument::ETokenType::Bool:
+		OutValue = *Document->GetText(Value) == 't';
+		return true;
+	case FWwiseMetadataJsonDocument::ETokenType::String:
+		OutValue = Document->DecodeString(Value).ToBool();
+		return true;
+	case FWwiseMetadataJsonDocument::ETokenType::Number:
+	{
+		double Number = 0.0;
+		TryGetNumber(Number);
+		OutValue = Number != 0.0;
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool FWwiseMetadataJsonValue::TryGetNumber(double& OutValue) const
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+	const auto& Value = Document->GetToken(Token);
+	switch (Value.Type)
+	{
+	case FWwiseMetadataJsonDocument::ETokenType::Number:
+	{
+		ANSICHAR Buffer[64];
+		const int32 Length = FMath::Min(Value.Length, (int32)UE_ARRAY_COUNT(Buffer) - 1);
+		FMemory::Memcpy(Buffer, Document->GetText(Value), Length);
+		Buffer[Length] = 0;
+		OutValue = FCStringAnsi::Atod(Buffer);
+		return true;
+	}
+	case FWwiseMetadataJsonDocument::ETokenType::String:
+	{
+		const FString String = Document->DecodeString(Value);
+		if (!String.IsNumeric())
+		{
+			return false;
+		}
+		OutValue = FCString::Atod(*String);
+		return true;
+	}
+	case FWwiseMetadataJsonDocument::ETokenType::Bool:
+		OutValue = *Document->GetText(Value) == 't' ? 1.0 : 0.0;
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool FWwiseMetadataJsonValue::TryGetNumber(uint32& OutValue) const
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+
+	// Short IDs are the most common numbers. Decode plain integers exactly, without going through a double.
+	const auto& Value = Document->GetToken(Token);
+	if ((Value.Type == FWwiseMetadataJsonDocument::ETokenType::Number || Value.Type == FWwiseMetadataJsonDocument::ETokenType::String)
+		&& !Value.bEscaped && Value.Length > 0 && Value.Length <= 10)
+	{
+		const ANSICHAR* Text = Document->GetText(Value);
+		uint64 Integer = 0;
+		int32 Index = 0;
+		for (; Index < Value.Length && Text[Index] >= '0' && Text[Index] <= '9'; ++Index)
+		{
+			Integer = Integer * 10 + (Text[Index] - '0');
+		}
+		if (Index == Value.Length && Integer <= MAX_uint32)
+		{
+			OutValue = (uint32)Integer;
+			return true;
+		}
+	}
+
+	double Number;
+	if (!TryGetNumber(Number) || Number < 0.0 || Number > (double)MAX_uint32)
+	{
+		return false;
+	}
+	OutValue = (uint32)FMath::RoundHalfFromZero(Number);
+	return true;
+}
+
+bool FWwiseMetadataJsonValue::TryGetString(FString& OutValue) const
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+	const auto& Value = Document->GetToken(Token);
+	switch (Value.Type)
+	{
+	case FWwiseMetadataJsonDocument::ETokenType::String:
+	case FWwiseMetadataJsonDocument::ETokenType::Number:
+	case FWwiseMetadataJsonDocument::ETokenType::Bool:
+		OutValue = Document->DecodeString(Value);
+		return true;
+	default:
+		return false;
+	}
+}
+
+void FWwiseMetadataJsonValue::GetElements(TArray<FWwiseMetadataJsonValue>& OutElements) const
+{
+	OutElements.Reset();
+	if (!IsArray())
+	{
+		return;
+	}
+	const int32 End = Document->GetToken(Token).End;
+	for (int32 Element = Token + 1; Element < End; Element = Document->GetToken(Element).End)
+	{
+		OutElements.Emplace(*Document, Element);
+	}
+}
+
+void FWwiseMetadataJsonValue::GetKeys(TArray<FString>& OutKeys) const
+{
+	OutKeys.Reset();
+	if (!IsObject())
+	{
+		return;
+	}
+	const int32 End = Document->GetToken(Token).End;
+	for (int32 Key = Token + 1; Key < End; Key = Document->GetToken(Key + 1).End)
+	{
+		OutKeys.AddUnique(Document->DecodeString(Document->GetToken(Key)));
+	}
+}
+
+bool FWwiseMetadataJsonValue::TryGetField(const FString& InFieldName, FWwiseMetadataJsonValue& OutValue) const
+{
+	if (!IsObject())
+	{
+		return false;
+	}
+	// Duplicate keys resolve to the last value, as they did with FJsonObject. The whole object must be scanned.
+	int32 Found = INDEX_NONE;
+	const int32 End = Document->GetToken(Token).End;
+	for (int32 Key = Token + 1; Key < End; Key = Document->GetToken(Key + 1).End)
+	{
+		if (Document->TextEquals(Document->GetToken(Key), InFieldName))
+		{
+			Found = Key + 1;
+		}
+	}
+	if (Found == INDEX_NONE)
+	{
+		return false;
+	}
+	OutValue = FWwiseMetadataJsonValue(*Document, Found);
+	return true;
+}
+
+bool FWwiseMetadataJsonValue::TryGetBoolField(const FString& InFieldName, bool& OutValue) const
+{
+	FWwiseMetadataJsonValue Field;
+	return TryGetField(InFieldName, Field) && Field.TryGetBool(OutValue);
+}
+
+bool FWwiseMetadataJsonValue::TryGetNumberField(const FString& InFieldName, double& OutValue) const
+{
+	FWwiseMetadataJsonValue Field;
+	return TryGetField(InFieldName, Field) && Field.TryGetNumber(OutValue);
+}
+
+bool FWwiseMetadataJsonValue::TryGetNumberField(const FString& InFieldName, uint32& OutValue) const
+{
+	FWwiseMetadataJsonValue Field;
+	return TryGetField(InFieldName, Field) && Field.TryGetNumber(OutValue);
+}
+
+bool FWwiseMetadataJsonValue::TryGetStringField(const FString& InFieldName, FString& OutValue) const
+{
+	FWwiseMetadataJsonValue Field;
+	return TryGetField(InFieldName, Field) && Field.TryGetString(OutValue);
+}
+
+bool FWwiseMetadataJsonValue::TryGetObjectField(const FString& InFieldName, FWwiseMetadataJsonValue& OutValue) const
+{
+	return TryGetField(InFieldName, OutValue) && OutValue.IsObject();
+}
+
+bool FWwiseMetadataJsonValue::TryGetArrayField(const FString& InFieldName, TArray<FWwiseMetadataJsonValue>& OutElements) const
+{
+	FWwiseMetadataJsonValue Field;
+	if (!TryGetField(InFieldName, Field) || !Field.IsArray())
+	{
+		return false;
+	}
+	Field.GetElements(OutElements);
+	return true;
+}
+
+#if !UE_BUILD_SHIPPING
+namespace WwiseMetadataJson
+{
+	// Rough size of a shared pointer's reference controller. The DOM sizes are estimates, not allocator measurements.
+	static constexpr SIZE_T SharedReferenceControllerSize = 16;
+
+	static SIZE_T GetJsonValueAllocatedSize(const TSharedPtr<FJsonValue>& InValue);
+
+	static SIZE_T GetJsonObjectAllocatedSize(const TSharedPtr<FJsonObject>& InObject)
+	{
+		if (!InObject.IsValid())
+		{
+			return 0;
+		}
+		SIZE_T Result = sizeof(FJsonObject) + SharedReferenceControllerSize + InObject->Values.GetAllocatedSize();
+		for (const auto& Value : InObject->Values)
+		{
+			Result += Value.Key.GetAllocatedSize() + GetJsonValueAllocatedSize(Value.Value);
+		}
+		return Result;
+	}
+
+	static SIZE_T GetJsonValueAllocatedSize(const TSharedPtr<FJsonValue>& InValue)
+	{
+		if (!InValue.IsValid())
+		{
+			return 0;
+		}
+		switch (InValue->Type)
+		{
+		case EJson::Object:
+			return sizeof(FJsonValueObject) + SharedReferenceControllerSize + GetJsonObjectAllocatedSize(InValue->AsObject());
+		case EJson::Array:
+		{
+			const auto& Elements = InValue->AsArray();
+			SIZE_T Result = sizeof(FJsonValueArray) + SharedReferenceControllerSize + Elements.GetAllocatedSize();
+			for (const auto& Element : Elements)
+			{
+				Result += GetJsonValueAllocatedSize(Element);
+			}
+			return Result;
+		}
+		case EJson::String:
+			return sizeof(FJsonValueString) + SharedReferenceControllerSize + (InValue->AsString().Len() + 1) * sizeof(TCHAR);
+		default:
+			return sizeof(FJsonValueNumber) + SharedReferenceControllerSize;
+		}
+	}
+
+	static FString MakeBenchmarkGuid(uint32 InA, uint32 InB)
+	{
+		return FGuid(InA, InB, 0x5757, 0x15E).ToString(EGuidFormats::DigitsWithHyphensInBraces);
+	}
+
+	/** Generates a SoundbanksInfo with NumSoundBanks banks, each with its own events and media, and shared busses. */
+	static FString MakeSyntheticSoundBanksInfo(int32 InNumSoundBanks, int32 InNumEventsPerBank, int32 InNumMediaPerBank)
+	{
+		FString Result;
+		Result.Reserve(InNumSoundBanks * (InNumEventsPerBank + InNumMediaPerBank) * 400);
+
+		Result += TEXT("{\"SoundBanksInfo\":{\"Platform\":\"Windows\",\"BasePlatform\":\"Windows\",\"SchemaVersion\":\"14\",\"SoundBankVersion\":\"145\",");
+		Result += TEXT("\"RootPaths\":{\"ProjectRoot\":\"C:\\\\Project\\\\\",\"SourceFilesRoot\":\"C:\\\\Project\\\\.cache\\\\\",\"SoundBanksRoot\":\"C:\\\\Project\\\\GeneratedSoundBanks\\\\\",");
+		Result += TEXT("\"ExternalSourcesInputFile\":\"\",\"ExternalSourcesOutputRoot\":\"C:\\\\Project\\\\GeneratedSoundBanks\\\\\"},");
+		Result += TEXT("\"SoundBanks\":[");
+		for (int32 Bank = 0; Bank < InNumSoundBanks; ++Bank)
+		{
+			const uint32 BankId = 100000 + Bank;
+			Result += FString::Printf(TEXT("%s{\"Id\":\"%u\",\"GUID\":\"%s\",\"Language\":\"SFX\",\"Hash\":\"%s\",\"Type\":\"User\","),
+				Bank > 0 ? TEXT(",") : TEXT(""), BankId, *MakeBenchmarkGuid(1, BankId), *MakeBenchmarkGuid(2, BankId));
+			Result += FString::Printf(TEXT("\"ObjectPath\":\"\\\\SoundBanks\\\\Default Work Unit\\\\Bank_%d\",\"ShortName\":\"Bank_%d\",\"Path\":\"Bank_%d.bnk\","), Bank, Bank, Bank);
+
+			Result += TEXT("\"Media\":[");
+			for (int32 Media = 0; Media < InNumMediaPerBank; ++Media)
+			{
+				const uint32 MediaId = BankId * 100 + Media;
+				Result += FString::Printf(TEXT("%s{\"Id\":\"%u\",\"Language\":\"SFX\",\"Streaming\":\"false\",\"Location\":\"Memory\",\"ShortName\":\"Sound_%u.wav\"}"),
+					Media > 0 ? TEXT(",") : TEXT(""), MediaId, MediaId);
+			}
+
+			Result += TEXT("],\"Events\":[");
+			for (int32 Event = 0; Event < InNumEventsPerBank; ++Event)
+			{
+				const uint32 EventId = BankId * 100 + 50 + Event;
+				Result += FString::Printf(TEXT("%s{\"Id\":\"%u\",\"Name\":\"Play_%u\",\"ObjectPath\":\"\\\\Events\\\\Default Work Unit\\\\Play_%u\",\"GUID\":\"%s\","),
+					Event > 0 ? TEXT(",") : TEXT(""), EventId, EventId, EventId, *MakeBenchmarkGuid(3, EventId));
+				Result += FString::Printf(TEXT("\"MaxAttenuation\":\"%d\",\"DurationType\":\"OneShot\",\"DurationMin\":\"1.250000\",\"DurationMax\":\"2.500000\","), 1000 + Event);
+				Result += FString::Printf(TEXT("\"MediaRefs\":[{\"Id\":\"%u\"}]}"), BankId * 100 + Event % FMath::Max(InNumMediaPerBank, 1));
+			}
+
+			// The same busses are referenced by every bank, as in real projects
+			Result += TEXT("],\"Busses\":[");
+			for (int32 Bus = 0; Bus < 4; ++Bus)
+			{
+				Result += FString::Printf(TEXT("%s{\"Id\":\"%u\",\"Name\":\"Bus_%d\",\"ObjectPath\":\"\\\\Master-Mixer Hierarchy\\\\Bus_%d\",\"GUID\":\"%s\"}"),
+					Bus > 0 ? TEXT(",") : TEXT(""), 900 + Bus, Bus, Bus, *MakeBenchmarkGuid(4, 900 + Bus));
+			}
+			Result += TEXT("]}");
+		}
+		Result += TEXT("]}}");
+		return Result;
+	}
+
+	static void BenchmarkMetadataParse(const TArray<FString>& Args)
+	{
+		const int32 NumSoundBanks = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 2000;
+		const int32 NumIterations = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 3;
+		if (NumSoundBanks <= 0 || NumIterations <= 0)
+		{
+			return;
+		}
+
+		const FString Json = MakeSyntheticSoundBanksInfo(NumSoundBanks, 20, 10);
+		const FTCHARToUTF8 Utf8Json(*Json, Json.Len());
+		const TArray<uint8> FileBytes((const uint8*)Utf8Json.Get(), Utf8Json.Length());
+
+		// Token document only, then the complete token loader building the metadata structures
+		double TokenTime = 0.0;
+		double LoaderTime = 0.0;
+		SIZE_T TokenPeakSize = 0;
+		bool bLoaderValid = true;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			TArray<uint8> Contents = FileBytes;
+			const double TokenStart = FPlatformTime::Seconds();
+			FWwiseMetadataJsonDocument Document;
+			const bool bParsed = Document.Parse(MoveTemp(Contents));
+			TokenTime += FPlatformTime::Seconds() - TokenStart;
+			TokenPeakSize = FMath::Max(TokenPeakSize, Document.GetAllocatedSize());
+
+			Contents = FileBytes;
+			const double LoaderStart = FPlatformTime::Seconds();
+			const auto RootFile = FWwiseMetadataRootFile::LoadFile(MoveTemp(Contents), TEXT("Benchmark"));
+			LoaderTime += FPlatformTime::Seconds() - LoaderStart;
+			bLoaderValid &= bParsed && RootFile.IsValid() && RootFile->SoundBanksInfo && RootFile->SoundBanksInfo->SoundBanks.Num() == NumSoundBanks;
+		}
+
+		// Previous path: the file is converted to TCHAR, then deserialized as a FJsonObject tree
+		double DomTime = 0.0;
+		SIZE_T DomPeakSize = 0;
+		bool bDomValid = true;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			const double DomStart = FPlatformTime::Seconds();
+			FString Contents;
+			FFileHelper::BufferToString(Contents, FileBytes.GetData(), FileBytes.Num());
+			TSharedPtr<FJsonObject> RootObject;
+			const bool bParsed = FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Contents), RootObject);
+			DomTime += FPlatformTime::Seconds() - DomStart;
+			DomPeakSize = FMath::Max(DomPeakSize, Contents.GetAllocatedSize() + GetJsonObjectAllocatedSize(RootObject));
+			bDomValid &= bParsed && RootObject.IsValid();
+		}
+
+		UE_LOG(LogWwiseProjectDatabase, Display, TEXT("MetadataParse %d SoundBanks, %.1f MB file:"), NumSoundBanks, FileBytes.Num() / (1024.0 * 1024.0));
+		UE_LOG(LogWwiseProjectDatabase, Display, TEXT("- Token document: %.2f ms, %.1f MB held%s"),
+			TokenTime * 1e3 / NumIterations, TokenPeakSize / (1024.0 * 1024.0), bLoaderValid ? TEXT("") : TEXT(" (INVALID OUTPUT)"));
+		UE_LOG(LogWwiseProjectDatabase, Display, TEXT("- Token loader, including metadata structures: %.2f ms"), LoaderTime * 1e3 / NumIterations);
+		UE_LOG(LogWwiseProjectDatabase, Display, TEXT("- FJsonSerializer DOM: %.2f ms, ~%.1f MB held (estimated)%s"),
+			DomTime * 1e3 / NumIterations, DomPeakSize / (1024.0 * 1024.0), bDomValid ? TEXT("") : TEXT(" (INVALID OUTPUT)"));
+	}
+
+	static FAutoConsoleCommand BenchmarkMetadataParseCommand(
+		TEXT("Wwise.Benchmark.MetadataParse"),
+		TEXT("Compares the metadata token parser with a FJsonSerializer DOM parse on a synthetic SoundbanksInfo file. Arguments: [NumSoundBanks=2000] [NumIterations=3]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkMetadataParse));
+}
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,117 @@
+/*******************************************************************************
+The content of the files in this repository include portions of the
+AUDIOKINETIC Wwise Technology released in source code form as part of the SDK
+package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use these files in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+Copyright (c) 2022 Audiokinetic Inc.
+*******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FWwiseMetadataJsonDocument;
+
+/**
+ * @brief Read-only view on a value of a FWwiseMetadataJsonDocument.
+ *
+ * Mirrors the FJsonObject accessors used by FWwiseMetadataLoader. A view is only valid as long as its document is.
+*/
+struct FWwiseMetadataJsonValue
+{
+	const FWwiseMetadataJsonDocument* Document = nullptr;
+	int32 Token = INDEX_NONE;
+
+	FWwiseMetadataJsonValue() {}
+	FWwiseMetadataJsonValue(const FWwiseMetadataJsonDocument& InDocument, int32 InToken) :
+		Document(&InDocument),
+		Token(InToken)
+	{}
+
+	bool IsValid() const { return Document && Token != INDEX_NONE; }
+	bool IsObject() const;
+	bool IsArray() const;
+
+	bool TryGetBool(bool& OutValue) const;
+	bool TryGetNumber(double& OutValue) const;
+	bool TryGetNumber(uint32& OutValue) const;
+	bool TryGetString(FString& OutValue) const;
+
+	/** Returns the elements of an array value. Non-array values have no elements. */
+	void GetElements(TArray<FWwiseMetadataJsonValue>& OutElements) const;
+	/** Returns the field names of an object value. Duplicate names are only returned once. */
+	void GetKeys(TArray<FString>& OutKeys) const;
+
+	/** Looks up a field of an object value. When a name is duplicated, the last value is returned, like FJsonObject. */
+	bool TryGetField(const FString& InFieldName, FWwiseMetadataJsonValue& OutValue) const;
+	bool TryGetBoolField(const FString& InFieldName, bool& OutValue) const;
+	bool TryGetNumberField(const FString& InFieldName, double& OutValue) const;
+	bool TryGetNumberField(const FString& InFieldName, uint32& OutValue) const;
+	bool TryGetStringField(const FString& InFieldName, FString& OutValue) const;
+	bool TryGetObjectField(const FString& InFieldName, FWwiseMetadataJsonValue& OutValue) const;
+	bool TryGetArrayField(const FString& InFieldName, TArray<FWwiseMetadataJsonValue>& OutElements) const;
+};
+
+/**
+ * @brief Json document tokenized directly from its UTF-8 contents.
+ *
+ * Instead of building a FJsonObject tree, with one allocation per value and one map per object, the document keeps
+ * the UTF-8 buffer and a flat array of tokens pointing into it. Values are only decoded when requested by the
+ * metadata loader. Strings are never converted as a whole to TCHAR.
+*/
+class FWwiseMetadataJsonDocument
+{
+public:
+	enum class ETokenType : uint8
+	{
+		Null,
+		Bool,
+		Number,
+		String,
+		Object,
+		Array
+	};
+
+	struct FToken
+	{
+		ETokenType Type;
+		/** String contains escape sequences and must be unescaped before use. */
+		bool bEscaped;
+		/** Range in the UTF-8 buffer. Excludes the quotes for strings. */
+		int32 Start;
+		int32 Length;
+		/** Index of the token following this value and all its children. */
+		int32 End;
+	};
+
+	FWwiseMetadataJsonDocument() {}
+
+	/**
+	 * @brief Tokenizes the UTF-8 contents. The document keeps ownership of the buffer.
+	 * @return false if the contents are not a valid Json document with an object as root.
+	*/
+	bool Parse(TArray<uint8>&& InUtf8Contents);
+
+	FWwiseMetadataJsonValue GetRoot() const { return FWwiseMetadataJsonValue(*this, Tokens.Num() > 0 ? 0 : INDEX_NONE); }
+
+	const FToken& GetToken(int32 InToken) const { return Tokens[InToken]; }
+	const ANSICHAR* GetText(const FToken& InToken) const { return (const ANSICHAR*)Contents.GetData() + InToken.Start; }
+	bool TextEquals(const FToken& InToken, const FString& InText) const;
+	FString DecodeString(const FToken& InToken) const;
+
+	SIZE_T GetAllocatedSize() const { return Contents.GetAllocatedSize() + Tokens.GetAllocatedSize(); }
+
+private:
+	TArray<uint8> Contents;
+	TArray<FToken> Tokens;
+
+	FWwiseMetadataJsonDocument(const FWwiseMetadataJsonDocument&) = delete;
+	FWwiseMetadataJsonDocument& operator=(const FWwiseMetadataJsonDocument&) = delete;
+};
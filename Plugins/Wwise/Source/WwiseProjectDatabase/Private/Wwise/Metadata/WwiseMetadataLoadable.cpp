@@ -16,7 +16,7 @@ Copyright (c) 2022 Audiokinetic Inc.
 #include "Wwise/Metadata/WwiseMetadataLoadable.h"
 #include "Wwise/Stats/ProjectDatabase.h"
 
-#include "Json.h"
+#include "Wwise/Metadata/WwiseMetadataJson.h"
 
 void FWwiseMetadataLoadable::AddRequestedValue(const FString& Type, const FString& Value)
 {
@@ -28,10 +28,10 @@ void FWwiseMetadataLoadable::AddRequestedValue(const FString& Type, const FStrin
 	}
 }
 
-void FWwiseMetadataLoadable::CheckRequestedValues(TSharedRef<FJsonObject>& JsonObject)
+void FWwiseMetadataLoadable::CheckRequestedValues(const FWwiseMetadataJsonValue& JsonObject)
 {
 	TArray<FString> Keys;
-	JsonObject->Values.GetKeys(Keys);
+	JsonObject.GetKeys(Keys);
 	auto Diff = TSet<FString>(Keys).Difference(RequestedValues);
 	for (const auto& Key : Diff)
 	{
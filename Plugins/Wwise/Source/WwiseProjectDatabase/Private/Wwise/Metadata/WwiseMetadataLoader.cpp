@@ -14,8 +14,6 @@ Copyright (c) 2022 Audiokinetic Inc.
 *******************************************************************************/
 
 #include "Wwise/Metadata/WwiseMetadataLoader.h"
-
-#include "Json.h"
 #include <inttypes.h>
 
 #include "Wwise/Metadata/WwiseMetadataLoadable.h"
@@ -74,13 +72,30 @@ bool FWwiseMetadataLoader::GetBool(FWwiseMetadataLoadable* Object, const FString
 	check(Object);
 	Object->AddRequestedValue(TEXT("bool"), FieldName);
 
+	if (SnapshotReader)
+	{
+		bool Value = false;
+		if (!SnapshotReader->ReadTag(EWwiseMetadataSnapshotTag::Bool) || !SnapshotReader->Read(Value))
+		{
+			FailSnapshot();
+		}
+		Object->IncLoadedSize(sizeof(Value));
+		return Value;
+	}
+
 	bool Value = false;
 
-	if (!JsonObject->TryGetBoolField(FieldName, Value) && Required == EWwiseRequiredMetadata::Mandatory)
+	if (!JsonObject.TryGetBoolField(FieldName, Value) && Required == EWwiseRequiredMetadata::Mandatory)
 	{
 		Fail(*FieldName);
 	}
 
+	if (SnapshotWriter)
+	{
+		SnapshotWriter->WriteTag(EWwiseMetadataSnapshotTag::Bool);
+		SnapshotWriter->Write(Value);
+	}
+
 	Object->IncLoadedSize(sizeof(Value));
 	return Value;
 }
@@ -90,13 +105,30 @@ float FWwiseMetadataLoader::GetFloat(FWwiseMetadataLoadable* Object, const FStri
 	check(Object);
 	Object->AddRequestedValue(TEXT("float"), FieldName);
 
+	if (SnapshotReader)
+	{
+		float Value = 0.f;
+		if (!SnapshotReader->ReadTag(EWwiseMetadataSnapshotTag::Float) || !SnapshotReader->Read(Value))
+		{
+			FailSnapshot();
+		}
+		Object->IncLoadedSize(sizeof(double));
+		return Value;
+	}
+
 	double Value{};
 
-	if (!JsonObject->TryGetNumberField(FieldName, Value) && Required == EWwiseRequiredMetadata::Mandatory)
+	if (!JsonObject.TryGetNumberField(FieldName, Value) && Required == EWwiseRequiredMetadata::Mandatory)
 	{
 		Fail(*FieldName);
 	}
 
+	if (SnapshotWriter)
+	{
+		SnapshotWriter->WriteTag(EWwiseMetadataSnapshotTag::Float);
+		SnapshotWriter->Write(float(Value));
+	}
+
 	Object->IncLoadedSize(sizeof(Value));
 	return float(Value);
 }
@@ -106,10 +138,21 @@ FGuid FWwiseMetadataLoader::GetGuid(FWwiseMetadataLoadable* Object, const FStrin
 	check(Object);
 	Object->AddRequestedValue(TEXT("guid"), FieldName);
 
+	if (SnapshotReader)
+	{
+		FGuid Value;
+		if (!SnapshotReader->ReadTag(EWwiseMetadataSnapshotTag::Guid) || !SnapshotReader->Read(Value))
+		{
+			FailSnapshot();
+		}
+		Object->IncLoadedSize(sizeof(Value));
+		return Value;
+	}
+
 	FGuid Value{};
 
 	FString ValueAsString;
-	if (!JsonObject->TryGetStringField(FieldName, ValueAsString))
+	if (!JsonObject.TryGetStringField(FieldName, ValueAsString))
 	{
 		if (Required == EWwiseRequiredMetadata::Mandatory)
 		{
@@ -130,6 +173,12 @@ FGuid FWwiseMetadataLoader::GetGuid(FWwiseMetadataLoadable* Object, const FStrin
 		}
 	}
 
+	if (SnapshotWriter)
+	{
+		SnapshotWriter->WriteTag(EWwiseMetadataSnapshotTag::Guid);
+		SnapshotWriter->Write(Value);
+	}
+
 	Object->IncLoadedSize(sizeof(Value));
 	return Value;
 }
@@ -139,13 +188,30 @@ FString FWwiseMetadataLoader::GetString(FWwiseMetadataLoadable* Object, const FS
 	check(Object);
 	Object->AddRequestedValue(TEXT("string"), FieldName);
 
+	if (SnapshotReader)
+	{
+		FString Value;
+		if (!SnapshotReader->ReadTag(EWwiseMetadataSnapshotTag::String) || !SnapshotReader->Read(Value))
+		{
+			FailSnapshot();
+		}
+		Object->IncLoadedSize(sizeof(Value) + Value.GetAllocatedSize());
+		return Value;
+	}
+
 	FString Value{};
 
-	if (!JsonObject->TryGetStringField(FieldName, Value) && Required == EWwiseRequiredMetadata::Mandatory)
+	if (!JsonObject.TryGetStringField(FieldName, Value) && Required == EWwiseRequiredMetadata::Mandatory)
 	{
 		Fail(*FieldName);
 	}
 
+	if (SnapshotWriter)
+	{
+		SnapshotWriter->WriteTag(EWwiseMetadataSnapshotTag::String);
+		SnapshotWriter->Write(Value);
+	}
+
 	Object->IncLoadedSize(sizeof(Value) + Value.GetAllocatedSize());
 	return Value;
 }
@@ -155,13 +221,30 @@ uint32 FWwiseMetadataLoader::GetUint32(FWwiseMetadataLoadable* Object, const FSt
 	check(Object);
 	Object->AddRequestedValue(TEXT("uint32"), FieldName);
 
+	if (SnapshotReader)
+	{
+		uint32 Value = 0;
+		if (!SnapshotReader->ReadTag(EWwiseMetadataSnapshotTag::Uint32) || !SnapshotReader->Read(Value))
+		{
+			FailSnapshot();
+		}
+		Object->IncLoadedSize(sizeof(Value));
+		return Value;
+	}
+
 	uint32 Value{};
 
-	if (!JsonObject->TryGetNumberField(FieldName, Value) && Required == EWwiseRequiredMetadata::Mandatory)
+	if (!JsonObject.TryGetNumberField(FieldName, Value) && Required == EWwiseRequiredMetadata::Mandatory)
 	{
 		Fail(*FieldName);
 	}
 
+	if (SnapshotWriter)
+	{
+		SnapshotWriter->WriteTag(EWwiseMetadataSnapshotTag::Uint32);
+		SnapshotWriter->Write(Value);
+	}
+
 	Object->IncLoadedSize(sizeof(Value));
 	return Value;
 }
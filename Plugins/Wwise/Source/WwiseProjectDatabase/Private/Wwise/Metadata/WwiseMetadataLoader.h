@@ -15,9 +15,11 @@ Copyright (c) 2022 Audiokinetic Inc.
 
 #pragma once
 
-#include "Dom/JsonObject.h"
+#include "Misc/ScopeExit.h"
+#include "Wwise/Metadata/WwiseMetadataJson.h"
 #include "Wwise/Metadata/WwiseMetadataLoadable.h"
 #include "Wwise/Metadata/WwiseMetaDataGameParameter.h"
+#include "Wwise/Metadata/WwiseMetadataSnapshot.h"
 
 enum class EWwiseRequiredMetadata
 {
@@ -25,14 +27,33 @@ enum class EWwiseRequiredMetadata
 	Mandatory
 };
 
+/**
+ * @brief Feeds the metadata constructors with values.
+ *
+ * Values are either read from a tokenized Json object, optionally recording them in a snapshot, or replayed from a
+ * previously recorded snapshot. Since the metadata constructors request their values in a deterministic order,
+ * replaying the snapshot rebuilds the same metadata without parsing the Json file.
+*/
 struct FWwiseMetadataLoader
 {
 	bool bResult;
-	const TSharedRef<FJsonObject>& JsonObject;
+	FWwiseMetadataJsonValue JsonObject;
+	FWwiseMetadataSnapshotWriter* SnapshotWriter;
+	FWwiseMetadataSnapshotReader* SnapshotReader;
 
-	FWwiseMetadataLoader(const TSharedRef<FJsonObject>& InJsonObject) :
+	FWwiseMetadataLoader(const FWwiseMetadataJsonValue& InJsonObject, FWwiseMetadataSnapshotWriter* InSnapshotWriter = nullptr) :
 		bResult(true),
-		JsonObject(InJsonObject)
+		JsonObject(InJsonObject),
+		SnapshotWriter(InSnapshotWriter),
+		SnapshotReader(nullptr)
+	{
+	}
+
+	FWwiseMetadataLoader(FWwiseMetadataSnapshotReader& InSnapshotReader) :
+		bResult(true),
+		JsonObject(),
+		SnapshotWriter(nullptr),
+		SnapshotReader(&InSnapshotReader)
 	{
 	}
 
@@ -56,6 +77,13 @@ struct FWwiseMetadataLoader
 
 	template<typename T>
 	void GetPropertyArray(T* Object, const TMap<FString, size_t>& FloatProperties);
+
+private:
+	/** Marks a snapshot as unusable. Doesn't log errors, as the caller falls back to parsing the Json file. */
+	void FailSnapshot()
+	{
+		bResult = false;
+	}
 };
 
 template<typename T>
@@ -64,18 +92,34 @@ T FWwiseMetadataLoader::GetObject(FWwiseMetadataLoadable* Object, const FString&
 	check(Object);
 	Object->AddRequestedValue(TEXT("object"), FieldName);
 
-	const TSharedPtr<FJsonObject>* InnerObject;
-	if (!JsonObject->TryGetObjectField(FieldName, InnerObject))
+	if (SnapshotReader)
+	{
+		if (!SnapshotReader->ReadTag(EWwiseMetadataSnapshotTag::Object))
+		{
+			FailSnapshot();
+			return T{};
+		}
+		FWwiseMetadataLoader ObjectLoader(*SnapshotReader);
+		T Result(ObjectLoader);
+		bResult &= ObjectLoader.bResult;
+		return Result;
+	}
+
+	FWwiseMetadataJsonValue InnerObject;
+	if (!JsonObject.TryGetObjectField(FieldName, InnerObject))
 	{
 		Fail(*FieldName);
 		return T{};
 	}
-	auto SharedRef(InnerObject->ToSharedRef());
-	FWwiseMetadataLoader ObjectLoader(SharedRef);
+	if (SnapshotWriter)
+	{
+		SnapshotWriter->WriteTag(EWwiseMetadataSnapshotTag::Object);
+	}
+	FWwiseMetadataLoader ObjectLoader(InnerObject, SnapshotWriter);
 	T Result(ObjectLoader);
 	if (ObjectLoader.bResult)
 	{
-		Result.CheckRequestedValues(SharedRef);
+		Result.CheckRequestedValues(InnerObject);
 	}
 	else
 	{
@@ -93,20 +137,48 @@ T* FWwiseMetadataLoader::GetObjectPtr(FWwiseMetadataLoadable* Object, const FStr
 	check(Object);
 	Object->AddRequestedValue(TEXT("optional object"), FieldName);
 
-	const TSharedPtr<FJsonObject>* InnerObject;
-	if (!JsonObject->TryGetObjectField(FieldName, InnerObject))
+	if (SnapshotReader)
+	{
+		bool bPresent = false;
+		if (!SnapshotReader->ReadTag(EWwiseMetadataSnapshotTag::OptionalObject) || !SnapshotReader->Read(bPresent))
+		{
+			FailSnapshot();
+			return nullptr;
+		}
+		if (!bPresent)
+		{
+			return nullptr;
+		}
+		FWwiseMetadataLoader ObjectLoader(*SnapshotReader);
+		T* Result = new T(ObjectLoader);
+		if (!ObjectLoader.bResult)
+		{
+			FailSnapshot();
+			delete Result;
+			return nullptr;
+		}
+		return Result;
+	}
+
+	FWwiseMetadataJsonValue InnerObject;
+	const bool bPresent = JsonObject.TryGetObjectField(FieldName, InnerObject);
+	if (SnapshotWriter)
+	{
+		SnapshotWriter->WriteTag(EWwiseMetadataSnapshotTag::OptionalObject);
+		SnapshotWriter->Write(bPresent);
+	}
+	if (!bPresent)
 	{
 		return nullptr;
 	}
 
-	auto SharedRef(InnerObject->ToSharedRef());
-	FWwiseMetadataLoader ObjectLoader(SharedRef);
+	FWwiseMetadataLoader ObjectLoader(InnerObject, SnapshotWriter);
 	T* Result = new T(ObjectLoader);
 	if (ObjectLoader.bResult)
 	{
 		if (Result)
 		{
-			Result->CheckRequestedValues(SharedRef);
+			Result->CheckRequestedValues(InnerObject);
 		}
 	}
 	else
@@ -126,33 +198,76 @@ TArray<T> FWwiseMetadataLoader::GetArray(FWwiseMetadataLoadable* Object, const F
 	check(Object);
 	Object->AddRequestedValue(TEXT("array"), FieldName);
 
-	const TArray< TSharedPtr<FJsonValue> >* Array;
-	if (!JsonObject->TryGetArrayField(FieldName, Array))
+	if (SnapshotReader)
+	{
+		int32 Num = 0;
+		if (!SnapshotReader->ReadTag(EWwiseMetadataSnapshotTag::Array) || !SnapshotReader->Read(Num) || Num < 0)
+		{
+			FailSnapshot();
+			return TArray<T>{};
+		}
+
+		TArray<T> Result;
+		Result.Empty(Num);
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			FWwiseMetadataLoader ArrayLoader(*SnapshotReader);
+			T ResultObject(ArrayLoader);
+			if (!ArrayLoader.bResult)
+			{
+				FailSnapshot();
+				Result.Empty();
+				break;
+			}
+			Result.Add(MoveTemp(ResultObject));
+		}
+
+		Object->IncLoadedSize(sizeof(TArray<T>));
+		return Result;
+	}
+
+	TArray<FWwiseMetadataJsonValue> Array;
+	if (!JsonObject.TryGetArrayField(FieldName, Array))
 	{
 		// No data. Not a fail, valid!
+		if (SnapshotWriter)
+		{
+			SnapshotWriter->WriteTag(EWwiseMetadataSnapshotTag::Array);
+			SnapshotWriter->Write(int32(0));
+		}
 		Object->IncLoadedSize(sizeof(TArray<T>));
 		return TArray<T>{};
 	}
 
+	if (SnapshotWriter)
+	{
+		// Non-object values are skipped below. The recorded count must only include the objects.
+		int32 NumObjects = 0;
+		for (const auto& InnerObject : Array)
+		{
+			NumObjects += InnerObject.IsObject() ? 1 : 0;
+		}
+		SnapshotWriter->WriteTag(EWwiseMetadataSnapshotTag::Array);
+		SnapshotWriter->Write(NumObjects);
+	}
+
 	TArray<T> Result;
-	Result.Empty(Array->Num());
+	Result.Empty(Array.Num());
 
-	for (auto& InnerObject : *Array)
+	for (const auto& InnerObject : Array)
 	{
-		const TSharedPtr<FJsonObject>* InnerJsonObjectPtr;
-		if (!InnerObject->TryGetObject(InnerJsonObjectPtr))
+		if (!InnerObject.IsObject())
 		{
 			LogParsed(*FieldName);
 			continue;
 		}
 		
-		auto SharedRef(InnerJsonObjectPtr->ToSharedRef());
-		FWwiseMetadataLoader ArrayLoader(SharedRef);
+		FWwiseMetadataLoader ArrayLoader(InnerObject, SnapshotWriter);
 		T ResultObject(ArrayLoader);
 
 		if (ArrayLoader.bResult)
 		{
-			ResultObject.CheckRequestedValues(SharedRef);
+			ResultObject.CheckRequestedValues(InnerObject);
 		}
 		else
 		{
@@ -177,36 +292,77 @@ void FWwiseMetadataLoader::GetPropertyArray(T* Object, const TMap<FString, size_
 
 	Object->IncLoadedSize(FloatProperties.Num() * sizeof(float));
 
-	const TArray< TSharedPtr<FJsonValue> >* Array;
-	if (!JsonObject->TryGetArrayField(TEXT("Properties"), Array))
+	if (SnapshotReader)
+	{
+		int32 Num = 0;
+		if (!SnapshotReader->ReadTag(EWwiseMetadataSnapshotTag::PropertyArray) || !SnapshotReader->Read(Num) || Num < 0)
+		{
+			FailSnapshot();
+			return;
+		}
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			FString Name;
+			float Value = 0.f;
+			if (!SnapshotReader->Read(Name) || !SnapshotReader->Read(Value))
+			{
+				FailSnapshot();
+				return;
+			}
+			const auto* Property = FloatProperties.Find(Name);
+			if (!Property)
+			{
+				FailSnapshot();
+				return;
+			}
+			*(float*)((intptr_t)Object + *Property) = Value;
+		}
+		return;
+	}
+
+	TArray<TTuple<FString, float>> RecordedProperties;
+	ON_SCOPE_EXIT
+	{
+		if (SnapshotWriter)
+		{
+			SnapshotWriter->WriteTag(EWwiseMetadataSnapshotTag::PropertyArray);
+			SnapshotWriter->Write(RecordedProperties.Num());
+			for (const auto& RecordedProperty : RecordedProperties)
+			{
+				SnapshotWriter->Write(RecordedProperty.Get<0>());
+				SnapshotWriter->Write(RecordedProperty.Get<1>());
+			}
+		}
+	};
+
+	TArray<FWwiseMetadataJsonValue> Array;
+	if (!JsonObject.TryGetArrayField(TEXT("Properties"), Array))
 	{
 		// No data. Not a fail, valid!
 		return;
 	}
 
-	for (auto& InnerObject : *Array)
+	for (const auto& InnerObject : Array)
 	{
-		const TSharedPtr<FJsonObject>* InnerJsonObjectPtr;
-		if (!InnerObject->TryGetObject(InnerJsonObjectPtr))
+		if (!InnerObject.IsObject())
 		{
 			continue;
 		}
 
-		auto SharedRef(InnerJsonObjectPtr->ToSharedRef());
 		FString Name;
-		if (!SharedRef->TryGetStringField(TEXT("Name"), Name))
+		if (!InnerObject.TryGetStringField(TEXT("Name"), Name))
 		{
 			Fail(TEXT("Property::Name"));
 			continue;
 		}
 		FString Type;
-		if (!SharedRef->TryGetStringField(TEXT("Type"), Type) || Type != TEXT("Real32"))
+		if (!InnerObject.TryGetStringField(TEXT("Type"), Type) || Type != TEXT("Real32"))
 		{
 			Fail(TEXT("Property::Type"));
 			continue;
 		}
 		double Value;
-		if (!SharedRef->TryGetNumberField(TEXT("Value"), Value))
+		if (!InnerObject.TryGetNumberField(TEXT("Value"), Value))
 		{
 			Fail(TEXT("Property::Value"));
 			continue;
@@ -214,6 +370,10 @@ void FWwiseMetadataLoader::GetPropertyArray(T* Object, const TMap<FString, size_
 		if (const auto* Property = FloatProperties.Find(Name))
 		{
 			*(float*)((intptr_t)Object + *Property) = Value;
+			if (SnapshotWriter)
+			{
+				RecordedProperties.Emplace(Name, float(Value));
+			}
 		}
 		else
 		{
@@ -16,14 +16,14 @@ Copyright (c) 2022 Audiokinetic Inc.
 #include "Wwise/Metadata/WwiseMetadataRootFile.h"
 
 #include "Misc/FileHelper.h"
-#include "Serialization/JsonReader.h"
-#include "Serialization/JsonSerializer.h"
 
 #include "Wwise/Metadata/WwiseMetadataPlatformInfo.h"
 #include "Wwise/Metadata/WwiseMetadataPluginInfo.h"
 #include "Wwise/Metadata/WwiseMetadataProjectInfo.h"
 #include "Wwise/Metadata/WwiseMetadataSoundBanksInfo.h"
+#include "Wwise/Metadata/WwiseMetadataJson.h"
 #include "Wwise/Metadata/WwiseMetadataLoader.h"
+#include "Wwise/Metadata/WwiseMetadataSnapshot.h"
 #include "Wwise/Stats/ProjectDatabase.h"
 
 #include "AkUEFeatures.h"
@@ -32,7 +32,8 @@ FWwiseMetadataRootFile::FWwiseMetadataRootFile(FWwiseMetadataLoader& Loader) :
 	PlatformInfo(Loader.GetObjectPtr<FWwiseMetadataPlatformInfo>(this, TEXT("PlatformInfo"))),
 	PluginInfo(Loader.GetObjectPtr<FWwiseMetadataPluginInfo>(this, TEXT("PluginInfo"))),
 	ProjectInfo(Loader.GetObjectPtr<FWwiseMetadataProjectInfo>(this, TEXT("ProjectInfo"))),
-	SoundBanksInfo(Loader.GetObjectPtr<FWwiseMetadataSoundBanksInfo>(this, TEXT("SoundBanksInfo")))
+	SoundBanksInfo(Loader.GetObjectPtr<FWwiseMetadataSoundBanksInfo>(this, TEXT("SoundBanksInfo"))),
+	FileHash(0)
 {
 	if (Loader.bResult && !PlatformInfo && !PluginInfo && !ProjectInfo && !SoundBanksInfo)
 	{
@@ -84,14 +85,7 @@ public:
 protected:
 	void DoWork()
 	{
-		FString FileContents;
-		if (!FFileHelper::LoadFileToString(FileContents, *FilePath))
-		{
-			UE_LOG(LogWwiseProjectDatabase, Error, TEXT("Error while loading file %s to string"), *FilePath);
-			return;
-		}
-
-		Output = FWwiseMetadataRootFile::LoadFile(MoveTemp(FileContents), *FilePath);
+		Output = FWwiseMetadataRootFile::LoadFile(FilePath);
 	}
 
 	FORCEINLINE TStatId GetStatId() const
@@ -100,19 +94,27 @@ protected:
 	}
 };
 
-WwiseMetadataSharedRootFilePtr FWwiseMetadataRootFile::LoadFile(FString&& File, const FString& FilePath)
+WwiseMetadataSharedRootFilePtr FWwiseMetadataRootFile::LoadFile(TArray<uint8>&& Utf8File, const FString& FilePath, FWwiseMetadataSnapshotWriter* SnapshotWriter)
 {
+	// The tokenizer only handles UTF-8. Other encodings go through a string conversion first.
+	if (Utf8File.Num() >= 2 && ((Utf8File[0] == 0xFF && Utf8File[1] == 0xFE) || (Utf8File[0] == 0xFE && Utf8File[1] == 0xFF)))
+	{
+		FString File;
+		FFileHelper::BufferToString(File, Utf8File.GetData(), Utf8File.Num());
+		return LoadFile(MoveTemp(File), FilePath, SnapshotWriter);
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_WwiseProjectDatabaseParseJson);
 	UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("Parsing file in: %s"), *FilePath);
 
-	auto JsonReader = TJsonReaderFactory<>::Create(MoveTemp(File));
-	TSharedPtr<FJsonObject> RootJsonObject;
-	if (!FJsonSerializer::Deserialize(JsonReader, RootJsonObject))
+	FWwiseMetadataJsonDocument Document;
+	if (!Document.Parse(MoveTemp(Utf8File)))
 	{
-		UE_LOG(LogWwiseProjectDatabase, Error, TEXT("Error while decoding json"));
+		UE_LOG(LogWwiseProjectDatabase, Error, TEXT("Error while decoding json in %s"), *FilePath);
 		return {};
 	}
 
-	FWwiseMetadataLoader Loader(RootJsonObject.ToSharedRef());
+	FWwiseMetadataLoader Loader(Document.GetRoot(), SnapshotWriter);
 	auto Result = MakeShared<FWwiseMetadataRootFile>(Loader);
 
 	if (!Loader.bResult)
@@ -124,16 +126,39 @@ WwiseMetadataSharedRootFilePtr FWwiseMetadataRootFile::LoadFile(FString&& File,
 	return Result;
 }
 
+WwiseMetadataSharedRootFilePtr FWwiseMetadataRootFile::LoadFile(FString&& File, const FString& FilePath, FWwiseMetadataSnapshotWriter* SnapshotWriter)
+{
+	FTCHARToUTF8 Converted(*File, File.Len());
+	File.Empty();
+	TArray<uint8> Utf8File((const uint8*)Converted.Get(), Converted.Length());
+	return LoadFile(MoveTemp(Utf8File), FilePath, SnapshotWriter);
+}
+
 WwiseMetadataSharedRootFilePtr FWwiseMetadataRootFile::LoadFile(const FString& FilePath)
 {
-	FString FileContents;
-	if (!FFileHelper::LoadFileToString(FileContents, *FilePath))
+	TArray<uint8> FileBytes;
+	if (!FFileHelper::LoadFileToArray(FileBytes, *FilePath))
 	{
 		UE_LOG(LogWwiseProjectDatabase, Error, TEXT("Error while loading file %s to string"), *FilePath);
 		return nullptr;
 	}
 
-	return LoadFile(MoveTemp(FileContents), FilePath);
+	// Rebuild from the binary snapshot when the generated file didn't change since it was last parsed
+	const uint64 FileHash = CityHash64((const char*)FileBytes.GetData(), FileBytes.Num());
+	if (auto Result = FWwiseMetadataSnapshot::Load(FilePath, FileHash))
+	{
+		Result->FileHash = FileHash;
+		return Result;
+	}
+
+	FWwiseMetadataSnapshotWriter SnapshotWriter;
+	auto Result = LoadFile(MoveTemp(FileBytes), FilePath, &SnapshotWriter);
+	if (Result)
+	{
+		Result->FileHash = FileHash;
+		FWwiseMetadataSnapshot::Save(FilePath, FileHash, SnapshotWriter);
+	}
+	return Result;
 }
 
 WwiseMetadataFileMap FWwiseMetadataRootFile::LoadFiles(const TArray<FString>& FilePaths)
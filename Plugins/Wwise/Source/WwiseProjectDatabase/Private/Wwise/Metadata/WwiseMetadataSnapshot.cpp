@@ -0,0 +1,124 @@
+/*******************************************************************************
+The content of the files in this repository include portions of the
+AUDIOKINETIC Wwise Technology released in source code form as part of the SDK
+package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use these files in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+Copyright (c) 2022 Audiokinetic Inc.
+*******************************************************************************/
+
+#include "Wwise/Metadata/WwiseMetadataSnapshot.h"
+
+#include "Wwise/Metadata/WwiseMetadataLoader.h"
+#include "Wwise/Metadata/WwiseMetadataRootFile.h"
+#include "Wwise/Stats/ProjectDatabase.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include <inttypes.h>
+
+FString FWwiseMetadataSnapshot::GetSnapshotPath(const FString& InFilePath)
+{
+	const FString FullPath = FPaths::ConvertRelativePathToFull(InFilePath);
+	const uint64 PathHash = CityHash64((const char*)*FullPath, FullPath.Len() * sizeof(TCHAR));
+	return FPaths::ProjectIntermediateDir() / TEXT("WwiseProjectDatabase") / FString::Printf(TEXT("%016" PRIx64 ".snapshot"), PathHash);
+}
+
+WwiseMetadataSharedRootFilePtr FWwiseMetadataSnapshot::Load(const FString& InFilePath, uint64 InFileHash)
+{
+	const FString SnapshotPath = GetSnapshotPath(InFilePath);
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*SnapshotPath))
+	{
+		return {};
+	}
+
+	// Map the snapshot when possible. Fallback to reading it in memory.
+	TUniquePtr<IMappedFileHandle> MappedHandle(PlatformFile.OpenMapped(*SnapshotPath));
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray<uint8> Buffer;
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+	if (MappedHandle)
+	{
+		MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+	}
+	if (MappedRegion)
+	{
+		Data = MappedRegion->GetMappedPtr();
+		Size = MappedRegion->GetMappedSize();
+	}
+	else if (FFileHelper::LoadFileToArray(Buffer, *SnapshotPath, FILEREAD_Silent))
+	{
+		Data = Buffer.GetData();
+		Size = Buffer.Num();
+	}
+	else
+	{
+		return {};
+	}
+
+	FWwiseMetadataSnapshotReader Reader(Data, Size);
+	uint32 SnapshotMagic = 0;
+	uint32 SnapshotVersion = 0;
+	uint64 SnapshotFileHash = 0;
+	if (!Reader.Read(SnapshotMagic) || !Reader.Read(SnapshotVersion) || !Reader.Read(SnapshotFileHash)
+		|| SnapshotMagic != Magic || SnapshotVersion != Version)
+	{
+		UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("Ignoring incompatible snapshot %s for %s"), *SnapshotPath, *InFilePath);
+		return {};
+	}
+	if (SnapshotFileHash != InFileHash)
+	{
+		UE_LOG(LogWwiseProjectDatabase, VeryVerbose, TEXT("Snapshot for %s is out of date"), *InFilePath);
+		return {};
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_WwiseProjectDatabaseLoadSnapshot);
+	UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("Loading snapshot for: %s"), *InFilePath);
+	FWwiseMetadataLoader Loader(Reader);
+	auto Result = MakeShared<FWwiseMetadataRootFile>(Loader);
+	if (!Loader.bResult || !Reader.IsAtEnd())
+	{
+		UE_LOG(LogWwiseProjectDatabase, Log, TEXT("Discarding invalid snapshot %s for %s"), *SnapshotPath, *InFilePath);
+		return {};
+	}
+	return Result;
+}
+
+void FWwiseMetadataSnapshot::Save(const FString& InFilePath, uint64 InFileHash, const FWwiseMetadataSnapshotWriter& InSnapshotWriter)
+{
+	const FString SnapshotPath = GetSnapshotPath(InFilePath);
+
+	TArray<uint8> Contents;
+	Contents.Reserve(sizeof(Magic) + sizeof(Version) + sizeof(InFileHash) + InSnapshotWriter.GetData().Num());
+	{
+		FMemoryWriter Writer(Contents, true);
+		uint32 SnapshotMagic = Magic;
+		uint32 SnapshotVersion = Version;
+		uint64 SnapshotFileHash = InFileHash;
+		Writer << SnapshotMagic << SnapshotVersion << SnapshotFileHash;
+	}
+	Contents.Append(InSnapshotWriter.GetData());
+
+	// Write to a temporary file first, so a concurrent load never sees a partial snapshot.
+	const FString TempPath = FPaths::CreateTempFilename(*FPaths::GetPath(SnapshotPath), TEXT("Snapshot"), TEXT(".tmp"));
+	if (!FFileHelper::SaveArrayToFile(Contents, *TempPath)
+		|| !IFileManager::Get().Move(*SnapshotPath, *TempPath, true, true, false, true))
+	{
+		UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("Could not write snapshot %s for %s"), *SnapshotPath, *InFilePath);
+		IFileManager::Get().Delete(*TempPath, false, false, true);
+		return;
+	}
+	UE_LOG(LogWwiseProjectDatabase, VeryVerbose, TEXT("Saved snapshot %s for %s"), *SnapshotPath, *InFilePath);
+}
@@ -0,0 +1,114 @@
+/*******************************************************************************
+The content of the files in this repository include portions of the
+AUDIOKINETIC Wwise Technology released in source code form as part of the SDK
+package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use these files in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+Copyright (c) 2022 Audiokinetic Inc.
+*******************************************************************************/
+
+#pragma once
+
+#include "Wwise/Metadata/WwiseMetadataCollections.h"
+
+#include "Serialization/LargeMemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+enum class EWwiseMetadataSnapshotTag : uint8
+{
+	Bool = 1,
+	Float,
+	Guid,
+	String,
+	Uint32,
+	Object,
+	OptionalObject,
+	Array,
+	PropertyArray
+};
+
+/**
+ * @brief Records the values requested by the metadata constructors while a Json file is parsed.
+*/
+class FWwiseMetadataSnapshotWriter
+{
+public:
+	FWwiseMetadataSnapshotWriter() :
+		Data(),
+		Writer(Data, true)
+	{}
+
+	void WriteTag(EWwiseMetadataSnapshotTag InTag)
+	{
+		uint8 Tag = (uint8)InTag;
+		Writer << Tag;
+	}
+
+	template <typename T>
+	void Write(const T& InValue)
+	{
+		Writer << const_cast<T&>(InValue);
+	}
+
+	const TArray<uint8>& GetData() const { return Data; }
+
+private:
+	TArray<uint8> Data;
+	FMemoryWriter Writer;
+};
+
+/**
+ * @brief Replays the recorded values, in order, from a snapshot in memory.
+ *
+ * The memory is not owned. It is usually a mapped region of the snapshot file.
+*/
+class FWwiseMetadataSnapshotReader
+{
+public:
+	FWwiseMetadataSnapshotReader(const uint8* InData, int64 InSize) :
+		Reader(InData, InSize)
+	{}
+
+	bool ReadTag(EWwiseMetadataSnapshotTag InExpectedTag)
+	{
+		uint8 Tag = 0;
+		Reader << Tag;
+		return !Reader.IsError() && Tag == (uint8)InExpectedTag;
+	}
+
+	template <typename T>
+	bool Read(T& OutValue)
+	{
+		Reader << OutValue;
+		return !Reader.IsError();
+	}
+
+	bool IsAtEnd() { return Reader.AtEnd(); }
+
+private:
+	FLargeMemoryReader Reader;
+};
+
+/**
+ * @brief Binary snapshots of the parsed generated metadata files.
+ *
+ * A snapshot is stored in the project's Intermediate directory for each generated Json file, and is keyed on the
+ * hash of the file contents. As long as the Json file is unchanged, the metadata is rebuilt from the snapshot
+ * instead of being parsed again.
+*/
+struct FWwiseMetadataSnapshot
+{
+	/** Must be bumped whenever a metadata constructor changes the values it requests from FWwiseMetadataLoader. */
+	static constexpr uint32 Version = 1;
+	static constexpr uint32 Magic = 0x534D5757;		// "WWMS"
+
+	static FString GetSnapshotPath(const FString& InFilePath);
+	static WwiseMetadataSharedRootFilePtr Load(const FString& InFilePath, uint64 InFileHash);
+	static void Save(const FString& InFilePath, uint64 InFileHash, const FWwiseMetadataSnapshotWriter& InSnapshotWriter);
+};
@@ -16,5 +16,8 @@ Copyright (c) 2022 Audiokinetic Inc.
 #include "Wwise/Stats/ProjectDatabase.h"
 
 DEFINE_STAT(STAT_WwiseProjectDatabaseMemory);
+DEFINE_STAT(STAT_WwiseProjectDatabaseParseJson);
+DEFINE_STAT(STAT_WwiseProjectDatabaseLoadSnapshot);
+DEFINE_STAT(STAT_WwiseProjectDatabaseUpdateIncrementally);
 
 DEFINE_LOG_CATEGORY(LogWwiseProjectDatabase);
@@ -42,6 +42,8 @@ Copyright (c) 2022 Audiokinetic Inc.
 
 #include "Async/Async.h"
 #include "HAL/PlatformFilemanager.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
 #include "Misc/LocalTimestampDirectoryVisitor.h"
 
 FWwiseDataStructure::FWwiseDataStructure(const FDirectoryPath& InDirectoryPath, const FString* InPlatform, const FGuid* InBasePlatformGuid)
@@ -768,10 +770,43 @@ FWwisePlatformDataStructure& FWwisePlatformDataStructure::operator+=(FWwisePlatf
     Triggers.Append(MoveTemp(Rhs.Triggers));
     States.Append(MoveTemp(Rhs.States));
     Switches.Append(MoveTemp(Rhs.Switches));
+    AudioDevices.Append(MoveTemp(Rhs.AudioDevices));
+    CustomPlugins.Append(MoveTemp(Rhs.CustomPlugins));
+    PluginSharesets.Append(MoveTemp(Rhs.PluginSharesets));
     SwitchContainersByEvent.Append(MoveTemp(Rhs.SwitchContainersByEvent));
+    Guids.Append(MoveTemp(Rhs.Guids));
+    Names.Append(MoveTemp(Rhs.Names));
     return *this;
 }
 
+void FWwisePlatformDataStructure::EmptyRefs()
+{
+    JsonFiles.Empty();
+    AcousticTextures.Empty();
+    AudioDevices.Empty();
+    AuxBusses.Empty();
+    Busses.Empty();
+    CustomPlugins.Empty();
+    DialogueArguments.Empty();
+    DialogueEvents.Empty();
+    Events.Empty();
+    ExternalSources.Empty();
+    GameParameters.Empty();
+    MediaFiles.Empty();
+    PluginLibs.Empty();
+    PluginSharesets.Empty();
+    SoundBanks.Empty();
+    States.Empty();
+    StateGroups.Empty();
+    Switches.Empty();
+    SwitchGroups.Empty();
+    Triggers.Empty();
+    PluginLibNames.Empty();
+    SwitchContainersByEvent.Empty();
+    Guids.Empty();
+    Names.Empty();
+}
+
 void FWwisePlatformDataStructure::GetEventRefs(TArray<FWwiseRefEvent>& OutRefs, const TMap<FWwiseDatabaseEventIdKey, FWwiseRefEvent>& InGlobalMap,
     uint32 InShortId, uint32 InLanguageId, uint32 InSoundBankId, const TCHAR* InDebugName)
 {
@@ -981,3 +1016,202 @@ FWwiseDataStructure& FWwiseDataStructure::operator+=(FWwiseDataStructure&& Rhs)
 
     return *this;
 }
+
+/**
+ * Wwise rewrites the project, platform and plug-in info files on every generation, so their date almost always changes.
+ * When it did, compare the file contents with the hash recorded when the loaded version was parsed.
+*/
+static bool IsGeneratedFileUnchanged(const FWwiseGeneratedFiles::FileTuple& InFile, const FWwiseGeneratedFiles::FileTuple& InLoadedFile, const WwiseMetadataFileMap& InLoadedJsonFiles)
+{
+    const FString& FilePath = InFile.Get<0>();
+    if (FilePath != InLoadedFile.Get<0>())
+    {
+        return false;
+    }
+    if (InFile.Get<1>() == InLoadedFile.Get<1>())
+    {
+        return true;
+    }
+
+    const auto* LoadedJsonFile = InLoadedJsonFiles.Find(FilePath);
+    if (!LoadedJsonFile || !LoadedJsonFile->IsValid() || (*LoadedJsonFile)->FileHash == 0)
+    {
+        return false;
+    }
+    TArray<uint8> FileBytes;
+    if (!FFileHelper::LoadFileToArray(FileBytes, *FilePath))
+    {
+        return false;
+    }
+    return CityHash64((const char*)FileBytes.GetData(), FileBytes.Num()) == (*LoadedJsonFile)->FileHash;
+}
+
+bool FWwiseDataStructure::UpdateIncrementally(const FDirectoryPath& InDirectoryPath, const FString* InPlatform, const FGuid* InBasePlatformGuid, TSet<FGuid>& OutUpdatedGuids)
+{
+    SCOPE_CYCLE_COUNTER(STAT_WwiseProjectDatabaseUpdateIncrementally);
+
+    if (InDirectoryPath.Path.IsEmpty() || Platforms.Num() == 0)
+    {
+        return false;
+    }
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    FWwiseDirectoryVisitor Visitor(PlatformFile, InPlatform, InBasePlatformGuid);
+    PlatformFile.IterateDirectory(*InDirectoryPath.Path, Visitor);
+    auto Directory = Visitor.Get();
+
+    if (!Directory.IsValid())
+    {
+        UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("UpdateIncrementally: Invalid Generated Directory %s"), *InDirectoryPath.Path);
+        return false;
+    }
+    if (!IsGeneratedFileUnchanged(Directory.GeneratedRootFiles.ProjectInfoFile, RootData.GeneratedRootFiles.ProjectInfoFile, RootData.JsonFiles))
+    {
+        UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("UpdateIncrementally: Project info changed. Requires full reload."));
+        return false;
+    }
+    if (Directory.Platforms.Num() != Platforms.Num())
+    {
+        UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("UpdateIncrementally: Platform count changed. Requires full reload."));
+        return false;
+    }
+
+    struct FPlatformUpdate
+    {
+        FWwisePlatformDataStructure* PlatformData;
+        FWwiseGeneratedFiles::FPlatformFiles* Files;
+        TSet<FString> RemovedFiles;
+        WwiseMetadataFileMap UpdatedFiles;
+    };
+    TArray<FPlatformUpdate> Updates;
+    Updates.Reserve(Directory.Platforms.Num());
+
+    for (auto& Platform : Directory.Platforms)
+    {
+        auto* PlatformData = Platforms.Find(Platform.Key);
+        auto& Files = Platform.Value;
+        if (!PlatformData)
+        {
+            UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("UpdateIncrementally: New platform %s. Requires full reload."), *Platform.Key.GetPlatformName());
+            return false;
+        }
+        const auto& OldFiles = PlatformData->GeneratedPlatformFiles;
+        if (!IsGeneratedFileUnchanged(Files.PlatformInfoFile, OldFiles.PlatformInfoFile, PlatformData->JsonFiles)
+            || !IsGeneratedFileUnchanged(Files.PluginInfoFile, OldFiles.PluginInfoFile, PlatformData->JsonFiles))
+        {
+            UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("UpdateIncrementally: Platform %s info files changed. Requires full reload."), *Platform.Key.GetPlatformName());
+            return false;
+        }
+
+        FPlatformUpdate Update{ PlatformData, &Files };
+
+        // Only per-bank metadata files are used as the data structure's source when the platform is set up that way.
+        // Otherwise, the monolithic SoundBanks info file is the only source, and can't be patched.
+        const auto* PlatformInfoFile = PlatformData->JsonFiles.Find(OldFiles.PlatformInfoFile.Get<0>());
+        if (!PlatformInfoFile || !PlatformInfoFile->IsValid() || !(*PlatformInfoFile)->PlatformInfo
+            || !(*PlatformInfoFile)->PlatformInfo->Settings.bGeneratePerBankMetadata)
+        {
+            if (!IsGeneratedFileUnchanged(Files.SoundbanksInfoFile, OldFiles.SoundbanksInfoFile, PlatformData->JsonFiles))
+            {
+                UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("UpdateIncrementally: Platform %s SoundBanks info file changed. Requires full reload."), *Platform.Key.GetPlatformName());
+                return false;
+            }
+            Updates.Add(MoveTemp(Update));
+            continue;
+        }
+
+        TArray<FString> ChangedFiles;
+        for (const auto& MetadataFile : Files.MetadataFiles)
+        {
+            const auto* OldDateTime = OldFiles.MetadataFiles.Find(MetadataFile.Key);
+            if (!OldDateTime || *OldDateTime != MetadataFile.Value)
+            {
+                UE_LOG(LogWwiseProjectDatabase, VeryVerbose, TEXT("- Updating metadata file: %s"), *MetadataFile.Key);
+                ChangedFiles.Add(MetadataFile.Key);
+            }
+        }
+        for (const auto& MetadataFile : OldFiles.MetadataFiles)
+        {
+            if (!Files.MetadataFiles.Contains(MetadataFile.Key))
+            {
+                UE_LOG(LogWwiseProjectDatabase, VeryVerbose, TEXT("- Removing metadata file: %s"), *MetadataFile.Key);
+                Update.RemovedFiles.Add(MetadataFile.Key);
+            }
+        }
+
+        if (ChangedFiles.Num() > 0)
+        {
+            Update.UpdatedFiles = FWwiseMetadataRootFile::LoadFiles(ChangedFiles);
+            for (auto It = Update.UpdatedFiles.CreateIterator(); It; ++It)
+            {
+                if (!It->Value.IsValid())
+                {
+                    UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("UpdateIncrementally: Could not load %s. Requires full reload."), *It->Key);
+                    return false;
+                }
+
+                // Touched, but regenerated with the exact same content. Nothing to update.
+                const auto* OldFile = PlatformData->JsonFiles.Find(It->Key);
+                if (OldFile && OldFile->IsValid() && (*OldFile)->FileHash != 0 && (*OldFile)->FileHash == It->Value->FileHash)
+                {
+                    It.RemoveCurrent();
+                }
+            }
+        }
+        Updates.Add(MoveTemp(Update));
+    }
+
+    // All files were read successfully: we can now apply the changes.
+    int32 UpdatedFileCount = 0;
+    for (auto& Update : Updates)
+    {
+        auto& PlatformData = *Update.PlatformData;
+        const auto& Files = *Update.Files;
+
+        if (Update.UpdatedFiles.Num() > 0 || Update.RemovedFiles.Num() > 0)
+        {
+            for (const auto& Guid : PlatformData.Guids)
+            {
+                if (!Guid.Value.Ref.IsValid() || Update.RemovedFiles.Contains(Guid.Value.Ref->JsonFilePath) || Update.UpdatedFiles.Contains(Guid.Value.Ref->JsonFilePath))
+                {
+                    OutUpdatedGuids.Add(Guid.Key.Guid);
+                }
+            }
+
+            // Objects referenced by many SoundBanks share the same Id key, and the last file defining them owns the ref.
+            // Patching the maps in place would lose or reorder these, so every file is indexed again in the same order
+            // as a full load. Only the changed files were read and parsed: the others reuse their loaded root file.
+            const FString& PlatformInfoPath = Files.PlatformInfoFile.Get<0>();
+            const FString& PluginInfoPath = Files.PluginInfoFile.Get<0>();
+            WwiseMetadataFileMap OrderedFiles;
+            OrderedFiles.Reserve(2 + Files.MetadataFiles.Num());
+            OrderedFiles.Add(PlatformInfoPath, {});        // Unchanged, and already merged in the root data's platform.
+            OrderedFiles.Add(PluginInfoPath, PlatformData.JsonFiles.FindRef(PluginInfoPath));
+            for (const auto& MetadataFile : Files.MetadataFiles)
+            {
+                const auto* UpdatedFile = Update.UpdatedFiles.Find(MetadataFile.Key);
+                OrderedFiles.Add(MetadataFile.Key, UpdatedFile ? *UpdatedFile : PlatformData.JsonFiles.FindRef(MetadataFile.Key));
+            }
+
+            FWwisePlatformDataStructure UpdatedData(PlatformData.Platform, RootData, MoveTemp(OrderedFiles));
+            UpdatedData.JsonFiles[PlatformInfoPath] = PlatformData.JsonFiles.FindRef(PlatformInfoPath);
+            for (const auto& Guid : UpdatedData.Guids)
+            {
+                if (Guid.Value.Ref.IsValid() && Update.UpdatedFiles.Contains(Guid.Value.Ref->JsonFilePath))
+                {
+                    OutUpdatedGuids.Add(Guid.Key.Guid);
+                }
+            }
+
+            PlatformData.EmptyRefs();
+            PlatformData += MoveTemp(UpdatedData);
+        }
+        UpdatedFileCount += Update.UpdatedFiles.Num() + Update.RemovedFiles.Num();
+
+        PlatformData.GeneratedPlatformFiles = MoveTemp(*Update.Files);
+    }
+    RootData.GeneratedRootFiles = MoveTemp(Directory.GeneratedRootFiles);
+
+    UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("UpdateIncrementally: Updated %d metadata files, %d objects changed."), UpdatedFileCount, OutUpdatedGuids.Num());
+    return true;
+}
@@ -58,6 +58,33 @@ void UWwiseProjectDatabaseImpl::UpdateDataStructure(const FDirectoryPath* InUpda
 		SourcePath = ResourceLoaderImpl->GeneratedSoundBanksPath;
 	}
 
+	if (!InUpdateGeneratedSoundBanksPath)
+	{
+		// Partial regeneration: only reload the metadata files that changed, if possible.
+		TSet<FGuid> UpdatedGuids;
+		bool bUpdatedIncrementally;
+		{
+			FWriteScopeLock WLock(LockedDataStructure->Lock);
+			auto& DataStructure = LockedDataStructure.Get();
+			bUpdatedIncrementally = DataStructure.UpdateIncrementally(SourcePath,
+				DisableDefaultPlatforms() ? nullptr : &Platform.GetPlatformName(), InBasePlatformGuid, UpdatedGuids);
+		}
+		if (bUpdatedIncrementally)
+		{
+			++IncrementalUpdateCount;
+			UE_LOG(LogWwiseProjectDatabase, Log, TEXT("UpdateDataStructure: Incrementally updated %d objects in (%s)."), UpdatedGuids.Num(), *SourcePath.Path);
+			UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("UpdateDataStructure: %d incremental updates, %d full reloads so far."), IncrementalUpdateCount, FullUpdateCount);
+			if (Get() == this && UpdatedGuids.Num() > 0)		// Only broadcast database updates on main project.
+			{
+				FWwiseProjectDatabaseDelegates::Get().GetOnDatabaseRefsUpdatedDelegate().Broadcast(UpdatedGuids);
+			}
+			return;
+		}
+	}
+
+	++FullUpdateCount;
+	UE_LOG(LogWwiseProjectDatabase, Verbose, TEXT("UpdateDataStructure: %d incremental updates, %d full reloads so far."), IncrementalUpdateCount, FullUpdateCount);
+
 	{
 		FWriteScopeLock WLock(LockedDataStructure->Lock);
 		auto& DataStructure = LockedDataStructure.Get();
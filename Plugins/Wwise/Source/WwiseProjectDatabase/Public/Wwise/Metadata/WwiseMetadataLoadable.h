@@ -19,8 +19,7 @@ Copyright (c) 2022 Audiokinetic Inc.
 
 #include "CoreMinimal.h"
 
-class FJsonObject;
-class FJsonValue;
+struct FWwiseMetadataJsonValue;
 
 struct WWISEPROJECTDATABASE_API FWwiseMetadataLoadable
 {
@@ -40,7 +39,7 @@ protected:
 
 public:
 	void AddRequestedValue(const FString& Type, const FString& Value);
-	void CheckRequestedValues(TSharedRef<FJsonObject>& JsonObject);
+	void CheckRequestedValues(const FWwiseMetadataJsonValue& JsonObject);
 	void IncLoadedSize(size_t Size);
 	void DecLoadedSize(size_t Size);
 	void UnloadLoadedSize();
@@ -18,6 +18,7 @@ Copyright (c) 2022 Audiokinetic Inc.
 #include "Wwise/Metadata/WwiseMetadataCollections.h"
 #include "Wwise/Metadata/WwiseMetadataLoadable.h"
 
+class FWwiseMetadataSnapshotWriter;
 
 struct WWISEPROJECTDATABASE_API FWwiseMetadataRootFile : public FWwiseMetadataLoadable
 {
@@ -26,10 +27,14 @@ struct WWISEPROJECTDATABASE_API FWwiseMetadataRootFile : public FWwiseMetadataLo
 	FWwiseMetadataProjectInfo* ProjectInfo;
 	FWwiseMetadataSoundBanksInfo* SoundBanksInfo;
 
+	/** Hash of the contents of the file this metadata was loaded from. 0 if unknown. */
+	uint64 FileHash;
+
 	FWwiseMetadataRootFile(FWwiseMetadataLoader& Loader);
 	~FWwiseMetadataRootFile();
 
 	static WwiseMetadataSharedRootFilePtr LoadFile(const FString& FilePath);
-	static WwiseMetadataSharedRootFilePtr LoadFile(FString&& File, const FString& FilePath);
+	static WwiseMetadataSharedRootFilePtr LoadFile(TArray<uint8>&& Utf8File, const FString& FilePath, FWwiseMetadataSnapshotWriter* SnapshotWriter = nullptr);
+	static WwiseMetadataSharedRootFilePtr LoadFile(FString&& File, const FString& FilePath, FWwiseMetadataSnapshotWriter* SnapshotWriter = nullptr);
 	static WwiseMetadataFileMap LoadFiles(const TArray<FString>& FilePaths);
 };
@@ -20,5 +20,8 @@ Copyright (c) 2022 Audiokinetic Inc.
 
 DECLARE_STATS_GROUP(TEXT("WwiseProjectDatabase"), STATGROUP_WwiseProjectDatabase, STATCAT_Wwise);
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Memory"), STAT_WwiseProjectDatabaseMemory, STATGROUP_WwiseProjectDatabase, WWISEPROJECTDATABASE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Parse Json"), STAT_WwiseProjectDatabaseParseJson, STATGROUP_WwiseProjectDatabase, WWISEPROJECTDATABASE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Load Snapshot"), STAT_WwiseProjectDatabaseLoadSnapshot, STATGROUP_WwiseProjectDatabase, WWISEPROJECTDATABASE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Incrementally"), STAT_WwiseProjectDatabaseUpdateIncrementally, STATGROUP_WwiseProjectDatabase, WWISEPROJECTDATABASE_API);
 
 WWISEPROJECTDATABASE_API DECLARE_LOG_CATEGORY_EXTERN(LogWwiseProjectDatabase, Log, All);
@@ -130,6 +130,11 @@ struct WWISEPROJECTDATABASE_API FWwisePlatformDataStructure :
 	FWwisePlatformDataStructure(FWwisePlatformDataStructure&& Rhs);
 	FWwisePlatformDataStructure& operator+=(FWwisePlatformDataStructure&& Rhs);
 
+	/**
+	 * @brief Empties the Json files and all the refs indexed from them. The platform ref is kept.
+	*/
+	void EmptyRefs();
+
 	template <typename RequiredRef>
 	void GetRefMap(TMap<FWwiseSharedLanguageId, RequiredRef>& OutRefMap, const TSet<FWwiseSharedLanguageId>& InLanguages, const FWwiseAssetInfo& InInfo) const;
 
@@ -200,6 +205,19 @@ struct WWISEPROJECTDATABASE_API FWwiseDataStructure
 	~FWwiseDataStructure();
 
 	FWwiseDataStructure& operator+=(FWwiseDataStructure&& Rhs);
+
+	/**
+	 * @brief Updates the data structure with the generated metadata files that changed since it was loaded.
+	 *
+	 * Only the per-SoundBank metadata files can be patched in place. If the project, platform or plug-in info
+	 * files changed, or if the set of platforms is different, the data structure must be fully reloaded.
+	 *
+	 * @param OutUpdatedGuids Receives the GUIDs of the objects that were removed, added or modified.
+	 * @return true if the data structure is up to date. false if a full reload is required, in which case the
+	 *         data structure is left untouched.
+	*/
+	bool UpdateIncrementally(const FDirectoryPath& InDirectoryPath, const FString* InPlatform, const FGuid* InBasePlatformGuid, TSet<FGuid>& OutUpdatedGuids);
+
 	FWwiseDataStructure& operator=(FWwiseDataStructure&& Rhs)
 	{
 		RootData = MoveTemp(Rhs.RootData);
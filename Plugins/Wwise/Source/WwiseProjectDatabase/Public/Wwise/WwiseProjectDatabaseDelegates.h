@@ -16,6 +16,7 @@ Copyright (c) 2022 Audiokinetic Inc.
 #pragma once
 
 DECLARE_MULTICAST_DELEGATE(FOnDatabaseUpdateCompletedDelegate);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnDatabaseRefsUpdatedDelegate, const TSet<FGuid>& /* UpdatedGuids */);
 
 #define DEFINE_WWISE_DATABASE_DELEGATE(DelegateType) \
 	public: F##DelegateType& Get##DelegateType() { return DelegateType; } \
@@ -26,6 +27,9 @@ class WWISEPROJECTDATABASE_API FWwiseProjectDatabaseDelegates
 
 	DEFINE_WWISE_DATABASE_DELEGATE(OnDatabaseUpdateCompletedDelegate);
 
+	/** Broadcast instead of OnDatabaseUpdateCompleted when only part of the database got reloaded. */
+	DEFINE_WWISE_DATABASE_DELEGATE(OnDatabaseRefsUpdatedDelegate);
+
 public:
 	static FWwiseProjectDatabaseDelegates& Get()
 	{
@@ -46,6 +46,10 @@ public:
 protected:
 	FSharedWwiseDataStructure LockedDataStructure;
 
+	/** Number of data structure updates done by patching changed metadata files, and by reloading everything. */
+	int32 IncrementalUpdateCount = 0;
+	int32 FullUpdateCount = 0;
+
 	FSharedWwiseDataStructure& GetLockedDataStructure() override { return LockedDataStructure; }
 	const FSharedWwiseDataStructure& GetLockedDataStructure() const override { return LockedDataStructure; }
 };
\ No newline at end of file
@@ -225,6 +225,425 @@ bool UWwiseResourceLoaderImpl::DefaultUnloadExternalSourceOperation(const FWwise
 	return true;
 }
 
+//
+// Batched resource handling
+//
+
+void FWwiseResourceLoadBatch::Add(const FWwiseAuxBusCookedData& InCookedData)
+{
+	for (const auto& Item : InCookedData.Media)
+	{
+		Media.Add(&Item);
+	}
+	for (const auto& Item : InCookedData.SoundBanks)
+	{
+		SoundBanks.Add(&Item);
+	}
+}
+
+void FWwiseResourceLoadBatch::Add(const FWwiseEventCookedData& InCookedData)
+{
+	for (const auto& Item : InCookedData.Media)
+	{
+		Media.Add(&Item);
+	}
+	for (const auto& Item : InCookedData.ExternalSources)
+	{
+		ExternalSources.Add(&Item);
+	}
+	for (const auto& Item : InCookedData.SoundBanks)
+	{
+		SoundBanks.Add(&Item);
+	}
+}
+
+/**
+ * @brief Shared state of an asynchronous batch operation.
+ *
+ * Each element is handled the same way as the matching Default*Operation function, without waiting on it.
+ *
+ * Every file handler callback holds a reference to this state. The last callback of a phase
+ * starts the next one, so no thread ever waits on another during the operation.
+*/
+class FWwiseResourceLoadBatchState : public TSharedFromThis<FWwiseResourceLoadBatchState, ESPMode::ThreadSafe>
+{
+public:
+	FWwiseResourceLoadBatchState(FWwiseResourceLoadBatch&& InBatch, const FString& InRootPath, const FString& InExternalSourcePath, const FWwiseLanguageCookedData& InLanguage) :
+		Batch(MoveTemp(InBatch)),
+		RootPath(InRootPath),
+		ExternalSourcePath(InExternalSourcePath),
+		Language(InLanguage),
+		PendingCount(0),
+		bFailed(false)
+	{
+		bMediaLoaded.Init(false, Batch.Media.Num());
+		bExternalSourcesLoaded.Init(false, Batch.ExternalSources.Num());
+		bSoundBanksLoaded.Init(false, Batch.SoundBanks.Num());
+	}
+
+	void Load(UWwiseResourceLoaderImpl::FLoadResourceBatchCallback&& InCallback)
+	{
+		LoadCallback = MoveTemp(InCallback);
+		LoadMediaAndExternalSources();
+	}
+
+	void Unload(UWwiseResourceLoaderImpl::FUnloadResourceBatchCallback&& InCallback)
+	{
+		bMediaLoaded.Init(true, Batch.Media.Num());
+		bExternalSourcesLoaded.Init(true, Batch.ExternalSources.Num());
+		bSoundBanksLoaded.Init(true, Batch.SoundBanks.Num());
+		UnloadLoadedResources(MoveTemp(InCallback));
+	}
+
+private:
+	FWwiseResourceLoadBatch Batch;
+	FString RootPath;
+	FString ExternalSourcePath;
+	FWwiseLanguageCookedData Language;
+
+	TArray<bool> bMediaLoaded;
+	TArray<bool> bExternalSourcesLoaded;
+	TArray<bool> bSoundBanksLoaded;
+
+	TAtomic<int32> PendingCount;
+	TAtomic<bool> bFailed;
+	UWwiseResourceLoaderImpl::FLoadResourceBatchCallback LoadCallback;
+
+	/**
+	 * @brief Sets up the pending counter for InCount operations.
+	 *
+	 * The counter holds one extra reference released by FinishDispatch, so a callback that gets
+	 * executed synchronously during the dispatch loop cannot end the phase prematurely.
+	*/
+	void BeginDispatch(int32 InCount)
+	{
+		PendingCount = InCount + 1;
+	}
+
+	bool FinishOperation()
+	{
+		return --PendingCount == 0;
+	}
+
+	void LoadMediaAndExternalSources()
+	{
+		auto* MediaManager = IWwiseMediaManager::Get();
+		auto* ExternalSourceManager = IWwiseExternalSourceManager::Get();
+		if (UNLIKELY(Batch.Media.Num() > 0 && !MediaManager))
+		{
+			UE_LOG(LogWwiseResourceLoader, Error, TEXT("Failed to retrieve Media Manager"));
+			bFailed = true;
+		}
+		if (UNLIKELY(Batch.ExternalSources.Num() > 0 && !ExternalSourceManager))
+		{
+			UE_LOG(LogWwiseResourceLoader, Error, TEXT("Failed to retrieve External Source Manager"));
+			bFailed = true;
+		}
+		if (UNLIKELY(bFailed))
+		{
+			OnLoadFailed();
+			return;
+		}
+
+		BeginDispatch(Batch.Media.Num() + Batch.ExternalSources.Num());
+		for (int32 Index = 0; Index < Batch.Media.Num(); ++Index)
+		{
+			const auto& Media = *Batch.Media[Index];
+			UE_LOG(LogWwiseResourceLoader, VeryVerbose, TEXT("[LoadMedia: %" PRIu32 "] %s at %s"),
+				(uint32)Media.MediaId, *Media.DebugName, *Media.MediaPathName);
+			MediaManager->LoadMedia(Media, RootPath, [State = AsShared(), Index](bool bInResult)
+			{
+				UE_CLOG(!bInResult, LogWwiseResourceLoader, Error, TEXT("LoadResourceBatch: Could not load Media %s (%" PRIu32 ")"),
+					*State->Batch.Media[Index]->DebugName, (uint32)State->Batch.Media[Index]->MediaId);
+				State->bMediaLoaded[Index] = bInResult;
+				State->OnMediaOrExternalSourceLoaded(bInResult);
+			});
+		}
+		for (int32 Index = 0; Index < Batch.ExternalSources.Num(); ++Index)
+		{
+			const auto& ExternalSource = *Batch.ExternalSources[Index];
+			UE_LOG(LogWwiseResourceLoader, VeryVerbose, TEXT("[LoadExternalSource: %" PRIu32 "] %s"),
+				(uint32)ExternalSource.Cookie, *ExternalSource.DebugName);
+			ExternalSourceManager->LoadExternalSource(ExternalSource, ExternalSourcePath, Language, [State = AsShared(), Index](bool bInResult)
+			{
+				UE_CLOG(!bInResult, LogWwiseResourceLoader, Log, TEXT("LoadResourceBatch: Could not load External Source %s (%" PRIu32 ")"),
+					*State->Batch.ExternalSources[Index]->DebugName, (uint32)State->Batch.ExternalSources[Index]->Cookie);
+				State->bExternalSourcesLoaded[Index] = bInResult;
+				State->OnMediaOrExternalSourceLoaded(bInResult);
+			});
+		}
+		OnMediaOrExternalSourceLoaded(true);
+	}
+
+	void OnMediaOrExternalSourceLoaded(bool bInResult)
+	{
+		if (UNLIKELY(!bInResult))
+		{
+			bFailed = true;
+		}
+		if (!FinishOperation())
+		{
+			return;
+		}
+
+		if (UNLIKELY(bFailed))
+		{
+			OnLoadFailed();
+			return;
+		}
+		LoadSoundBanks();
+	}
+
+	void LoadSoundBanks()
+	{
+		auto* SoundBankManager = IWwiseSoundBankManager::Get();
+		if (UNLIKELY(Batch.SoundBanks.Num() > 0 && !SoundBankManager))
+		{
+			UE_LOG(LogWwiseResourceLoader, Error, TEXT("Failed to retrieve SoundBank Manager"));
+			bFailed = true;
+			OnLoadFailed();
+			return;
+		}
+
+		BeginDispatch(Batch.SoundBanks.Num());
+		for (int32 Index = 0; Index < Batch.SoundBanks.Num(); ++Index)
+		{
+			const auto& SoundBank = *Batch.SoundBanks[Index];
+			UE_LOG(LogWwiseResourceLoader, VeryVerbose, TEXT("[LoadSoundBank: %" PRIu32 "] %s at %s"),
+				(uint32)SoundBank.SoundBankId, *SoundBank.DebugName, *SoundBank.SoundBankPathName);
+			SoundBankManager->LoadSoundBank(SoundBank, RootPath, [State = AsShared(), Index](bool bInResult)
+			{
+				UE_CLOG(!bInResult, LogWwiseResourceLoader, Error, TEXT("LoadResourceBatch: Could not load SoundBank %s (%" PRIu32 ")"),
+					*State->Batch.SoundBanks[Index]->DebugName, (uint32)State->Batch.SoundBanks[Index]->SoundBankId);
+				State->bSoundBanksLoaded[Index] = bInResult;
+				State->OnSoundBankLoaded(bInResult);
+			});
+		}
+		OnSoundBankLoaded(true);
+	}
+
+	void OnSoundBankLoaded(bool bInResult)
+	{
+		if (UNLIKELY(!bInResult))
+		{
+			bFailed = true;
+		}
+		if (!FinishOperation())
+		{
+			return;
+		}
+
+		if (UNLIKELY(bFailed))
+		{
+			OnLoadFailed();
+			return;
+		}
+		auto Callback = MoveTemp(LoadCallback);
+		Callback(true);
+	}
+
+	void OnLoadFailed()
+	{
+		UnloadLoadedResources([State = AsShared()]()
+		{
+			auto Callback = MoveTemp(State->LoadCallback);
+			Callback(false);
+		});
+	}
+
+	void UnloadLoadedResources(UWwiseResourceLoaderImpl::FUnloadResourceBatchCallback&& InCallback)
+	{
+		auto* MediaManager = IWwiseMediaManager::Get();
+		auto* ExternalSourceManager = IWwiseExternalSourceManager::Get();
+		auto* SoundBankManager = IWwiseSoundBankManager::Get();
+
+		struct FUnloadState
+		{
+			TAtomic<int32> PendingCount;
+			UWwiseResourceLoaderImpl::FUnloadResourceBatchCallback Callback;
+		};
+		TSharedRef<FUnloadState, ESPMode::ThreadSafe> UnloadState = MakeShared<FUnloadState, ESPMode::ThreadSafe>();
+		UnloadState->PendingCount = 1;
+		UnloadState->Callback = MoveTemp(InCallback);
+		auto OnUnloaded = [UnloadState]()
+		{
+			if (--UnloadState->PendingCount == 0)
+			{
+				auto Callback = MoveTemp(UnloadState->Callback);
+				Callback();
+			}
+		};
+
+		for (int32 Index = 0; Index < Batch.SoundBanks.Num(); ++Index)
+		{
+			if (!bSoundBanksLoaded[Index] || UNLIKELY(!SoundBankManager))
+			{
+				continue;
+			}
+			const auto& SoundBank = *Batch.SoundBanks[Index];
+			UE_LOG(LogWwiseResourceLoader, VeryVerbose, TEXT("[UnloadSoundBank: %" PRIu32 "] %s at %s"),
+				(uint32)SoundBank.SoundBankId, *SoundBank.DebugName, *SoundBank.SoundBankPathName);
+			++UnloadState->PendingCount;
+			SoundBankManager->UnloadSoundBank(SoundBank, RootPath, OnUnloaded);
+		}
+		for (int32 Index = 0; Index < Batch.Media.Num(); ++Index)
+		{
+			if (!bMediaLoaded[Index] || UNLIKELY(!MediaManager))
+			{
+				continue;
+			}
+			const auto& Media = *Batch.Media[Index];
+			UE_LOG(LogWwiseResourceLoader, VeryVerbose, TEXT("[UnloadMedia: %" PRIu32 "] %s at %s"),
+				(uint32)Media.MediaId, *Media.DebugName, *Media.MediaPathName);
+			++UnloadState->PendingCount;
+			MediaManager->UnloadMedia(Media, RootPath, OnUnloaded);
+		}
+		for (int32 Index = 0; Index < Batch.ExternalSources.Num(); ++Index)
+		{
+			if (!bExternalSourcesLoaded[Index] || UNLIKELY(!ExternalSourceManager))
+			{
+				continue;
+			}
+			const auto& ExternalSource = *Batch.ExternalSources[Index];
+			UE_LOG(LogWwiseResourceLoader, VeryVerbose, TEXT("[UnloadExternalSource: %" PRIu32 "] %s"),
+				(uint32)ExternalSource.Cookie, *ExternalSource.DebugName);
+			++UnloadState->PendingCount;
+			ExternalSourceManager->UnloadExternalSource(ExternalSource, ExternalSourcePath, Language, OnUnloaded);
+		}
+		OnUnloaded();
+	}
+};
+
+void UWwiseResourceLoaderImpl::LoadResourceBatchAsync(FWwiseResourceLoadBatch&& InBatch, FLoadResourceBatchCallback&& InCallback)
+{
+	UE_LOG(LogWwiseResourceLoader, Verbose, TEXT("Loading batch of %d Media, %d External Sources and %d SoundBanks"),
+		InBatch.Media.Num(), InBatch.ExternalSources.Num(), InBatch.SoundBanks.Num());
+
+	if (InBatch.IsEmpty())
+	{
+		InCallback(true);
+		return;
+	}
+	if (!CanBatchResources())
+	{
+		InCallback(LoadResourcesIndividually(InBatch));
+		return;
+	}
+
+	auto State = MakeShared<FWwiseResourceLoadBatchState, ESPMode::ThreadSafe>(MoveTemp(InBatch), GetUnrealPath(), GetUnrealExternalSourcePath(), CurrentLanguage);
+	State->Load(MoveTemp(InCallback));
+}
+
+void UWwiseResourceLoaderImpl::UnloadResourceBatchAsync(FWwiseResourceLoadBatch&& InBatch, FUnloadResourceBatchCallback&& InCallback)
+{
+	UE_LOG(LogWwiseResourceLoader, Verbose, TEXT("Unloading batch of %d Media, %d External Sources and %d SoundBanks"),
+		InBatch.Media.Num(), InBatch.ExternalSources.Num(), InBatch.SoundBanks.Num());
+
+	if (InBatch.IsEmpty())
+	{
+		InCallback();
+		return;
+	}
+	if (!CanBatchResources())
+	{
+		UnloadResourcesIndividually(InBatch);
+		InCallback();
+		return;
+	}
+
+	auto State = MakeShared<FWwiseResourceLoadBatchState, ESPMode::ThreadSafe>(MoveTemp(InBatch), GetUnrealPath(), GetUnrealExternalSourcePath(), CurrentLanguage);
+	State->Unload(MoveTemp(InCallback));
+}
+
+bool UWwiseResourceLoaderImpl::LoadResourceBatch(FWwiseResourceLoadBatch&& InBatch)
+{
+	FEventRef WaitForDone;
+	bool bResult = false;
+	LoadResourceBatchAsync(MoveTemp(InBatch), [&WaitForDone, &bResult](bool bInResult)
+	{
+		bResult = bInResult;
+		WaitForDone->Trigger();
+	});
+	WaitForDone->Wait();
+	return bResult;
+}
+
+void UWwiseResourceLoaderImpl::UnloadResourceBatch(FWwiseResourceLoadBatch&& InBatch)
+{
+	FEventRef WaitForDone;
+	UnloadResourceBatchAsync(MoveTemp(InBatch), [&WaitForDone]() { WaitForDone->Trigger(); });
+	WaitForDone->Wait();
+}
+
+bool UWwiseResourceLoaderImpl::CanBatchResources() const
+{
+	return GetClass() == UWwiseResourceLoaderImpl::StaticClass();
+}
+
+bool UWwiseResourceLoaderImpl::LoadResourcesIndividually(const FWwiseResourceLoadBatch& InBatch)
+{
+	TArray<const FWwiseMediaCookedData*> LoadedMedia;
+	TArray<const FWwiseExternalSourceCookedData*> LoadedExternalSources;
+	TArray<const FWwiseSoundBankCookedData*> LoadedSoundBanks;
+	bool bResult = true;
+
+	if (LIKELY(bResult)) for (const auto* Media : InBatch.Media)
+	{
+		if (UNLIKELY(!LoadMediaResources(*Media)))
+		{
+			bResult = false;
+			break;
+		}
+		LoadedMedia.Add(Media);
+	}
+
+	if (LIKELY(bResult)) for (const auto* ExternalSource : InBatch.ExternalSources)
+	{
+		if (UNLIKELY(!LoadExternalSourceResources(*ExternalSource)))
+		{
+			bResult = false;
+			break;
+		}
+		LoadedExternalSources.Add(ExternalSource);
+	}
+
+	if (LIKELY(bResult)) for (const auto* SoundBank : InBatch.SoundBanks)
+	{
+		if (UNLIKELY(!LoadSoundBankResources(*SoundBank)))
+		{
+			bResult = false;
+			break;
+		}
+		LoadedSoundBanks.Add(SoundBank);
+	}
+
+	if (UNLIKELY(!bResult))
+	{
+		FWwiseResourceLoadBatch Rollback;
+		Rollback.Media = MoveTemp(LoadedMedia);
+		Rollback.ExternalSources = MoveTemp(LoadedExternalSources);
+		Rollback.SoundBanks = MoveTemp(LoadedSoundBanks);
+		UnloadResourcesIndividually(Rollback);
+	}
+	return bResult;
+}
+
+void UWwiseResourceLoaderImpl::UnloadResourcesIndividually(const FWwiseResourceLoadBatch& InBatch)
+{
+	for (const auto* SoundBank : InBatch.SoundBanks)
+	{
+		UnloadSoundBankResources(*SoundBank);
+	}
+	for (const auto* Media : InBatch.Media)
+	{
+		UnloadMediaResources(*Media);
+	}
+	for (const auto* ExternalSource : InBatch.ExternalSources)
+	{
+		UnloadExternalSourceResources(*ExternalSource);
+	}
+}
+
 void UWwiseResourceLoaderImpl::SetLanguage(const FWwiseLanguageCookedData& InLanguage, EWwiseReloadLanguage InReloadLanguage)
 {
 	SCOPE_CYCLE_COUNTER(STAT_WwiseResourceLoaderTiming);
@@ -522,50 +941,15 @@ bool UWwiseResourceLoaderImpl::LoadAuxBusResources(const FWwiseAuxBusCookedData&
 	UE_LOG(LogWwiseResourceLoader, Verbose, TEXT("Loading AuxBus %s (%" PRIu32 ") resources"),
 		*InCookedData.DebugName, (uint32)InCookedData.AuxBusId);
 
-	TArray<const FWwiseSoundBankCookedData*> LoadedSoundBanks;
-	TArray<const FWwiseMediaCookedData*> LoadedMedia;
-	bool bResult = true;
-
-	if (LIKELY(bResult)) for (const auto& Media : InCookedData.Media)
-	{
-		if (UNLIKELY(!LoadMediaResources(Media)))
-		{
-			UE_LOG(LogWwiseResourceLoader, Error, TEXT("LoadAuxBusResources: Could not load Media %s (%" PRIu32 ") for AuxBus %s (%" PRIu32 ")"),
-				*Media.DebugName, (uint32)Media.MediaId,
-				*InCookedData.DebugName, (uint32)InCookedData.AuxBusId);
-
-			bResult = false;
-			break;
-		}
-		LoadedMedia.Add(&Media);
-	}
-
-	if (LIKELY(bResult)) for (const auto& SoundBank : InCookedData.SoundBanks)
+	FWwiseResourceLoadBatch Batch;
+	Batch.Add(InCookedData);
+	if (UNLIKELY(!LoadResourceBatch(MoveTemp(Batch))))
 	{
-		if (UNLIKELY(!LoadSoundBankResources(SoundBank)))
-		{
-			UE_LOG(LogWwiseResourceLoader, Error, TEXT("LoadAuxBusResources: Could not load SoundBank %s (%" PRIu32 ") for AuxBus %s (%" PRIu32 ")"),
-				*SoundBank.DebugName, (uint32)SoundBank.SoundBankId,
-				*InCookedData.DebugName, (uint32)InCookedData.AuxBusId);
-
-			bResult = false;
-			break;
-		}
-		LoadedSoundBanks.Add(&SoundBank);
-	}
-
-	if (UNLIKELY(!bResult))
-	{
-		for (const auto* SoundBank : LoadedSoundBanks)
-		{
-			UnloadSoundBankResources(*SoundBank);
-		}
-		for (const auto& Media : LoadedMedia)
-		{
-			UnloadMediaResources(*Media);
-		}
+		UE_LOG(LogWwiseResourceLoader, Error, TEXT("LoadAuxBusResources: Could not load resources for AuxBus %s (%" PRIu32 ")"),
+			*InCookedData.DebugName, (uint32)InCookedData.AuxBusId);
+		return false;
 	}
-	return bResult;
+	return true;
 }
 
 void UWwiseResourceLoaderImpl::UnloadAuxBus(FWwiseLoadedAuxBusListNode* InAuxBusListNode)
@@ -593,14 +977,9 @@ void UWwiseResourceLoaderImpl::UnloadAuxBusResources(const FWwiseAuxBusCookedDat
 	UE_LOG(LogWwiseResourceLoader, Verbose, TEXT("Unloading AuxBus %s (%" PRIu32 ") resources"),
 		*InCookedData.DebugName, (uint32)InCookedData.AuxBusId);
 
-	for (const auto& SoundBank : InCookedData.SoundBanks)
-	{
-		UnloadSoundBankResources(SoundBank);
-	}
-	for (const auto& Media : InCookedData.Media)
-	{
-		UnloadMediaResources(Media);
-	}
+	FWwiseResourceLoadBatch Batch;
+	Batch.Add(InCookedData);
+	UnloadResourceBatch(MoveTemp(Batch));
 }
 
 //
@@ -647,76 +1026,26 @@ bool UWwiseResourceLoaderImpl::LoadEventResources(const FWwiseEventCookedData& I
 	UE_LOG(LogWwiseResourceLoader, Verbose, TEXT("Loading Event %s (%" PRIu32 ") resources"),
 		*InCookedData.DebugName, (uint32)InCookedData.EventId);
 
-	TArray<const FWwiseSoundBankCookedData*> LoadedSoundBanks;
-	TArray<const FWwiseMediaCookedData*> LoadedMedia;
-	TArray<const FWwiseExternalSourceCookedData*> LoadedExternalSources;
-	bool bResult = true;
-
-	if (LIKELY(bResult)) for (const auto& Media : InCookedData.Media)
+	FWwiseResourceLoadBatch Batch;
+	Batch.Add(InCookedData);
+	if (UNLIKELY(!LoadResourceBatch(MoveTemp(Batch))))
 	{
-		if (UNLIKELY(!LoadMediaResources(Media)))
-		{
-			UE_LOG(LogWwiseResourceLoader, Error, TEXT("LoadEventResources: Could not load Media %s (%" PRIu32 ") for Event %s (%" PRIu32 ")"),
-				*Media.DebugName, (uint32)Media.MediaId,
-				*InCookedData.DebugName, (uint32)InCookedData.EventId);
-
-			bResult = false;
-			break;
-		}
-		LoadedMedia.Add(&Media);
-	}
-
-	if (LIKELY(bResult)) for (const auto& ExternalSource : InCookedData.ExternalSources)
-	{
-		if (UNLIKELY(!LoadExternalSourceResources(ExternalSource)))
-		{
-			UE_LOG(LogWwiseResourceLoader, Error, TEXT("LoadEventResources: Could not load External Source %s (%" PRIu32 ") for Event %s (%" PRIu32 ")"),
-				*ExternalSource.DebugName, (uint32)ExternalSource.Cookie,
-				*InCookedData.DebugName, (uint32)InCookedData.EventId);
-
-			bResult = false;
-			break;
-		}
-		LoadedExternalSources.Add(&ExternalSource);
-	}
-
-	if (LIKELY(bResult)) for (const auto& SoundBank : InCookedData.SoundBanks)
-	{
-		if (UNLIKELY(!LoadSoundBankResources(SoundBank)))
-		{
-			UE_LOG(LogWwiseResourceLoader, Error, TEXT("LoadEventResources: Could not load SoundBank %s (%" PRIu32 ") for Event %s (%" PRIu32 ")"),
-				*SoundBank.DebugName, (uint32)SoundBank.SoundBankId,
-				*InCookedData.DebugName, (uint32)InCookedData.EventId);
-
-			bResult = false;
-			break;
-		}
-		LoadedSoundBanks.Add(&SoundBank);
+		UE_LOG(LogWwiseResourceLoader, Error, TEXT("LoadEventResources: Could not load resources for Event %s (%" PRIu32 ")"),
+			*InCookedData.DebugName, (uint32)InCookedData.EventId);
+		return false;
 	}
 
-	if (LIKELY(bResult) && UNLIKELY(!LoadEventSwitchContainerResources(InCookedData)))
+	if (UNLIKELY(!LoadEventSwitchContainerResources(InCookedData)))
 	{
 		UE_LOG(LogWwiseResourceLoader, Error, TEXT("LoadEventResources: Could not load switches for Event %s (%" PRIu32 ")"),
 			*InCookedData.DebugName, (uint32)InCookedData.EventId);
-		bResult = false;
-	}
 
-	if (UNLIKELY(!bResult))
-	{
-		for (const auto* SoundBank : LoadedSoundBanks)
-		{
-			UnloadSoundBankResources(*SoundBank);
-		}
-		for (const auto* Media : LoadedMedia)
-		{
-			UnloadMediaResources(*Media);
-		}
-		for (const auto* ExternalSource : LoadedExternalSources)
-		{
-			UnloadExternalSourceResources(*ExternalSource);
-		}
+		FWwiseResourceLoadBatch Rollback;
+		Rollback.Add(InCookedData);
+		UnloadResourceBatch(MoveTemp(Rollback));
+		return false;
 	}
-	return bResult;
+	return true;
 }
 
 bool UWwiseResourceLoaderImpl::LoadEventSwitchContainerResources(const FWwiseEventCookedData& InCookedData)
@@ -807,18 +1136,9 @@ void UWwiseResourceLoaderImpl::UnloadEventResources(const FWwiseEventCookedData&
 	UE_LOG(LogWwiseResourceLoader, Verbose, TEXT("Unloading Event %s (%" PRIu32 ") resources"),
 		*InCookedData.DebugName, (uint32)InCookedData.EventId);
 
-	for (const auto& SoundBank : InCookedData.SoundBanks)
-	{
-		UnloadSoundBankResources(SoundBank);
-	}
-	for (const auto& Media : InCookedData.Media)
-	{
-		UnloadMediaResources(Media);
-	}
-	for (const auto& ExternalSource : InCookedData.ExternalSources)
-	{
-		UnloadExternalSourceResources(ExternalSource);
-	}
+	FWwiseResourceLoadBatch Batch;
+	Batch.Add(InCookedData);
+	UnloadResourceBatch(MoveTemp(Batch));
 
 	UnloadEventSwitchContainerResources(InCookedData);
 }
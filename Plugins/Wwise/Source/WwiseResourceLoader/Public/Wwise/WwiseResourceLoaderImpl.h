@@ -172,6 +172,32 @@ inline uint32 GetTypeHash(const FWwiseLoadedGroupValueInfo& InValue)
 	return GetTypeHash(InValue.Key);
 }
 
+/**
+ * @brief Set of Media, External Sources and SoundBanks that are loaded or unloaded as a single operation.
+ *
+ * The batch only references the cooked data. The referenced structures must outlive the asynchronous
+ * operation the batch is given to.
+*/
+struct WWISERESOURCELOADER_API FWwiseResourceLoadBatch
+{
+	TArray<const FWwiseMediaCookedData*> Media;
+	TArray<const FWwiseExternalSourceCookedData*> ExternalSources;
+	TArray<const FWwiseSoundBankCookedData*> SoundBanks;
+
+	void Add(const FWwiseAuxBusCookedData& InCookedData);
+	void Add(const FWwiseEventCookedData& InCookedData);
+
+	bool IsEmpty() const
+	{
+		return Media.Num() == 0 && ExternalSources.Num() == 0 && SoundBanks.Num() == 0;
+	}
+
+	int32 Num() const
+	{
+		return Media.Num() + ExternalSources.Num() + SoundBanks.Num();
+	}
+};
+
 UCLASS()
 class WWISERESOURCELOADER_API UWwiseResourceLoaderImpl : public UObject
 {
@@ -234,6 +260,38 @@ public:
 	bool DefaultLoadExternalSourceOperation(const FWwiseExternalSourceCookedData& InExternalSource);
 	bool DefaultUnloadExternalSourceOperation(const FWwiseExternalSourceCookedData& InExternalSource);
 
+	using FLoadResourceBatchCallback = TUniqueFunction<void(bool bSuccess)>;
+	using FUnloadResourceBatchCallback = TUniqueFunction<void()>;
+
+	/**
+	 * @brief Loads all the resources of a batch concurrently.
+	 *
+	 * Media and External Sources are requested together, followed by the SoundBanks once they are all done.
+	 * If any element fails, the elements that were successfully loaded are unloaded before the callback is
+	 * called with false.
+	 *
+	 * When CanBatchResources() is false, the elements are loaded one at a time through LoadMediaResources,
+	 * LoadExternalSourceResources and LoadSoundBankResources instead.
+	 *
+	 * @param InBatch Resources to load. The referenced cooked data must stay valid until the callback is called.
+	 * @param InCallback Called once, from any thread, when the whole batch is done.
+	*/
+	void LoadResourceBatchAsync(FWwiseResourceLoadBatch&& InBatch, FLoadResourceBatchCallback&& InCallback);
+	void UnloadResourceBatchAsync(FWwiseResourceLoadBatch&& InBatch, FUnloadResourceBatchCallback&& InCallback);
+	bool LoadResourceBatch(FWwiseResourceLoadBatch&& InBatch);
+	void UnloadResourceBatch(FWwiseResourceLoadBatch&& InBatch);
+
+	/**
+	 * @brief Whether batches can be sent directly to the file handlers.
+	 *
+	 * A batch doesn't go through the Media, External Source and SoundBank Load/Unload Resources functions.
+	 * Since a subclass might override them, batching is only done by this class itself. Subclasses that
+	 * don't override these functions can return true.
+	*/
+	virtual bool CanBatchResources() const;
+	bool LoadResourcesIndividually(const FWwiseResourceLoadBatch& InBatch);
+	void UnloadResourcesIndividually(const FWwiseResourceLoadBatch& InBatch);
+
 	template<typename MapValue>
 	inline const FWwiseLanguageCookedData* GetLanguageMapKey(const TMap<FWwiseLanguageCookedData, MapValue>& Map, const FWwiseLanguageCookedData* InLanguageOverride, const FString& InDebugName) const;
 
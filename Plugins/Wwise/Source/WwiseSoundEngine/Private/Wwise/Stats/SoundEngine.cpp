@@ -16,5 +16,10 @@ Copyright (c) 2022 Audiokinetic Inc.
 #include "Wwise/Stats/SoundEngine.h"
 
 DEFINE_STAT(STAT_WwiseLowLevelSoundEngine);
+DEFINE_STAT(STAT_WwiseExecutionQueuePendingOps);
+DEFINE_STAT(STAT_WwiseExecutionPoolScheduledQueues);
+DEFINE_STAT(STAT_WwiseExecutionPoolSteals);
+DEFINE_STAT(STAT_WwiseExecutionPoolBlockedWorkers);
+DEFINE_STAT(STAT_WwiseExecutionPoolLatency);
 
 DEFINE_LOG_CATEGORY(LogWwiseSoundEngine);
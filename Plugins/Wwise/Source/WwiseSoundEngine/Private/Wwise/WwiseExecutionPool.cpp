@@ -0,0 +1,401 @@
+/*******************************************************************************
+The content of the files in this repository include portions of the
+AUDIOKINETIC Wwise Technology released in source code form as part of the SDK
+package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use these files in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+Copyright (c) 2022 Audiokinetic Inc.
+*******************************************************************************/
+
+#include "Wwise/WwiseExecutionPool.h"
+
+#include "Wwise/WwiseExecutionQueue.h"
+#include "Wwise/WwiseSoundEngineModule.h"
+#include "Wwise/Stats/SoundEngine.h"
+
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace WwiseExecutionPool
+{
+	/** Index of the pool worker running on the current thread, INDEX_NONE outside of the pool. */
+	static thread_local int32 CurrentWorkerIndex = INDEX_NONE;
+
+	/** Pool owning the worker running on the current thread. */
+	static thread_local FWwiseExecutionPool* CurrentPool = nullptr;
+
+	/** Number of samples averaged in the scheduling latency stat before starting over. */
+	static constexpr uint32 LatencyStatSamples = 256;
+}
+
+FRWLock FWwiseExecutionPool::InstanceLock;
+
+class FWwiseExecutionPool::FWorker : public FRunnable
+{
+public:
+	FWorker(FWwiseExecutionPool& InPool, int32 InIndex) :
+		Pool(InPool),
+		Index(InIndex),
+		WakeEvent(FPlatformProcess::GetSynchEventFromPool(false)),
+		bSleeping(false),
+		Thread(nullptr)
+	{}
+
+	~FWorker()
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	}
+
+	void Start()
+	{
+		Thread = FRunnableThread::Create(this, *FString::Printf(TEXT("WwiseExecutionPool%d"), Index), 0, TPri_Normal);
+	}
+
+	void Join()
+	{
+		if (Thread)
+		{
+			Wake();
+			Thread->WaitForCompletion();
+			delete Thread;
+			Thread = nullptr;
+		}
+	}
+
+	bool TryWake()
+	{
+		bool bExpected = true;
+		if (bSleeping.CompareExchange(bExpected, false))
+		{
+			WakeEvent->Trigger();
+			return true;
+		}
+		return false;
+	}
+
+	void Wake()
+	{
+		bSleeping.Store(false);
+		WakeEvent->Trigger();
+	}
+
+	virtual uint32 Run() override
+	{
+		WwiseExecutionPool::CurrentWorkerIndex = Index;
+		WwiseExecutionPool::CurrentPool = &Pool;
+		while (!Pool.bStopping.Load(EMemoryOrder::Relaxed))
+		{
+			// Spare workers only run while an active worker is blocked
+			if (!Pool.CanRun(Index))
+			{
+				bSleeping.Store(true);
+				if (Pool.CanRun(Index) || Pool.bStopping.Load())
+				{
+					bSleeping.Store(false);
+					continue;
+				}
+				WakeEvent->Wait();
+				bSleeping.Store(false);
+				continue;
+			}
+
+			if (auto* Queue = Pool.FindWork(Index))
+			{
+				Pool.Execute(*Queue);
+				continue;
+			}
+
+			// Announce we are going to sleep, then look again so a queue scheduled in between is not missed.
+			bSleeping.Store(true);
+			if (auto* Queue = Pool.FindWork(Index))
+			{
+				bSleeping.Store(false);
+				Pool.Execute(*Queue);
+				continue;
+			}
+			if (Pool.bStopping.Load())
+			{
+				break;
+			}
+			WakeEvent->Wait();
+			bSleeping.Store(false);
+		}
+		WwiseExecutionPool::CurrentWorkerIndex = INDEX_NONE;
+		WwiseExecutionPool::CurrentPool = nullptr;
+		return 0;
+	}
+
+private:
+	FWwiseExecutionPool& Pool;
+	const int32 Index;
+	FEvent* WakeEvent;
+	TAtomic<bool> bSleeping;
+	FRunnableThread* Thread;
+};
+
+FWwiseExecutionPool* FWwiseExecutionPool::Get()
+{
+	return IWwiseSoundEngineModule::ExecutionPool;
+}
+
+FWwiseExecutionPool::FWwiseExecutionPool(int32 InNumWorkers) :
+	Deques(),
+	InjectionDeque(),
+	NumActiveWorkers(FMath::Max(InNumWorkers, 1)),
+	NumBlockedWorkers(0),
+	bStopping(false),
+	LatencyCycles(0),
+	LatencySamples(0)
+{
+	// As many spare workers as active ones: every active worker can be blocked at the same time.
+	const int32 NumWorkers = NumActiveWorkers * 2;
+	Deques.SetNum(NumWorkers);
+	Workers.Reserve(NumWorkers);
+	for (int32 Index = 0; Index < NumWorkers; ++Index)
+	{
+		Workers.Add(new FWorker(*this, Index));
+	}
+	for (auto* Worker : Workers)
+	{
+		Worker->Start();
+	}
+	UE_LOG(LogWwiseSoundEngine, Verbose, TEXT("Started execution pool with %d workers and %d spare workers."), NumActiveWorkers, NumWorkers - NumActiveWorkers);
+}
+
+FWwiseExecutionPool::~FWwiseExecutionPool()
+{
+	bStopping.Store(true);
+
+	// Hand the scheduled queues to the Task Graph before joining: a worker might be blocked waiting on one of them.
+	for (auto& Deque : Deques)
+	{
+		DrainToTaskGraph(Deque);
+	}
+	DrainToTaskGraph(InjectionDeque);
+
+	for (auto* Worker : Workers)
+	{
+		Worker->Join();
+	}
+
+	// Queues rescheduled by the workers while they were finishing their last slice.
+	for (auto& Deque : Deques)
+	{
+		DrainToTaskGraph(Deque);
+	}
+	DrainToTaskGraph(InjectionDeque);
+
+	for (auto* Worker : Workers)
+	{
+		delete Worker;
+	}
+	Workers.Empty();
+}
+
+int32 FWwiseExecutionPool::GetDefaultNumWorkers()
+{
+	return FMath::Clamp(FPlatformMisc::NumberOfWorkerThreadsToSpawn() / 2, 2, 8);
+}
+
+void FWwiseExecutionPool::Wait(FEvent& InEvent)
+{
+	auto* Pool = WwiseExecutionPool::CurrentPool;
+	if (!Pool)
+	{
+		InEvent.Wait();
+		return;
+	}
+	if (InEvent.Wait(0))
+	{
+		return;
+	}
+
+	// We are blocking a pool worker. A spare worker runs the other queues until the event is triggered.
+	Pool->BeginBlocking();
+	InEvent.Wait();
+	Pool->EndBlocking();
+}
+
+bool FWwiseExecutionPool::TrySchedule(FWwiseExecutionQueue& InQueue)
+{
+	FReadScopeLock ReadLock(InstanceLock);
+	auto* Pool = Get();
+	if (UNLIKELY(!Pool))
+	{
+		return false;
+	}
+	Pool->Schedule(InQueue);
+	return true;
+}
+
+void FWwiseExecutionPool::Shutdown()
+{
+	FWwiseExecutionPool* Pool;
+	{
+		FWriteScopeLock WriteLock(InstanceLock);
+		Pool = IWwiseSoundEngineModule::ExecutionPool;
+		IWwiseSoundEngineModule::ExecutionPool = nullptr;
+	}
+
+	// No one can schedule on the pool from the outside anymore. Stop the workers and drain the remaining queues.
+	delete Pool;
+}
+
+void FWwiseExecutionPool::Schedule(FWwiseExecutionQueue& InQueue, bool bInYielded)
+{
+	InQueue.ScheduledCycles = FPlatformTime::Cycles();
+	INC_DWORD_STAT(STAT_WwiseExecutionPoolScheduledQueues);
+
+	const int32 WorkerIndex = WwiseExecutionPool::CurrentWorkerIndex;
+	if (WorkerIndex != INDEX_NONE && Deques.IsValidIndex(WorkerIndex))
+	{
+		// A yielded queue goes to the front, where it will be picked after every other ready queue of this worker.
+		if (bInYielded)
+		{
+			Deques[WorkerIndex].PushFront(InQueue);
+		}
+		else
+		{
+			Deques[WorkerIndex].PushBack(InQueue);
+		}
+	}
+	else
+	{
+		InjectionDeque.PushBack(InQueue);
+	}
+	WakeOneWorker();
+}
+
+bool FWwiseExecutionPool::CanRun(int32 InWorkerIndex) const
+{
+	return InWorkerIndex < NumActiveWorkers || InWorkerIndex - NumActiveWorkers < NumBlockedWorkers.Load(EMemoryOrder::Relaxed);
+}
+
+void FWwiseExecutionPool::BeginBlocking()
+{
+	const int32 NumBlocked = NumBlockedWorkers.IncrementExchange() + 1;
+	INC_DWORD_STAT(STAT_WwiseExecutionPoolBlockedWorkers);
+	if (LIKELY(NumBlocked <= Workers.Num() - NumActiveWorkers))
+	{
+		Workers[NumActiveWorkers + NumBlocked - 1]->Wake();
+	}
+	else
+	{
+		UE_LOG(LogWwiseSoundEngine, VeryVerbose, TEXT("Execution pool: %d blocked workers, no spare worker left."), NumBlocked);
+	}
+}
+
+void FWwiseExecutionPool::EndBlocking()
+{
+	// The spare worker finishes its current slice, then goes back to sleep.
+	NumBlockedWorkers.DecrementExchange();
+	DEC_DWORD_STAT(STAT_WwiseExecutionPoolBlockedWorkers);
+}
+
+FWwiseExecutionQueue* FWwiseExecutionPool::FindWork(int32 InWorkerIndex)
+{
+	if (auto* Queue = Deques[InWorkerIndex].PopBack())
+	{
+		return Queue;
+	}
+	if (auto* Queue = InjectionDeque.PopFront())
+	{
+		return Queue;
+	}
+
+	const int32 NumDeques = Deques.Num();
+	for (int32 Offset = 1; Offset < NumDeques; ++Offset)
+	{
+		if (auto* Queue = Deques[(InWorkerIndex + Offset) % NumDeques].PopFront())
+		{
+			INC_DWORD_STAT(STAT_WwiseExecutionPoolSteals);
+			return Queue;
+		}
+	}
+	return nullptr;
+}
+
+void FWwiseExecutionPool::Execute(FWwiseExecutionQueue& InQueue)
+{
+#if STATS
+	{
+		const uint64 Latency = FPlatformTime::Cycles() - InQueue.ScheduledCycles;
+		const uint64 TotalLatency = LatencyCycles.AddExchange(Latency) + Latency;
+		const uint32 NumSamples = LatencySamples.IncrementExchange() + 1;
+		SET_FLOAT_STAT(STAT_WwiseExecutionPoolLatency, FPlatformTime::GetSecondsPerCycle64() * 1000.0 * TotalLatency / NumSamples);
+		if (NumSamples >= WwiseExecutionPool::LatencyStatSamples)
+		{
+			LatencyCycles.Store(0);
+			LatencySamples.Store(0);
+		}
+	}
+#endif
+
+	const bool bReschedule = InQueue.WorkSlice(MaxOpsPerSlice);
+	SET_DWORD_STAT(STAT_WwiseExecutionQueuePendingOps, FWwiseExecutionQueue::GetPendingOpCount());
+	if (bReschedule)
+	{
+		Schedule(InQueue, true);
+	}
+}
+
+void FWwiseExecutionPool::WakeOneWorker()
+{
+	for (int32 Index = 0; Index < Workers.Num() && CanRun(Index); ++Index)
+	{
+		if (Workers[Index]->TryWake())
+		{
+			return;
+		}
+	}
+}
+
+void FWwiseExecutionPool::DrainToTaskGraph(FStrandDeque& InDeque)
+{
+	while (auto* Queue = InDeque.PopFront())
+	{
+		AsyncTask(ENamedThreads::AnyThread, [Queue]
+		{
+			Queue->Work();
+		});
+	}
+}
+
+void FWwiseExecutionPool::FStrandDeque::PushBack(FWwiseExecutionQueue& InQueue)
+{
+	FScopeLock ScopeLock(&Lock);
+	Queues.Add(&InQueue);
+}
+
+void FWwiseExecutionPool::FStrandDeque::PushFront(FWwiseExecutionQueue& InQueue)
+{
+	FScopeLock ScopeLock(&Lock);
+	Queues.Insert(&InQueue, 0);
+}
+
+FWwiseExecutionQueue* FWwiseExecutionPool::FStrandDeque::PopBack()
+{
+	FScopeLock ScopeLock(&Lock);
+	return Queues.Num() > 0 ? Queues.Pop(false) : nullptr;
+}
+
+FWwiseExecutionQueue* FWwiseExecutionPool::FStrandDeque::PopFront()
+{
+	FScopeLock ScopeLock(&Lock);
+	if (Queues.Num() == 0)
+	{
+		return nullptr;
+	}
+	auto* Queue = Queues[0];
+	Queues.RemoveAt(0, 1, false);
+	return Queue;
+}
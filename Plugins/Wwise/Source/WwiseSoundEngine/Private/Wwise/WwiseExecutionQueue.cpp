@@ -14,13 +14,19 @@ Copyright (c) 2022 Audiokinetic Inc.
 *******************************************************************************/
 
 #include "Wwise/WwiseExecutionQueue.h"
+#include "Wwise/WwiseExecutionPool.h"
+
 #include "Async/Async.h"
 #include "HAL/Event.h"
 
+static TAtomic<int32> GWwiseExecutionQueuePendingOps(0);
+
 FWwiseExecutionQueue::FWwiseExecutionQueue(ENamedThreads::Type InThread) :
 	WorkerState(EWorkerState::Stopped),
 	OpQueue(),
-	Thread(InThread)
+	Thread(InThread),
+	ScheduledCycles(0),
+	StopEvent(nullptr)
 {}
 
 FWwiseExecutionQueue::~FWwiseExecutionQueue()
@@ -34,6 +40,7 @@ bool FWwiseExecutionQueue::Async(FBasicFunction&& InFunction)
 	{
 		return false;
 	}
+	GWwiseExecutionQueuePendingOps.IncrementExchange();
 	StartWorkerIfNeeded();
 	return true;
 }
@@ -48,7 +55,7 @@ bool FWwiseExecutionQueue::AsyncWait(FBasicFunction&& InFunction)
 	{
 		return false;
 	}
-	Event->Wait();
+	FWwiseExecutionPool::Wait(*Event);
 	return true;
 }
 
@@ -85,22 +92,36 @@ void FWwiseExecutionQueue::Stop()
 {
 	if (WorkerState.Load() == EWorkerState::Running)
 	{
-		AsyncWait([this]
+		// Park until the worker went through all the remaining operations and released this queue.
+		FEventRef StoppedEvent(EEventMode::ManualReset);
+		FEvent* Event = &*StoppedEvent;
+		if (LIKELY(Async([this, Event]
 		{
+			StopEvent = Event;
 			WorkerState.Store(EWorkerState::Exiting);
-		});
-		while (WorkerState.Load(EMemoryOrder::Relaxed) != EWorkerState::Stopped) {}
+		})))
+		{
+			FWwiseExecutionPool::Wait(*StoppedEvent);
+		}
 	}
 }
 
+int32 FWwiseExecutionQueue::GetPendingOpCount()
+{
+	return GWwiseExecutionQueuePendingOps.Load(EMemoryOrder::Relaxed);
+}
+
 void FWwiseExecutionQueue::StartWorkerIfNeeded()
 {
 	if (TrySetStoppedWorkerToRunning())
 	{
-		AsyncTask(Thread, [this]
+		if (Thread != ENamedThreads::AnyThread || !FWwiseExecutionPool::TrySchedule(*this))
 		{
-			Work();
-		});
+			AsyncTask(Thread, [this]
+			{
+				Work();
+			});
+		}
 	}
 }
 
@@ -114,6 +135,21 @@ void FWwiseExecutionQueue::Work()
 	while (!StopWorkerIfDone());
 }
 
+bool FWwiseExecutionQueue::WorkSlice(int32 InMaxOps)
+{
+	for (int32 OpCount = 0; OpCount < InMaxOps; ++OpCount)
+	{
+		ProcessWork();
+		if (StopWorkerIfDone())
+		{
+			// Worker is released. "this" might already be deleted.
+			return false;
+		}
+	}
+	// Still running with pending operations: yield to the other queues.
+	return true;
+}
+
 bool FWwiseExecutionQueue::StopWorkerIfDone()
 {
 	if (OpQueue.IsEmpty())
@@ -134,14 +170,20 @@ bool FWwiseExecutionQueue::StopWorkerIfDone()
 				return true;
 			}
 		}
-		else if (TrySetExitingWorkerToStopped())
-		{
-			// We were exiting and we don't have operations anymore. Immediately return, as our worker is not valid at this point.
-			// Don't do any operations here!
-			return true;
-		}
 		else
 		{
+			// Keep the event locally: it can't be retrieved from "this" once the worker is stopped.
+			FEvent* Event = StopEvent;
+			if (TrySetExitingWorkerToStopped())
+			{
+				// We were exiting and we don't have operations anymore. Immediately return, as our worker is not valid at this point.
+				// Don't do any operations here!
+				if (Event)
+				{
+					Event->Trigger();
+				}
+				return true;
+			}
 			checkf(false, TEXT("Worker is stopped, but we haven't stopped it ourselves."));
 			return true;
 		}
@@ -154,6 +196,7 @@ void FWwiseExecutionQueue::ProcessWork()
 	FBasicFunction Op;
 	if (OpQueue.Dequeue(Op))
 	{
+		GWwiseExecutionQueuePendingOps.DecrementExchange();
 		Op();
 	}
 }
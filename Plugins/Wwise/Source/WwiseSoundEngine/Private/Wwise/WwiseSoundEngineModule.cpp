@@ -22,6 +22,7 @@ Copyright (c) 2022 Audiokinetic Inc.
 #include "Wwise/LowLevel/WwiseLowLevelSpatialAudio.h"
 #include "Wwise/LowLevel/WwiseLowLevelStreamMgr.h"
 #include "Wwise/Stats/SoundEngine.h"
+#include "Wwise/WwiseExecutionPool.h"
 #include "Wwise/WwiseGlobalCallbacks.h"
 
 IMPLEMENT_MODULE(FWwiseSoundEngineModule, WwiseSoundEngine)
@@ -34,9 +35,11 @@ FWwiseLowLevelSoundEngine* IWwiseSoundEngineModule::SoundEngine = nullptr;
 FWwiseLowLevelSpatialAudio* IWwiseSoundEngineModule::SpatialAudio = nullptr;
 FWwiseLowLevelStreamMgr* IWwiseSoundEngineModule::StreamMgr = nullptr;
 FWwiseGlobalCallbacks* IWwiseSoundEngineModule::GlobalCallbacks = nullptr;
+FWwiseExecutionPool* IWwiseSoundEngineModule::ExecutionPool = nullptr;
 
 void FWwiseSoundEngineModule::StartupModule()
 {
+	ExecutionPool = new FWwiseExecutionPool;
 	Comm = new FWwiseLowLevelComm;
 	MemoryMgr = new FWwiseLowLevelMemoryMgr;
 	Monitor = new FWwiseLowLevelMonitor;
@@ -65,4 +68,7 @@ void FWwiseSoundEngineModule::ShutdownModule()
 	delete StreamMgr; StreamMgr = nullptr;
 
 	delete GlobalCallbacks; GlobalCallbacks = nullptr;
+
+	// Queues scheduled from now on go through the Task Graph. The pool hands over the queues it still holds.
+	FWwiseExecutionPool::Shutdown();
 }
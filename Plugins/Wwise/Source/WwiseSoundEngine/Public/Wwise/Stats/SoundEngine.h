@@ -20,5 +20,10 @@ Copyright (c) 2022 Audiokinetic Inc.
 
 DECLARE_STATS_GROUP(TEXT("SoundEngine"), STATGROUP_WwiseSoundEngine, STATCAT_Wwise);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("SoundEngine API Calls"), STAT_WwiseLowLevelSoundEngine, STATGROUP_WwiseSoundEngine, WWISESOUNDENGINE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Execution Queue Pending Operations"), STAT_WwiseExecutionQueuePendingOps, STATGROUP_WwiseSoundEngine, WWISESOUNDENGINE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Execution Pool Scheduled Queues"), STAT_WwiseExecutionPoolScheduledQueues, STATGROUP_WwiseSoundEngine, WWISESOUNDENGINE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Execution Pool Steals"), STAT_WwiseExecutionPoolSteals, STATGROUP_WwiseSoundEngine, WWISESOUNDENGINE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Execution Pool Blocked Workers"), STAT_WwiseExecutionPoolBlockedWorkers, STATGROUP_WwiseSoundEngine, WWISESOUNDENGINE_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Execution Pool Average Scheduling Latency (ms)"), STAT_WwiseExecutionPoolLatency, STATGROUP_WwiseSoundEngine, WWISESOUNDENGINE_API);
 
 WWISESOUNDENGINE_API DECLARE_LOG_CATEGORY_EXTERN(LogWwiseSoundEngine, Log, All);
@@ -0,0 +1,110 @@
+/*******************************************************************************
+The content of the files in this repository include portions of the
+AUDIOKINETIC Wwise Technology released in source code form as part of the SDK
+package.
+
+Commercial License Usage
+
+Licensees holding valid commercial licenses to the AUDIOKINETIC Wwise Technology
+may use these files in accordance with the end user license agreement provided
+with the software or, alternatively, in accordance with the terms contained in a
+written agreement between you and Audiokinetic Inc.
+
+Copyright (c) 2022 Audiokinetic Inc.
+*******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+
+struct FWwiseExecutionQueue;
+
+/**
+ * @brief Fixed pool of worker threads running the FWwiseExecutionQueue operations.
+ *
+ * Each FWwiseExecutionQueue acts as a strand: its operations are always executed sequentially, by one worker at
+ * a time, but different queues run concurrently. A queue with pending operations is pushed on the deque of the
+ * worker that scheduled it, or on a shared injection queue when scheduled from outside the pool. Idle workers
+ * steal from the other deques before going to sleep.
+ *
+ * A worker blocked in Wait() doesn't run anything else on its stack. Instead, a spare worker is woken up for as
+ * long as it is blocked, so the pool keeps the same number of running workers.
+ *
+ * Queues created for a specific named thread (such as the Game Thread) are not handled by the pool.
+*/
+class WWISESOUNDENGINE_API FWwiseExecutionPool
+{
+public:
+	static FWwiseExecutionPool* Get();
+
+	FWwiseExecutionPool(int32 InNumWorkers = GetDefaultNumWorkers());
+	~FWwiseExecutionPool();
+
+	static int32 GetDefaultNumWorkers();
+
+	/**
+	 * @brief Waits for an event to be triggered.
+	 *
+	 * When called from a pool worker, a spare worker takes over while this one is blocked, so a queue
+	 * waiting on another one cannot starve the pool.
+	*/
+	static void Wait(FEvent& InEvent);
+
+	/**
+	 * @brief Schedules a queue on the module's execution pool.
+	 * @return false if there is no pool, such as during shutdown. The caller must then run the queue itself.
+	*/
+	static bool TrySchedule(FWwiseExecutionQueue& InQueue);
+
+	/**
+	 * @brief Detaches the module's execution pool, so nothing can be scheduled on it anymore, then deletes it.
+	 *
+	 * The queues still held by the pool are handed to the Task Graph.
+	*/
+	static void Shutdown();
+
+	void Schedule(FWwiseExecutionQueue& InQueue, bool bInYielded = false);
+	int32 GetNumWorkers() const { return NumActiveWorkers; }
+
+private:
+	class FWorker;
+
+	struct FStrandDeque
+	{
+		FCriticalSection Lock;
+		TArray<FWwiseExecutionQueue*> Queues;
+
+		void PushBack(FWwiseExecutionQueue& InQueue);
+		void PushFront(FWwiseExecutionQueue& InQueue);
+		FWwiseExecutionQueue* PopBack();
+		FWwiseExecutionQueue* PopFront();
+	};
+
+	/** Active workers first, followed by the spare workers only running while active ones are blocked. */
+	TArray<FWorker*> Workers;
+	TArray<FStrandDeque> Deques;
+	FStrandDeque InjectionDeque;
+	const int32 NumActiveWorkers;
+	TAtomic<int32> NumBlockedWorkers;
+	TAtomic<bool> bStopping;
+
+	/** Scheduling latency accumulated since the last stat update, in cycles, and number of samples. */
+	TAtomic<uint64> LatencyCycles;
+	TAtomic<uint32> LatencySamples;
+
+	/** Protects IWwiseSoundEngineModule::ExecutionPool against a concurrent Shutdown(). */
+	static FRWLock InstanceLock;
+
+	/** Maximum number of operations executed from a queue before it is rescheduled behind the other ready queues. */
+	static constexpr int32 MaxOpsPerSlice = 16;
+
+	bool CanRun(int32 InWorkerIndex) const;
+	void BeginBlocking();
+	void EndBlocking();
+
+	FWwiseExecutionQueue* FindWork(int32 InWorkerIndex);
+	void Execute(FWwiseExecutionQueue& InQueue);
+	void WakeOneWorker();
+	void DrainToTaskGraph(FStrandDeque& InDeque);
+};
@@ -18,6 +18,7 @@ Copyright (c) 2022 Audiokinetic Inc.
 #include "CoreMinimal.h"
 #include "Async/Async.h"
 #include "Containers/Queue.h"
+#include "HAL/Event.h"
 
 struct WWISESOUNDENGINE_API FWwiseExecutionQueue
 {
@@ -48,7 +49,12 @@ struct WWISESOUNDENGINE_API FWwiseExecutionQueue
 
 	void Stop();
 
+	/** Number of operations queued in all the execution queues and not yet started. */
+	static int32 GetPendingOpCount();
+
 private:
+	friend class FWwiseExecutionPool;
+
 	enum class WWISESOUNDENGINE_API EWorkerState
 	{
 		Stopped,
@@ -62,8 +68,15 @@ private:
 
 	const ENamedThreads::Type Thread;
 
+	/** Time at which the queue got scheduled in the execution pool. Used to compute scheduling latency. */
+	uint32 ScheduledCycles;
+
+	/** Event triggered once an exiting worker is stopped. Only accessed by the running worker. */
+	FEvent* StopEvent;
+
 	void StartWorkerIfNeeded();
 	void Work();
+	bool WorkSlice(int32 InMaxOps);
 	bool StopWorkerIfDone();
 	void ProcessWork();
 	bool TrySetStoppedWorkerToRunning();
@@ -26,6 +26,7 @@ class FWwiseLowLevelSpatialAudio;
 class FWwiseLowLevelStreamMgr;
 
 class FWwiseGlobalCallbacks;
+class FWwiseExecutionPool;
 
 class IWwiseSoundEngineModule : public IModuleInterface
 {
@@ -39,6 +40,7 @@ public:
 	static WWISESOUNDENGINE_API FWwiseLowLevelStreamMgr* StreamMgr;
 
 	static WWISESOUNDENGINE_API FWwiseGlobalCallbacks* GlobalCallbacks;
+	static WWISESOUNDENGINE_API FWwiseExecutionPool* ExecutionPool;
 
 	/**
 	 * Checks to see if this module is loaded and ready.
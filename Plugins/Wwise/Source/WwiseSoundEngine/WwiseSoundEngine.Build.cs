@@ -64,6 +64,7 @@ public class WwiseSoundEngine : ModuleRules
         PublicIncludePaths.Add(Path.Combine(ThirdPartyFolder, "include"));
 
 		PublicDefinitions.Add("AK_UNREAL_MAX_CONCURRENT_IO=32");
+		PublicDefinitions.Add("AK_UNREAL_MAX_CONCURRENT_STREAMING_READS=4");
 		PublicDefinitions.Add("AK_UNREAL_IO_GRANULARITY=32768");
 		if (Target.Configuration == UnrealTargetConfiguration.Shipping)
 		{
@@ -5,6 +5,8 @@
 #include "LyraContextEffectsLibrary.h"
 #include "LyraContextEffectsSubsystem.h"
 #include "NiagaraFunctionLibrary.h"
+#include "NiagaraComponent.h"
+#include "Components/AudioComponent.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 
 
@@ -94,19 +96,19 @@ void ULyraContextEffectComponent::AnimMotionEffect_Implementation(const FName Bo
 		}
 	}
 
-	// Cycle through Active Audio Components and cache
+	// Cycle through Active Audio Components and cache the ones still playing (finished ones may be reused by the subsystem)
 	for (UAudioComponent* ActiveAudioComponent : ActiveAudioComponents)
 	{
-		if (ActiveAudioComponent)
+		if (ActiveAudioComponent && ActiveAudioComponent->IsPlaying())
 		{
 			AudioComponentsToAdd.Add(ActiveAudioComponent);
 		}
 	}
 
-	// Cycle through Active Niagara Components and cache
+	// Cycle through Active Niagara Components and cache the ones still active (completed ones may be back in the pool)
 	for (UNiagaraComponent* ActiveNiagaraComponent : ActiveNiagaraComponents)
 	{
-		if (ActiveNiagaraComponent)
+		if (ActiveNiagaraComponent && ActiveNiagaraComponent->IsActive())
 		{
 			NiagaraComponentsToAdd.Add(ActiveNiagaraComponent);
 		}
@@ -5,28 +5,77 @@
 #include "NiagaraSystem.h"
 #include "Sound/SoundBase.h"
 #include "GameplayTagContainer.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 
+namespace LyraContextEffects
+{
+	// Upper bound on cached query results per library, the cache is flushed when it is exceeded
+	static constexpr int32 MaxResolvedEffectsCacheSize = 1024;
+}
+
+ULyraContextEffectsLibrary::FResolvedEffectsQuery::FResolvedEffectsQuery(const FGameplayTag& InEffect, const FGameplayTagContainer& InContext)
+	: Effect(InEffect)
+	, Context(InContext)
+{
+	// Container equality ignores ordering, so combine the tag hashes in an order independent way
+	uint32 ContextHash = 0;
+	for (const FGameplayTag& Tag : Context)
+	{
+		ContextHash += GetTypeHash(Tag) * 0x9E3779B1u;
+	}
+	Hash = HashCombine(GetTypeHash(Effect), ContextHash);
+}
 
 void ULyraContextEffectsLibrary::GetEffects(const FGameplayTag Effect, const FGameplayTagContainer Context, 
 	TArray<USoundBase*>& Sounds, TArray<UNiagaraSystem*>& NiagaraSystems)
+{
+	if (const FLyraResolvedContextEffects* ResolvedEffects = FindResolvedEffects(Effect, Context))
+	{
+		// Get all Matching Sounds and Niagara Systems
+		Sounds.Append(ResolvedEffects->Sounds);
+		NiagaraSystems.Append(ResolvedEffects->NiagaraSystems);
+	}
+}
+
+const FLyraResolvedContextEffects* ULyraContextEffectsLibrary::FindResolvedEffects(const FGameplayTag& Effect, const FGameplayTagContainer& Context)
 {
 	// Make sure Effect is valid and Library is loaded
-	if (Effect.IsValid() && Context.IsValid() && EffectsLoadState == EContextEffectsLibraryLoadState::Loaded)
+	if (!Effect.IsValid() || !Context.IsValid() || EffectsLoadState != EContextEffectsLibraryLoadState::Loaded)
 	{
-		// Loop through Context Effects
-		for (const auto ActiveContextEffect : ActiveContextEffects)
+		return nullptr;
+	}
+
+	// Look up with the caller's Context, the key (and its copy of the container) is only built on a cache miss
+	const FResolvedEffectsQuery Query(Effect, Context);
+	FLyraResolvedContextEffects* ResolvedEffects = ResolvedEffectsCache.FindByHash(Query.Hash, Query);
+	if (ResolvedEffects == nullptr)
+	{
+		if (ResolvedEffectsCache.Num() >= LyraContextEffects::MaxResolvedEffectsCacheSize)
+		{
+			ResolvedEffectsCache.Reset();
+		}
+
+		ResolvedEffects = &ResolvedEffectsCache.AddByHash(Query.Hash, FResolvedEffectsKey(Query));
+
+		// Only Context Effects with an exact Effect Tag match can apply
+		if (const TArray<ULyraActiveContextEffects*>* Candidates = ActiveContextEffectsByTag.Find(Effect))
 		{
-			// Make sure the Effect is an exact Tag Match and ensure the Context has all tags in the Effect (and neither or both are empty)
-			if (Effect.MatchesTagExact(ActiveContextEffect->EffectTag)
-				&& Context.HasAllExact(ActiveContextEffect->Context)
-				&& (ActiveContextEffect->Context.IsEmpty() == Context.IsEmpty()))
+			for (const ULyraActiveContextEffects* ActiveContextEffect : *Candidates)
 			{
-				// Get all Matching Sounds and Niagara Systems
-				Sounds.Append(ActiveContextEffect->Sounds);
-				NiagaraSystems.Append(ActiveContextEffect->NiagaraSystems);
+				// Ensure the Context has all tags in the Effect (and neither or both are empty)
+				if (Context.HasAllExact(ActiveContextEffect->Context)
+					&& (ActiveContextEffect->Context.IsEmpty() == Context.IsEmpty()))
+				{
+					// Get all Matching Sounds and Niagara Systems
+					ResolvedEffects->Sounds.Append(ActiveContextEffect->Sounds);
+					ResolvedEffects->NiagaraSystems.Append(ActiveContextEffect->NiagaraSystems);
+				}
 			}
 		}
 	}
+
+	return (ResolvedEffects->Sounds.Num() > 0 || ResolvedEffects->NiagaraSystems.Num() > 0) ? ResolvedEffects : nullptr;
 }
 
 void ULyraContextEffectsLibrary::LoadEffects()
@@ -39,6 +88,8 @@ void ULyraContextEffectsLibrary::LoadEffects()
 
 		// Clear out any old Active Effects
 		ActiveContextEffects.Empty();
+		ActiveContextEffectsByTag.Empty();
+		ResolvedEffectsCache.Empty();
 
 		// Call internal loading function
 		LoadEffectsInternal();
@@ -53,16 +104,58 @@ EContextEffectsLibraryLoadState ULyraContextEffectsLibrary::GetContextEffectsLib
 
 void ULyraContextEffectsLibrary::LoadEffectsInternal()
 {
-	// TODO Add Async Loading for Libraries
+	// Gather every Effect referenced by a usable Context Effect
+	TArray<FSoftObjectPath> EffectPaths;
+	for (const FLyraContextEffects& ContextEffect : ContextEffects)
+	{
+		if (ContextEffect.EffectTag.IsValid() && ContextEffect.Context.IsValid())
+		{
+			for (const FSoftObjectPath& Effect : ContextEffect.Effects)
+			{
+				if (!Effect.IsNull())
+				{
+					EffectPaths.AddUnique(Effect);
+				}
+			}
+		}
+	}
 
-	// Copy data for async load
-	TArray<FLyraContextEffects> LocalContextEffects = ContextEffects;
+	// Hold the previous handle until the new request has taken its own references
+	TSharedPtr<FStreamableHandle> PreviousLoadHandle = MoveTemp(EffectsLoadHandle);
+
+	if (EffectPaths.Num() > 0)
+	{
+		FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+		EffectsLoadHandle = StreamableManager.RequestAsyncLoad(MoveTemp(EffectPaths),
+			FStreamableDelegate::CreateUObject(this, &ThisClass::HandleEffectsAsyncLoaded),
+			FStreamableManager::DefaultAsyncLoadPriority, false, false, TEXT("LyraContextEffectsLibrary"));
+	}
+
+	if (PreviousLoadHandle.IsValid())
+	{
+		PreviousLoadHandle->ReleaseHandle();
+	}
+
+	// Nothing to stream in (or the request failed), complete immediately
+	if (!EffectsLoadHandle.IsValid())
+	{
+		HandleEffectsAsyncLoaded();
+	}
+}
+
+void ULyraContextEffectsLibrary::HandleEffectsAsyncLoaded()
+{
+	// Ignore completions for a load that has since been restarted or finished
+	if (EffectsLoadState != EContextEffectsLibraryLoadState::Loading)
+	{
+		return;
+	}
 
 	// Prepare Active Context Effects Array
 	TArray<ULyraActiveContextEffects*> ActiveContextEffectsArray;
 
 	// Loop through Context Effects
-	for (const FLyraContextEffects& ContextEffect : LocalContextEffects)
+	for (const FLyraContextEffects& ContextEffect : ContextEffects)
 	{
 		// Make sure Tags are Valid
 		if (ContextEffect.EffectTag.IsValid() && ContextEffect.Context.IsValid())
@@ -74,10 +167,10 @@ void ULyraContextEffectsLibrary::LoadEffectsInternal()
 			NewActiveContextEffects->EffectTag = ContextEffect.EffectTag;
 			NewActiveContextEffects->Context = ContextEffect.Context;
 
-			// Try to load and add Effects to New Active Context Effects
+			// Add the streamed in Effects to New Active Context Effects
 			for (const FSoftObjectPath& Effect : ContextEffect.Effects)
 			{
-				if (UObject* Object = Effect.TryLoad())
+				if (UObject* Object = Effect.ResolveObject())
 				{
 					if (Object->IsA(USoundBase::StaticClass()))
 					{
@@ -101,7 +194,6 @@ void ULyraContextEffectsLibrary::LoadEffectsInternal()
 		}
 	}
 
-	// TODO Call Load Complete after Async Load
 	// Mark loading complete
 	this->LyraContextEffectLibraryLoadingComplete(ActiveContextEffectsArray);
 }
@@ -114,4 +206,12 @@ void ULyraContextEffectsLibrary::LyraContextEffectLibraryLoadingComplete(
 
 	// Append incoming Context Effects Array to current list of Active Context Effects
 	ActiveContextEffects.Append(LyraActiveContextEffects);
+
+	// Bucket by Effect Tag so queries only test Context Effects that can match
+	ActiveContextEffectsByTag.Reset();
+	for (ULyraActiveContextEffects* ActiveContextEffect : ActiveContextEffects)
+	{
+		ActiveContextEffectsByTag.FindOrAdd(ActiveContextEffect->EffectTag).Add(ActiveContextEffect);
+	}
+	ResolvedEffectsCache.Reset();
 }
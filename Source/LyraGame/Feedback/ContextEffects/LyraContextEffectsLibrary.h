@@ -10,6 +10,7 @@
 
 class USoundBase;
 class UNiagaraSystem;
+struct FStreamableHandle;
 
 /**
  *
@@ -64,6 +65,16 @@ public:
 
 DECLARE_DYNAMIC_DELEGATE_OneParam(FLyraContextEffectLibraryLoadingComplete, TArray<ULyraActiveContextEffects*>, LyraActiveContextEffects);
 
+/**
+ * Sounds and Niagara Systems resolved for one Effect tag and Context container
+ * Pointers are kept alive by the owning library's Active Context Effects
+ */
+struct FLyraResolvedContextEffects
+{
+	TArray<USoundBase*> Sounds;
+	TArray<UNiagaraSystem*> NiagaraSystems;
+};
+
 /**
  * 
  */
@@ -85,14 +96,68 @@ public:
 
 	EContextEffectsLibraryLoadState GetContextEffectsLibraryLoadState();
 
+	/** Returns the Sounds and Niagara Systems matching Effect and Context, or nullptr if the library is not loaded or nothing matches. Results are cached per query. */
+	const FLyraResolvedContextEffects* FindResolvedEffects(const FGameplayTag& Effect, const FGameplayTagContainer& Context);
+
 private:
 	void LoadEffectsInternal();
 
+	void HandleEffectsAsyncLoaded();
+
 	void LyraContextEffectLibraryLoadingComplete(TArray<ULyraActiveContextEffects*> LyraActiveContextEffects);
 
+	/** Lookup into the resolved effects cache, borrowing the queried Context so it is only copied when a result gets cached */
+	struct FResolvedEffectsQuery
+	{
+		const FGameplayTag& Effect;
+		const FGameplayTagContainer& Context;
+		uint32 Hash;
+
+		FResolvedEffectsQuery(const FGameplayTag& InEffect, const FGameplayTagContainer& InContext);
+	};
+
+	/** Key for the resolved effects cache, Context is compared ignoring tag order */
+	struct FResolvedEffectsKey
+	{
+		FGameplayTag Effect;
+		FGameplayTagContainer Context;
+		uint32 Hash = 0;
+
+		explicit FResolvedEffectsKey(const FResolvedEffectsQuery& Query)
+			: Effect(Query.Effect)
+			, Context(Query.Context)
+			, Hash(Query.Hash)
+		{
+		}
+
+		bool operator==(const FResolvedEffectsKey& Other) const
+		{
+			return Hash == Other.Hash && Effect == Other.Effect && Context == Other.Context;
+		}
+
+		bool operator==(const FResolvedEffectsQuery& Query) const
+		{
+			return Hash == Query.Hash && Effect == Query.Effect && Context == Query.Context;
+		}
+
+		friend uint32 GetTypeHash(const FResolvedEffectsKey& Key)
+		{
+			return Key.Hash;
+		}
+	};
+
 	UPROPERTY(Transient)
 	TArray< ULyraActiveContextEffects*> ActiveContextEffects;
 
+	/** Active Context Effects bucketed by Effect tag, rebuilt when loading completes */
+	TMap<FGameplayTag, TArray<ULyraActiveContextEffects*>> ActiveContextEffectsByTag;
+
+	/** Results of previous queries, cleared whenever the Active Context Effects change */
+	TMap<FResolvedEffectsKey, FLyraResolvedContextEffects> ResolvedEffectsCache;
+
+	/** Keeps the effect assets loaded while this library is loaded */
+	TSharedPtr<FStreamableHandle> EffectsLoadHandle;
+
 	UPROPERTY(Transient)
 	EContextEffectsLibraryLoadState EffectsLoadState = EContextEffectsLibraryLoadState::Unloaded;
 };
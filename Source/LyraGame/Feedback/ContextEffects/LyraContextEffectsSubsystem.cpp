@@ -5,6 +5,30 @@
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraFunctionLibrary.h"
 #include "LyraContextEffectsLibrary.h"
+#include "Components/AudioComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Spawn Context Effects"), STAT_LyraSpawnContextEffects, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Context Effect Audio Components Spawned"), STAT_LyraContextEffectsAudioSpawned, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Context Effect Audio Components Reused"), STAT_LyraContextEffectsAudioReused, STATGROUP_Game);
+
+namespace LyraContextEffects
+{
+	static int32 MaxPooledAudioComponentsPerActor = 8;
+	static FAutoConsoleVariableRef CVarMaxPooledAudioComponentsPerActor(
+		TEXT("Lyra.ContextEffects.MaxPooledAudioComponentsPerActor"),
+		MaxPooledAudioComponentsPerActor,
+		TEXT("Number of finished context effect audio components kept per actor for reuse (0 disables audio pooling)"),
+		ECVF_Default);
+
+	static bool bPoolNiagaraComponents = true;
+	static FAutoConsoleVariableRef CVarPoolNiagaraComponents(
+		TEXT("Lyra.ContextEffects.PoolNiagaraComponents"),
+		bPoolNiagaraComponents,
+		TEXT("Should context effect Niagara components be returned to the world component pool when they complete"),
+		ECVF_Default);
+}
 
 void ULyraContextEffectsSubsystem::SpawnContextEffects(
 	const AActor* SpawningActor
@@ -20,6 +44,8 @@ void ULyraContextEffectsSubsystem::SpawnContextEffects(
 	, float AudioVolume
 	, float AudioPitch)
 {
+	SCOPE_CYCLE_COUNTER(STAT_LyraSpawnContextEffects);
+
 	// First determine if this Actor has a matching Set of Libraries
 	if (ULyraContextEffectsSet** EffectsLibrariesSetPtr = ActiveActorEffectsMap.Find(SpawningActor))
 	{
@@ -27,8 +53,8 @@ void ULyraContextEffectsSubsystem::SpawnContextEffects(
 		if (ULyraContextEffectsSet* EffectsLibraries = *EffectsLibrariesSetPtr)
 		{
 			// Prepare Arrays for Sounds and Niagara Systems
-			TArray<USoundBase*> TotalSounds;
-			TArray<UNiagaraSystem*> TotalNiagaraSystems;
+			TArray<USoundBase*, TInlineAllocator<4>> TotalSounds;
+			TArray<UNiagaraSystem*, TInlineAllocator<4>> TotalNiagaraSystems;
 
 			// Cycle through Effect Libraries
 			for (ULyraContextEffectsLibrary* EffectLibrary : EffectsLibraries->LyraContextEffectsLibraries)
@@ -36,16 +62,12 @@ void ULyraContextEffectsSubsystem::SpawnContextEffects(
 				// Check if the Effect Library is valid and data Loaded
 				if (EffectLibrary && EffectLibrary->GetContextEffectsLibraryLoadState() == EContextEffectsLibraryLoadState::Loaded)
 				{
-					// Set up local list of Sounds and Niagara Systems
-					TArray<USoundBase*> Sounds;
-					TArray<UNiagaraSystem*> NiagaraSystems;
-
-					// Get Sounds and Niagara Systems
-					EffectLibrary->GetEffects(Effect, Contexts, Sounds, NiagaraSystems);
-
-					// Append to accumulating array
-					TotalSounds.Append(Sounds);
-					TotalNiagaraSystems.Append(NiagaraSystems);
+					// Get cached Sounds and Niagara Systems and append to accumulating array
+					if (const FLyraResolvedContextEffects* ResolvedEffects = EffectLibrary->FindResolvedEffects(Effect, Contexts))
+					{
+						TotalSounds.Append(ResolvedEffects->Sounds);
+						TotalNiagaraSystems.Append(ResolvedEffects->NiagaraSystems);
+					}
 				}
 				else if (EffectLibrary && EffectLibrary->GetContextEffectsLibraryLoadState() == EContextEffectsLibraryLoadState::Unloaded)
 				{
@@ -57,19 +79,21 @@ void ULyraContextEffectsSubsystem::SpawnContextEffects(
 			// Cycle through found Sounds
 			for (USoundBase* Sound : TotalSounds)
 			{
-				// Spawn Sounds Attached, add Audio Component to List of ACs
-				UAudioComponent* AudioComponent = UGameplayStatics::SpawnSoundAttached(Sound, AttachToComponent, AttachPoint, LocationOffset, RotationOffset, EAttachLocation::KeepRelativeOffset,
-					false, AudioVolume, AudioPitch, 0.0f, nullptr, nullptr, true);
+				// Spawn (or reuse) Sounds Attached, add Audio Component to List of ACs
+				UAudioComponent* AudioComponent = SpawnPooledSound(*EffectsLibraries, Sound, AttachToComponent, AttachPoint, LocationOffset, RotationOffset, AudioVolume, AudioPitch);
 
 				AudioOut.Add(AudioComponent);
 			}
 
+			// Pooled components are handed back to the world's Niagara component pool once they complete
+			const ENCPoolMethod NiagaraPoolMethod = LyraContextEffects::bPoolNiagaraComponents ? ENCPoolMethod::AutoRelease : ENCPoolMethod::None;
+
 			// Cycle through found Niagara Systems
 			for (UNiagaraSystem* NiagaraSystem : TotalNiagaraSystems)
 			{
 				// Spawn Niagara Systems Attached, add Niagara Component to List of NCs
 				UNiagaraComponent* NiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAttached(NiagaraSystem, AttachToComponent, AttachPoint, LocationOffset,
-					RotationOffset, VFXScale, EAttachLocation::KeepRelativeOffset, true, ENCPoolMethod::None, true, true);
+					RotationOffset, VFXScale, EAttachLocation::KeepRelativeOffset, true, NiagaraPoolMethod, true, true);
 
 				NiagaraOut.Add(NiagaraComponent);
 			}
@@ -77,6 +101,52 @@ void ULyraContextEffectsSubsystem::SpawnContextEffects(
 	}
 }
 
+UAudioComponent* ULyraContextEffectsSubsystem::SpawnPooledSound(ULyraContextEffectsSet& EffectsLibrariesSet, USoundBase* Sound, USceneComponent* AttachToComponent,
+	const FName AttachPoint, const FVector& LocationOffset, const FRotator& RotationOffset, float AudioVolume, float AudioPitch)
+{
+	if (Sound == nullptr || AttachToComponent == nullptr)
+	{
+		return nullptr;
+	}
+
+	// Reuse an Audio Component that has finished playing, dropping any destroyed along with their owner
+	TArray<UAudioComponent*>& PooledAudioComponents = EffectsLibrariesSet.PooledAudioComponents;
+	for (int32 Index = PooledAudioComponents.Num() - 1; Index >= 0; --Index)
+	{
+		UAudioComponent* PooledAudioComponent = PooledAudioComponents[Index];
+		if (!IsValid(PooledAudioComponent))
+		{
+			PooledAudioComponents.RemoveAtSwap(Index);
+		}
+		else if (!PooledAudioComponent->IsPlaying())
+		{
+			PooledAudioComponent->AttachToComponent(AttachToComponent, FAttachmentTransformRules::KeepRelativeTransform, AttachPoint);
+			PooledAudioComponent->SetRelativeLocationAndRotation(LocationOffset, RotationOffset);
+			PooledAudioComponent->SetSound(Sound);
+			PooledAudioComponent->SetVolumeMultiplier(AudioVolume);
+			PooledAudioComponent->SetPitchMultiplier(AudioPitch);
+			PooledAudioComponent->Play();
+
+			INC_DWORD_STAT(STAT_LyraContextEffectsAudioReused);
+			return PooledAudioComponent;
+		}
+	}
+
+	// Components that will be pooled must outlive their first sound, the rest clean themselves up
+	const bool bAddToPool = PooledAudioComponents.Num() < LyraContextEffects::MaxPooledAudioComponentsPerActor;
+
+	UAudioComponent* AudioComponent = UGameplayStatics::SpawnSoundAttached(Sound, AttachToComponent, AttachPoint, LocationOffset, RotationOffset, EAttachLocation::KeepRelativeOffset,
+		false, AudioVolume, AudioPitch, 0.0f, nullptr, nullptr, !bAddToPool);
+
+	if (AudioComponent && bAddToPool)
+	{
+		PooledAudioComponents.Add(AudioComponent);
+	}
+
+	INC_DWORD_STAT(STAT_LyraContextEffectsAudioSpawned);
+	return AudioComponent;
+}
+
 bool ULyraContextEffectsSubsystem::GetContextFromSurfaceType(
 	TEnumAsByte<EPhysicalSurface> PhysicalSurface, FGameplayTag& Context)
 {
@@ -106,23 +176,77 @@ void ULyraContextEffectsSubsystem::LoadAndAddContextEffectsLibraries(AActor* Own
 	// Create new Context Effect Set
 	ULyraContextEffectsSet* EffectsLibrariesSet = NewObject<ULyraContextEffectsSet>(this);
 
+	// Replace any previous Set, keeping its pooled Audio Components
+	if (ULyraContextEffectsSet* PreviousEffectsLibrariesSet = ActiveActorEffectsMap.FindRef(OwningActor))
+	{
+		if (PreviousEffectsLibrariesSet->LibrariesLoadHandle.IsValid())
+		{
+			PreviousEffectsLibrariesSet->LibrariesLoadHandle->CancelHandle();
+		}
+		EffectsLibrariesSet->PooledAudioComponents = MoveTemp(PreviousEffectsLibrariesSet->PooledAudioComponents);
+	}
+
+	// Update Active Actor Effects Map, the Set is filled in once the Libraries are loaded
+	ActiveActorEffectsMap.Emplace(OwningActor, EffectsLibrariesSet);
+
+	// Collect Libraries that still need to be streamed in
+	TArray<TSoftObjectPtr<ULyraContextEffectsLibrary>> LibrariesToAdd = ContextEffectsLibraries.Array();
+	TArray<FSoftObjectPath> LibraryPathsToLoad;
+	for (const TSoftObjectPtr<ULyraContextEffectsLibrary>& ContextEffectSoftObj : LibrariesToAdd)
+	{
+		if (!ContextEffectSoftObj.IsNull() && ContextEffectSoftObj.Get() == nullptr)
+		{
+			LibraryPathsToLoad.Add(ContextEffectSoftObj.ToSoftObjectPath());
+		}
+	}
+
+	const TWeakObjectPtr<AActor> WeakOwningActor(OwningActor);
+	const TWeakObjectPtr<ULyraContextEffectsSet> WeakEffectsLibrariesSet(EffectsLibrariesSet);
+
+	if (LibraryPathsToLoad.Num() > 0)
+	{
+		FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+		EffectsLibrariesSet->LibrariesLoadHandle = StreamableManager.RequestAsyncLoad(MoveTemp(LibraryPathsToLoad),
+			FStreamableDelegate::CreateUObject(this, &ThisClass::HandleLibrariesLoaded, WeakOwningActor, WeakEffectsLibrariesSet, LibrariesToAdd),
+			FStreamableManager::DefaultAsyncLoadPriority, false, false, TEXT("LyraContextEffectsSubsystem"));
+	}
+
+	// Everything was already in memory (or the request failed), add the Libraries now
+	if (!EffectsLibrariesSet->LibrariesLoadHandle.IsValid())
+	{
+		HandleLibrariesLoaded(WeakOwningActor, WeakEffectsLibrariesSet, MoveTemp(LibrariesToAdd));
+	}
+}
+
+void ULyraContextEffectsSubsystem::HandleLibrariesLoaded(TWeakObjectPtr<AActor> WeakOwningActor, TWeakObjectPtr<ULyraContextEffectsSet> WeakEffectsLibrariesSet,
+	TArray<TSoftObjectPtr<ULyraContextEffectsLibrary>> ContextEffectsLibraries)
+{
+	// The Actor may have been removed, or given a new Set, while the Libraries were loading
+	AActor* OwningActor = WeakOwningActor.Get();
+	ULyraContextEffectsSet* EffectsLibrariesSet = WeakEffectsLibrariesSet.Get();
+	if (OwningActor == nullptr || EffectsLibrariesSet == nullptr || ActiveActorEffectsMap.FindRef(OwningActor) != EffectsLibrariesSet)
+	{
+		return;
+	}
+
 	// Cycle through Libraries getting Soft Obj Refs
 	for (const TSoftObjectPtr<ULyraContextEffectsLibrary>& ContextEffectSoftObj : ContextEffectsLibraries)
 	{
-		// Load Library Assets from Soft Obj refs
-		// TODO Support Async Loading of Asset Data
-		if (ULyraContextEffectsLibrary* EffectsLibrary = ContextEffectSoftObj.LoadSynchronous())
+		if (ULyraContextEffectsLibrary* EffectsLibrary = ContextEffectSoftObj.Get())
 		{
-			// Call load on valid Libraries
-			EffectsLibrary->LoadEffects();
+			// Call load on Libraries no other Actor has loaded yet
+			if (EffectsLibrary->GetContextEffectsLibraryLoadState() == EContextEffectsLibraryLoadState::Unloaded)
+			{
+				EffectsLibrary->LoadEffects();
+			}
 
 			// Add new library to Set
 			EffectsLibrariesSet->LyraContextEffectsLibraries.Add(EffectsLibrary);
 		}
 	}
 
-	// Update Active Actor Effects Map
-	ActiveActorEffectsMap.Emplace(OwningActor, EffectsLibrariesSet);
+	// The Set now holds hard references to the Libraries
+	EffectsLibrariesSet->LibrariesLoadHandle.Reset();
 }
 
 void ULyraContextEffectsSubsystem::UnloadAndRemoveContextEffectsLibraries(AActor* OwningActor)
@@ -133,6 +257,30 @@ void ULyraContextEffectsSubsystem::UnloadAndRemoveContextEffectsLibraries(AActor
 		return;
 	}
 
+	// Stop any pending Library load for this Actor
+	if (ULyraContextEffectsSet* EffectsLibrariesSet = ActiveActorEffectsMap.FindRef(OwningActor))
+	{
+		if (EffectsLibrariesSet->LibrariesLoadHandle.IsValid())
+		{
+			EffectsLibrariesSet->LibrariesLoadHandle->CancelHandle();
+			EffectsLibrariesSet->LibrariesLoadHandle.Reset();
+		}
+	}
+
 	// Remove ref from Active Actor/Effects Set Map
 	ActiveActorEffectsMap.Remove(OwningActor);
 }
+
+void ULyraContextEffectsSubsystem::Deinitialize()
+{
+	for (const TPair<AActor*, ULyraContextEffectsSet*>& Pair : ActiveActorEffectsMap)
+	{
+		if (Pair.Value && Pair.Value->LibrariesLoadHandle.IsValid())
+		{
+			Pair.Value->LibrariesLoadHandle->CancelHandle();
+		}
+	}
+	ActiveActorEffectsMap.Empty();
+
+	Super::Deinitialize();
+}
@@ -11,7 +11,10 @@
 #include "LyraContextEffectsSubsystem.generated.h"
 
 class ULyraContextEffectsLibrary;
+class UAudioComponent;
 class UNiagaraComponent;
+class USoundBase;
+struct FStreamableHandle;
 
 /**
  *
@@ -38,6 +41,13 @@ class LYRAGAME_API ULyraContextEffectsSet : public UObject
 public:
 	UPROPERTY(Transient)
 	TSet<ULyraContextEffectsLibrary*> LyraContextEffectsLibraries;
+
+	/** Audio Components spawned for the owning Actor, reused once they finish playing */
+	UPROPERTY(Transient)
+	TArray<UAudioComponent*> PooledAudioComponents;
+
+	/** Pending async load of LyraContextEffectsLibraries, if any */
+	TSharedPtr<FStreamableHandle> LibrariesLoadHandle;
 };
 
 
@@ -78,7 +88,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ContextEffects")
 	void UnloadAndRemoveContextEffectsLibraries(AActor* OwningActor);
 
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
 private:
+	void HandleLibrariesLoaded(TWeakObjectPtr<AActor> WeakOwningActor, TWeakObjectPtr<ULyraContextEffectsSet> WeakEffectsLibrariesSet, TArray<TSoftObjectPtr<ULyraContextEffectsLibrary>> ContextEffectsLibraries);
+
+	UAudioComponent* SpawnPooledSound(ULyraContextEffectsSet& EffectsLibrariesSet, USoundBase* Sound, USceneComponent* AttachToComponent, const FName AttachPoint,
+		const FVector& LocationOffset, const FRotator& RotationOffset, float AudioVolume, float AudioPitch);
 
 	UPROPERTY(Transient)
 	TMap<AActor*, ULyraContextEffectsSet*> ActiveActorEffectsMap;
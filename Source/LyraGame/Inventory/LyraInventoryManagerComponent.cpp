@@ -5,6 +5,11 @@
 #include "LyraInventoryItemDefinition.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/ActorChannel.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "LyraLogChannels.h"
+#include "UObject/UObjectHash.h"
 
 #include "NativeGameplayTags.h"
 #include "GameFramework/GameplayMessageSubsystem.h"
@@ -35,6 +40,7 @@ void FLyraInventoryList::PreReplicatedRemove(const TArrayView<int32> RemovedIndi
 		FLyraInventoryEntry& Stack = Entries[Index];
 		BroadcastChangeMessage(Stack, /*OldCount=*/ Stack.StackCount, /*NewCount=*/ 0);
 		Stack.LastObservedCount = 0;
+		RemoveFromDefinitionIndex(Stack.Instance);
 	}
 }
 
@@ -43,6 +49,7 @@ void FLyraInventoryList::PostReplicatedAdd(const TArrayView<int32> AddedIndices,
 	for (int32 Index : AddedIndices)
 	{
 		FLyraInventoryEntry& Stack = Entries[Index];
+		AddToDefinitionIndex(Stack.Instance);
 		BroadcastChangeMessage(Stack, /*OldCount=*/ 0, /*NewCount=*/ Stack.StackCount);
 		Stack.LastObservedCount = Stack.StackCount;
 	}
@@ -50,6 +57,12 @@ void FLyraInventoryList::PostReplicatedAdd(const TArrayView<int32> AddedIndices,
 
 void FLyraInventoryList::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
 {
+	// The instance reference itself may have changed (or just been resolved), cheaper to rebuild on demand than to diff
+	if (ChangedIndices.Num() > 0)
+	{
+		bDefinitionIndexDirty = true;
+	}
+
 	for (int32 Index : ChangedIndices)
 	{
 		FLyraInventoryEntry& Stack = Entries[Index];
@@ -94,6 +107,7 @@ ULyraInventoryItemInstance* FLyraInventoryList::AddEntry(TSubclassOf<ULyraInvent
 	}
 	NewEntry.StackCount = StackCount;
 	Result = NewEntry.Instance;
+	AddToDefinitionIndex(Result);
 
 	//const ULyraInventoryItemDefinition* ItemCDO = GetDefault<ULyraInventoryItemDefinition>(ItemDef);
 	MarkItemDirty(NewEntry);
@@ -108,13 +122,99 @@ void FLyraInventoryList::AddEntry(ULyraInventoryItemInstance* Instance)
 
 void FLyraInventoryList::RemoveEntry(ULyraInventoryItemInstance* Instance)
 {
+	RemoveEntries(MakeArrayView(&Instance, 1));
+}
+
+void FLyraInventoryList::RemoveEntries(TArrayView<ULyraInventoryItemInstance* const> Instances)
+{
+	if (Instances.Num() == 0)
+	{
+		return;
+	}
+
+	bool bRemovedAny = false;
 	for (auto EntryIt = Entries.CreateIterator(); EntryIt; ++EntryIt)
 	{
 		FLyraInventoryEntry& Entry = *EntryIt;
-		if (Entry.Instance == Instance)
+		if (Instances.Contains(Entry.Instance))
 		{
+			RemoveFromDefinitionIndex(Entry.Instance);
 			EntryIt.RemoveCurrent();
-			MarkArrayDirty();
+			bRemovedAny = true;
+		}
+	}
+
+	if (bRemovedAny)
+	{
+		MarkArrayDirty();
+	}
+}
+
+TArrayView<ULyraInventoryItemInstance* const> FLyraInventoryList::FindInstancesByDefinition(TSubclassOf<ULyraInventoryItemDefinition> ItemDef) const
+{
+	RebuildDefinitionIndexIfNeeded();
+
+	if (const TArray<ULyraInventoryItemInstance*>* Instances = InstancesByDefinition.Find(ItemDef.Get()))
+	{
+		return *Instances;
+	}
+	return TArrayView<ULyraInventoryItemInstance* const>();
+}
+
+void FLyraInventoryList::AddToDefinitionIndex(ULyraInventoryItemInstance* Instance)
+{
+	const UClass* ItemDef = (Instance != nullptr) ? Instance->GetItemDef().Get() : nullptr;
+	if (ItemDef == nullptr)
+	{
+		// Not resolved yet on this client, pick it up on the next lookup
+		bDefinitionIndexDirty = true;
+		return;
+	}
+
+	InstancesByDefinition.FindOrAdd(ItemDef).Add(Instance);
+}
+
+void FLyraInventoryList::RemoveFromDefinitionIndex(ULyraInventoryItemInstance* Instance)
+{
+	const UClass* ItemDef = (Instance != nullptr) ? Instance->GetItemDef().Get() : nullptr;
+	if (ItemDef == nullptr)
+	{
+		bDefinitionIndexDirty = true;
+		return;
+	}
+
+	if (TArray<ULyraInventoryItemInstance*>* Instances = InstancesByDefinition.Find(ItemDef))
+	{
+		// Stable removal so the index keeps matching entry order
+		Instances->RemoveSingle(Instance);
+		if (Instances->Num() == 0)
+		{
+			InstancesByDefinition.Remove(ItemDef);
+		}
+	}
+}
+
+void FLyraInventoryList::RebuildDefinitionIndexIfNeeded() const
+{
+	if (!bDefinitionIndexDirty)
+	{
+		return;
+	}
+
+	InstancesByDefinition.Reset();
+	bDefinitionIndexDirty = false;
+
+	for (const FLyraInventoryEntry& Entry : Entries)
+	{
+		const UClass* ItemDef = (Entry.Instance != nullptr) ? Entry.Instance->GetItemDef().Get() : nullptr;
+		if (ItemDef != nullptr)
+		{
+			InstancesByDefinition.FindOrAdd(ItemDef).Add(Entry.Instance);
+		}
+		else
+		{
+			// Still waiting on replication for this entry, try again next time
+			bDefinitionIndexDirty = true;
 		}
 	}
 }
@@ -183,16 +283,11 @@ TArray<ULyraInventoryItemInstance*> ULyraInventoryManagerComponent::GetAllItems(
 
 ULyraInventoryItemInstance* ULyraInventoryManagerComponent::FindFirstItemStackByDefinition(TSubclassOf<ULyraInventoryItemDefinition> ItemDef) const
 {
-	for (const FLyraInventoryEntry& Entry : InventoryList.Entries)
+	for (ULyraInventoryItemInstance* Instance : InventoryList.FindInstancesByDefinition(ItemDef))
 	{
-		ULyraInventoryItemInstance* Instance = Entry.Instance;
-
 		if (IsValid(Instance))
 		{
-			if (Instance->GetItemDef() == ItemDef)
-			{
-				return Instance;
-			}
+			return Instance;
 		}
 	}
 
@@ -202,16 +297,11 @@ ULyraInventoryItemInstance* ULyraInventoryManagerComponent::FindFirstItemStackBy
 int32 ULyraInventoryManagerComponent::GetTotalItemCountByDefinition(TSubclassOf<ULyraInventoryItemDefinition> ItemDef) const
 {
 	int32 TotalCount = 0;
-	for (const FLyraInventoryEntry& Entry : InventoryList.Entries)
+	for (ULyraInventoryItemInstance* Instance : InventoryList.FindInstancesByDefinition(ItemDef))
 	{
-		ULyraInventoryItemInstance* Instance = Entry.Instance;
-
 		if (IsValid(Instance))
 		{
-			if (Instance->GetItemDef() == ItemDef)
-			{
-				++TotalCount;
-			}
+			++TotalCount;
 		}
 	}
 
@@ -226,22 +316,24 @@ bool ULyraInventoryManagerComponent::ConsumeItemsByDefinition(TSubclassOf<ULyraI
 		return false;
 	}
 
-	//@TODO: N squared right now as there's no acceleration structure
-	int32 TotalConsumed = 0;
-	while (TotalConsumed < NumToConsume)
+	// Gather the first NumToConsume stacks from the definition index, then remove them in a single pass
+	TArray<ULyraInventoryItemInstance*, TInlineAllocator<8>> InstancesToConsume;
+	for (ULyraInventoryItemInstance* Instance : InventoryList.FindInstancesByDefinition(ItemDef))
 	{
-		if (ULyraInventoryItemInstance* Instance = ULyraInventoryManagerComponent::FindFirstItemStackByDefinition(ItemDef))
+		if (InstancesToConsume.Num() >= NumToConsume)
 		{
-			InventoryList.RemoveEntry(Instance);
-			++TotalConsumed;
+			break;
 		}
-		else
+
+		if (IsValid(Instance))
 		{
-			return false;
+			InstancesToConsume.AddUnique(Instance);
 		}
 	}
 
-	return TotalConsumed == NumToConsume;
+	InventoryList.RemoveEntries(InstancesToConsume);
+
+	return InstancesToConsume.Num() == NumToConsume;
 }
 
 bool ULyraInventoryManagerComponent::ReplicateSubobjects(UActorChannel* Channel, class FOutBunch* Bunch, FReplicationFlags* RepFlags)
@@ -261,6 +353,84 @@ bool ULyraInventoryManagerComponent::ReplicateSubobjects(UActorChannel* Channel,
 	return WroteSomething;
 }
 
+//////////////////////////////////////////////////////////////////////
+// Lookup benchmark
+
+#if !UE_BUILD_SHIPPING
+namespace LyraInventory
+{
+	static void BenchmarkLookups(const TArray<FString>& Args, UWorld* World)
+	{
+		AActor* OwningActor = (World != nullptr) ? World->GetWorldSettings() : nullptr;
+		if ((OwningActor == nullptr) || !OwningActor->HasAuthority())
+		{
+			UE_LOG(LogLyra, Warning, TEXT("Lyra.Inventory.BenchmarkLookups must be run on a world with authority"));
+			return;
+		}
+
+		const int32 NumStacks = (Args.Num() > 0) ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 500;
+		const int32 NumQueries = (Args.Num() > 1) ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 10000;
+
+		// Spread the stacks over whatever item definitions are currently loaded
+		TArray<UClass*> ItemDefs;
+		GetDerivedClasses(ULyraInventoryItemDefinition::StaticClass(), ItemDefs);
+		ItemDefs.RemoveAll([](const UClass* ItemDef)
+		{
+			return ItemDef->HasAnyClassFlags(CLASS_NewerVersionExists) || ItemDef->GetName().StartsWith(TEXT("SKEL_"));
+		});
+		ItemDefs.Add(ULyraInventoryItemDefinition::StaticClass());
+
+		ULyraInventoryManagerComponent* Inventory = NewObject<ULyraInventoryManagerComponent>(OwningActor, NAME_None, RF_Transient);
+		for (int32 StackIndex = 0; StackIndex < NumStacks; ++StackIndex)
+		{
+			Inventory->AddItemDefinition(ItemDefs[StackIndex % ItemDefs.Num()], 1);
+		}
+
+		int32 Checksum = 0;
+
+		const double FindStartTime = FPlatformTime::Seconds();
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+		{
+			Checksum += (Inventory->FindFirstItemStackByDefinition(ItemDefs[QueryIndex % ItemDefs.Num()]) != nullptr) ? 1 : 0;
+		}
+		const double FindTime = FPlatformTime::Seconds() - FindStartTime;
+
+		const double CountStartTime = FPlatformTime::Seconds();
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+		{
+			Checksum += Inventory->GetTotalItemCountByDefinition(ItemDefs[QueryIndex % ItemDefs.Num()]);
+		}
+		const double CountTime = FPlatformTime::Seconds() - CountStartTime;
+
+		// Consume everything, a handful of stacks at a time
+		int32 NumConsumeCalls = 0;
+		const double ConsumeStartTime = FPlatformTime::Seconds();
+		for (UClass* ItemDef : ItemDefs)
+		{
+			while (Inventory->ConsumeItemsByDefinition(ItemDef, 4))
+			{
+				++NumConsumeCalls;
+			}
+			++NumConsumeCalls;
+		}
+		const double ConsumeTime = FPlatformTime::Seconds() - ConsumeStartTime;
+
+		UE_LOG(LogLyra, Display, TEXT("Inventory lookups with %d stacks over %d item definitions (checksum %d, %d stacks left):"), NumStacks, ItemDefs.Num(), Checksum, Inventory->GetAllItems().Num());
+		UE_LOG(LogLyra, Display, TEXT("  FindFirstItemStackByDefinition: %.3f us/query (%d queries)"), FindTime * 1e6 / NumQueries, NumQueries);
+		UE_LOG(LogLyra, Display, TEXT("  GetTotalItemCountByDefinition:  %.3f us/query (%d queries)"), CountTime * 1e6 / NumQueries, NumQueries);
+		UE_LOG(LogLyra, Display, TEXT("  ConsumeItemsByDefinition:       %.3f us/call (%d calls)"), ConsumeTime * 1e6 / NumConsumeCalls, NumConsumeCalls);
+
+		Inventory->MarkAsGarbage();
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs CVarBenchmarkLookups(
+		TEXT("Lyra.Inventory.BenchmarkLookups"),
+		TEXT("Fills a transient inventory and times the item definition lookups. Usage: Lyra.Inventory.BenchmarkLookups [NumStacks=500] [NumQueries=10000]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(BenchmarkLookups),
+		ECVF_Cheat);
+}
+#endif // !UE_BUILD_SHIPPING
+
 //////////////////////////////////////////////////////////////////////
 //
 
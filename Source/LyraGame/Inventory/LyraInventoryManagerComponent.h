@@ -93,9 +93,19 @@ public:
 
 	void RemoveEntry(ULyraInventoryItemInstance* Instance);
 
+	// Removes every entry referencing one of the instances in a single pass over the list
+	void RemoveEntries(TArrayView<ULyraInventoryItemInstance* const> Instances);
+
+	// Returns the instances using the given item definition, in entry order (may contain instances that are no longer valid)
+	TArrayView<ULyraInventoryItemInstance* const> FindInstancesByDefinition(TSubclassOf<ULyraInventoryItemDefinition> ItemDef) const;
+
 private:
 	void BroadcastChangeMessage(FLyraInventoryEntry& Entry, int32 OldCount, int32 NewCount);
 
+	void AddToDefinitionIndex(ULyraInventoryItemInstance* Instance);
+	void RemoveFromDefinitionIndex(ULyraInventoryItemInstance* Instance);
+	void RebuildDefinitionIndexIfNeeded() const;
+
 private:
 	friend ULyraInventoryManagerComponent;
 
@@ -106,6 +116,12 @@ private:
 
 	UPROPERTY()
 	UActorComponent* OwnerComponent;
+
+	// Acceleration structure from item definition to the instances using it, kept in entry order.
+	// Maintained incrementally on the authority; replicated changes may arrive before the instance
+	// (or its item definition) is resolved, in which case it is rebuilt on the next lookup instead.
+	mutable TMap<const UClass*, TArray<ULyraInventoryItemInstance*>> InstancesByDefinition;
+	mutable bool bDefinitionIndexDirty = false;
 };
 
 template<>
@@ -69,7 +69,8 @@ public class LyraGame : ModuleRules
 				"NetworkReplayStreaming",
 				"UIExtension",
 				"ClientPilot",
-				"AudioModulation"
+				"AudioModulation",
+				"AkAudio"
 			}
 		);
 
@@ -2,6 +2,57 @@
 
 #include "LyraVerbMessageReplication.h"
 #include "GameFramework/GameplayMessageSubsystem.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/NetConnection.h"
+#include "Engine/PackageMapClient.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "LyraLogChannels.h"
+#include "LyraVerbMessageHelpers.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Verb Message Bytes Replicated"), STAT_LyraVerbMessageBytesReplicated, STATGROUP_Net);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Verb Messages Expired"), STAT_LyraVerbMessagesExpired, STATGROUP_Net);
+
+namespace LyraVerbMessages
+{
+	static int32 TrackReplicationStats = 0;
+	static FAutoConsoleVariableRef CVarTrackReplicationStats(
+		TEXT("Lyra.VerbMessages.TrackReplicationStats"),
+		TrackReplicationStats,
+		TEXT("Should the bytes replicated for verb messages be tracked per verb? See Lyra.VerbMessages.DumpReplicationStats"),
+		ECVF_Default);
+
+	struct FVerbReplicationStats
+	{
+		int64 NumWrites = 0;
+		int64 NumBits = 0;
+	};
+
+	// Updates that only carried removals or headers are accounted against the empty tag
+	static TMap<FGameplayTag, FVerbReplicationStats> ReplicationStatsPerVerb;
+
+	static void DumpReplicationStats()
+	{
+		ReplicationStatsPerVerb.ValueSort([](const FVerbReplicationStats& A, const FVerbReplicationStats& B) { return A.NumBits > B.NumBits; });
+
+		UE_LOG(LogLyra, Log, TEXT("Verb message replication (header overhead is split evenly between the messages written together):"));
+		UE_LOG(LogLyra, Log, TEXT("  Verb	Writes	Bytes	BytesPerWrite"));
+		for (const auto& KVP : ReplicationStatsPerVerb)
+		{
+			const double NumBytes = KVP.Value.NumBits / 8.0;
+			UE_LOG(LogLyra, Log, TEXT("  %s	%lld	%.0f	%.1f"),
+				KVP.Key.IsValid() ? *KVP.Key.ToString() : TEXT("(overhead)"),
+				KVP.Value.NumWrites,
+				NumBytes,
+				(KVP.Value.NumWrites > 0) ? NumBytes / KVP.Value.NumWrites : 0.0);
+		}
+	}
+
+	static FAutoConsoleCommand CVarDumpReplicationStats(
+		TEXT("Lyra.VerbMessages.DumpReplicationStats"),
+		TEXT("Logs the bytes replicated per verb since Lyra.VerbMessages.TrackReplicationStats was enabled"),
+		FConsoleCommandDelegate::CreateStatic(DumpReplicationStats));
+}
 
 //////////////////////////////////////////////////////////////////////
 // FLyraVerbMessageReplicationEntry
@@ -16,8 +67,190 @@ FString FLyraVerbMessageReplicationEntry::GetDebugString() const
 
 void FLyraVerbMessageReplication::AddMessage(const FLyraVerbMessage& Message)
 {
-	FLyraVerbMessageReplicationEntry& NewStack = CurrentMessages.Emplace_GetRef(Message);
-	MarkItemDirty(NewStack);
+	RemoveExpiredMessages();
+
+	const double CurrentTime = GetServerTime();
+
+	if ((MaxMessages > 0) && (CurrentMessages.Num() >= MaxMessages))
+	{
+		// Full, reuse the oldest slot like a ring buffer; clients receive it as a change and rebroadcast the new contents
+		int32 OldestIndex = 0;
+		for (int32 Index = 1; Index < CurrentMessages.Num(); ++Index)
+		{
+			if (CurrentMessages[Index].ServerTime < CurrentMessages[OldestIndex].ServerTime)
+			{
+				OldestIndex = Index;
+			}
+		}
+
+		FLyraVerbMessageReplicationEntry& OldestEntry = CurrentMessages[OldestIndex];
+		OldestEntry.Message = Message;
+		OldestEntry.ServerTime = CurrentTime;
+		MarkItemDirty(OldestEntry);
+	}
+	else
+	{
+		FLyraVerbMessageReplicationEntry& NewStack = CurrentMessages.Emplace_GetRef(Message);
+		NewStack.ServerTime = CurrentTime;
+		MarkItemDirty(NewStack);
+	}
+}
+
+void FLyraVerbMessageReplication::SetRetentionPolicy(int32 InMaxMessages, float InMessageLifetime)
+{
+	MaxMessages = InMaxMessages;
+	MessageLifetime = InMessageLifetime;
+
+	RemoveExpiredMessages();
+}
+
+void FLyraVerbMessageReplication::RemoveExpiredMessages()
+{
+	if (CurrentMessages.Num() == 0)
+	{
+		return;
+	}
+
+	int32 NumRemoved = 0;
+
+	if (MessageLifetime > 0.0f)
+	{
+		const double ExpiryTime = GetServerTime() - MessageLifetime;
+		NumRemoved += CurrentMessages.RemoveAll([ExpiryTime](const FLyraVerbMessageReplicationEntry& Entry) { return Entry.ServerTime < ExpiryTime; });
+	}
+
+	// The limit may have been lowered since these were added, drop the oldest ones
+	if ((MaxMessages > 0) && (CurrentMessages.Num() > MaxMessages))
+	{
+		CurrentMessages.Sort([](const FLyraVerbMessageReplicationEntry& A, const FLyraVerbMessageReplicationEntry& B) { return A.ServerTime > B.ServerTime; });
+		NumRemoved += CurrentMessages.Num() - MaxMessages;
+		CurrentMessages.SetNum(MaxMessages);
+	}
+
+	if (NumRemoved > 0)
+	{
+		INC_DWORD_STAT_BY(STAT_LyraVerbMessagesExpired, NumRemoved);
+		MarkArrayDirty();
+	}
+}
+
+bool FLyraVerbMessageReplication::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+	UPackageMapClient* PackageMap = Cast<UPackageMapClient>(DeltaParms.Map);
+	SerializingConnection = ((DeltaParms.Writer != nullptr) && (PackageMap != nullptr)) ? PackageMap->GetConnection() : nullptr;
+
+	const int64 StartBits = (DeltaParms.Writer != nullptr) ? DeltaParms.Writer->GetNumBits() : 0;
+
+	const bool bResult = FFastArraySerializer::FastArrayDeltaSerialize<FLyraVerbMessageReplicationEntry, FLyraVerbMessageReplication>(CurrentMessages, DeltaParms, *this);
+
+	if (DeltaParms.Writer != nullptr)
+	{
+		const int64 NumBits = DeltaParms.Writer->GetNumBits() - StartBits;
+		INC_DWORD_STAT_BY(STAT_LyraVerbMessageBytesReplicated, (NumBits + 7) / 8);
+
+		if ((LyraVerbMessages::TrackReplicationStats != 0) && (NumBits > 0) && (SerializingConnection != nullptr))
+		{
+			RecordReplicationStats(NumBits);
+		}
+	}
+
+	SerializingConnection = nullptr;
+
+	return bResult;
+}
+
+bool FLyraVerbMessageReplication::IsRelevantToConnection(const FLyraVerbMessage& Message, UNetConnection* Connection) const
+{
+	APlayerController* InstigatorPC = ULyraVerbMessageHelpers::GetPlayerControllerFromObject(Message.Instigator);
+	APlayerController* TargetPC = ULyraVerbMessageHelpers::GetPlayerControllerFromObject(Message.Target);
+
+	// Messages that don't involve any player (world events, AI vs AI) concern everyone
+	if ((InstigatorPC == nullptr) && (TargetPC == nullptr))
+	{
+		return true;
+	}
+
+	auto IsParticipant = [InstigatorPC, TargetPC](const UNetConnection* TestConnection)
+	{
+		const APlayerController* ConnectionPC = TestConnection->PlayerController;
+		return (ConnectionPC != nullptr) && ((ConnectionPC == InstigatorPC) || (ConnectionPC == TargetPC));
+	};
+
+	if (IsParticipant(Connection))
+	{
+		return true;
+	}
+
+	// Split screen players share their parent's connection
+	for (const UNetConnection* ChildConnection : Connection->Children)
+	{
+		if (IsParticipant(ChildConnection))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+double FLyraVerbMessageReplication::GetServerTime() const
+{
+	const UWorld* World = (Owner != nullptr) ? Owner->GetWorld() : nullptr;
+	return (World != nullptr) ? World->GetTimeSeconds() : FPlatformTime::Seconds();
+}
+
+void FLyraVerbMessageReplication::RecordReplicationStats(int64 NumBits)
+{
+	// Work out which messages were written by diffing against the keys we last saw go to this connection
+	TMap<int32, int32>& LastWrittenKeys = LastWrittenKeysPerConnection.FindOrAdd(SerializingConnection);
+
+	TArray<FGameplayTag, TInlineAllocator<8>> WrittenVerbs;
+	for (const FLyraVerbMessageReplicationEntry& Entry : CurrentMessages)
+	{
+		if ((Entry.ReplicationID == INDEX_NONE) || (bReplicateToParticipantsOnly && !IsRelevantToConnection(Entry.Message, SerializingConnection)))
+		{
+			continue;
+		}
+
+		int32& LastWrittenKey = LastWrittenKeys.FindOrAdd(Entry.ReplicationID, INDEX_NONE);
+		if (LastWrittenKey != Entry.ReplicationKey)
+		{
+			LastWrittenKey = Entry.ReplicationKey;
+			WrittenVerbs.Add(Entry.Message.Verb);
+		}
+	}
+
+	// Forget about removed messages and closed connections
+	if (LastWrittenKeys.Num() > CurrentMessages.Num())
+	{
+		for (auto It = LastWrittenKeys.CreateIterator(); It; ++It)
+		{
+			if (!CurrentMessages.ContainsByPredicate([ID = It.Key()](const FLyraVerbMessageReplicationEntry& Entry) { return Entry.ReplicationID == ID; }))
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+	for (auto It = LastWrittenKeysPerConnection.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if (WrittenVerbs.Num() == 0)
+	{
+		WrittenVerbs.Add(FGameplayTag());
+	}
+
+	const int64 BitsPerMessage = NumBits / WrittenVerbs.Num();
+	for (const FGameplayTag& Verb : WrittenVerbs)
+	{
+		LyraVerbMessages::FVerbReplicationStats& Stats = LyraVerbMessages::ReplicationStatsPerVerb.FindOrAdd(Verb);
+		++Stats.NumWrites;
+		Stats.NumBits += BitsPerMessage;
+	}
 }
 
 void FLyraVerbMessageReplication::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
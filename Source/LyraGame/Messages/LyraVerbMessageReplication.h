@@ -7,6 +7,7 @@
 #include "LyraVerbMessage.h"
 #include "LyraVerbMessageReplication.generated.h"
 
+class UNetConnection;
 struct FLyraVerbMessageReplication;
 
 /**
@@ -32,6 +33,9 @@ private:
 
 	UPROPERTY()
 	FLyraVerbMessage Message;
+
+	// World time at which the message was added on the authority (not replicated)
+	double ServerTime = 0.0;
 };
 
 /** Container of verb messages to replicate */
@@ -50,20 +54,51 @@ public:
 	// Broadcasts a message from server to clients
 	void AddMessage(const FLyraVerbMessage& Message);
 
+	/**
+	 * Sets how many messages are kept for replication and for how long (a value <= 0 disables that limit)
+	 * Once full, new messages reuse the slot of the oldest message, so the replicated array never grows past InMaxMessages
+	 */
+	void SetRetentionPolicy(int32 InMaxMessages, float InMessageLifetime);
+
+	// When enabled, messages whose instigator or target belongs to a player are only replicated to that player's connection
+	void SetReplicateToParticipantsOnly(bool bEnabled) { bReplicateToParticipantsOnly = bEnabled; }
+
+	// Removes messages that have outlived the retention policy (called automatically when adding messages)
+	void RemoveExpiredMessages();
+
 	//~FFastArraySerializer contract
 	void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
 	void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
 	void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
 	//~End of FFastArraySerializer contract
 
-	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+
+	template<typename Type, typename SerializerType>
+	bool ShouldWriteFastArrayItem(const Type& Item, const bool bIsWritingOnClient)
 	{
-		return FFastArraySerializer::FastArrayDeltaSerialize<FLyraVerbMessageReplicationEntry, FLyraVerbMessageReplication>(CurrentMessages, DeltaParms, *this);
+		if (!FFastArraySerializer::ShouldWriteFastArrayItem<Type, SerializerType>(Item, bIsWritingOnClient))
+		{
+			return false;
+		}
+
+		if (bIsWritingOnClient || !bReplicateToParticipantsOnly || (SerializingConnection == nullptr))
+		{
+			return true;
+		}
+
+		return IsRelevantToConnection(Item.Message, SerializingConnection);
 	}
 
 private:
 	void RebroadcastMessage(const FLyraVerbMessage& Message);
 
+	bool IsRelevantToConnection(const FLyraVerbMessage& Message, UNetConnection* Connection) const;
+
+	double GetServerTime() const;
+
+	void RecordReplicationStats(int64 NumBits);
+
 private:
 	// Replicated list of gameplay tag stacks
 	UPROPERTY()
@@ -72,6 +107,16 @@ private:
 	// Owner (for a route to a world)
 	UPROPERTY()
 	UObject* Owner = nullptr;
+
+	int32 MaxMessages = 32;
+	float MessageLifetime = 10.0f;
+	bool bReplicateToParticipantsOnly = true;
+
+	// Connection we are currently writing to, only set during NetDeltaSerialize
+	UNetConnection* SerializingConnection = nullptr;
+
+	// Replication keys last written to each connection, only tracked while Lyra.VerbMessages.TrackReplicationStats is enabled
+	TMap<TWeakObjectPtr<UNetConnection>, TMap<int32, int32>> LastWrittenKeysPerConnection;
 };
 
 template<>
@@ -7,12 +7,204 @@
 #include "Engine/Engine.h"
 #include "Engine/NetConnection.h"
 #include "GameModes/LyraGameState.h"
+#include "LyraLogChannels.h"
+#include "AkAudioDevice.h"
+#include "Wwise/LowLevel/WwiseLowLevelSoundEngine.h"
+#include "Wwise/Stats/FileHandler.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+CSV_DEFINE_CATEGORY(LyraAudio, true);
+
+namespace LyraPerformanceStats
+{
+	static int32 HistorySize = 1800;
+	static FAutoConsoleVariableRef CVarHistorySize(
+		TEXT("Lyra.PerfStats.HistorySize"),
+		HistorySize,
+		TEXT("Number of frames of history kept for each performance stat (used for percentiles and hitch counts)"),
+		ECVF_Default);
+
+	// Latest summary from the Wwise resource monitor, written from the audio render thread
+	static FCriticalSection AudioResourcesCriticalSection;
+	static AkResourceMonitorDataSummary LatestAudioResources = {};
+	static int32 AudioResourceMonitorRefCount = 0;
+
+	static void OnAudioResourceMonitor(const AkResourceMonitorDataSummary* Summary)
+	{
+		if (Summary != nullptr)
+		{
+			FScopeLock Lock(&AudioResourcesCriticalSection);
+			LatestAudioResources = *Summary;
+		}
+	}
+
+	static bool IsSoundEngineInitialized()
+	{
+		return (FAkAudioDevice::Get() != nullptr) && FWwiseLowLevelSoundEngine::Get()->IsInitialized();
+	}
+
+	static void ExportStatsToCSV(const TArray<FString>& Args, UWorld* World)
+	{
+		UGameInstance* GameInstance = (World != nullptr) ? World->GetGameInstance() : nullptr;
+		ULyraPerformanceStatSubsystem* Subsystem = (GameInstance != nullptr) ? GameInstance->GetSubsystem<ULyraPerformanceStatSubsystem>() : nullptr;
+		if (Subsystem == nullptr)
+		{
+			UE_LOG(LogLyra, Warning, TEXT("Lyra.PerfStats.ExportCSV: No performance stat subsystem in this world"));
+			return;
+		}
+
+		bool bIncludeHistory = false;
+		FString Filename;
+		for (const FString& Arg : Args)
+		{
+			if (Arg.Equals(TEXT("-history"), ESearchCase::IgnoreCase))
+			{
+				bIncludeHistory = true;
+			}
+			else
+			{
+				Filename = Arg;
+			}
+		}
+
+		if (Filename.IsEmpty())
+		{
+			Filename = FPaths::ProfilingDir() / TEXT("LyraPerfStats") / FString::Printf(TEXT("PerfStats-%s.csv"), *FDateTime::Now().ToString());
+		}
+
+		Subsystem->ExportStatsToCSV(Filename, bIncludeHistory);
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs CVarExportStatsToCSV(
+		TEXT("Lyra.PerfStats.ExportCSV"),
+		TEXT("Writes the recent performance stat history to CSV. Usage: Lyra.PerfStats.ExportCSV [Filename] [-history]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(ExportStatsToCSV));
+}
+
+//////////////////////////////////////////////////////////////////////
+// FLyraPerformanceStatHistory
+
+void FLyraPerformanceStatHistory::Reset(int32 InCapacity)
+{
+	Samples.Reset();
+	Samples.SetNumZeroed(FMath::Max(InCapacity, 1));
+	NextIndex = 0;
+	NumSamples = 0;
+	SortedSamples.Reset();
+	bSortedSamplesDirty = true;
+}
+
+void FLyraPerformanceStatHistory::AddSample(double Value)
+{
+	if (Samples.Num() == 0)
+	{
+		Reset(LyraPerformanceStats::HistorySize);
+	}
+
+	Samples[NextIndex] = Value;
+	NextIndex = (NextIndex + 1) % Samples.Num();
+	NumSamples = FMath::Min(NumSamples + 1, Samples.Num());
+	bSortedSamplesDirty = true;
+}
+
+double FLyraPerformanceStatHistory::GetSample(int32 Index) const
+{
+	check((Index >= 0) && (Index < NumSamples));
+	const int32 OldestIndex = (NumSamples < Samples.Num()) ? 0 : NextIndex;
+	return Samples[(OldestIndex + Index) % Samples.Num()];
+}
+
+double FLyraPerformanceStatHistory::GetLatest() const
+{
+	return (NumSamples > 0) ? GetSample(NumSamples - 1) : 0.0;
+}
+
+double FLyraPerformanceStatHistory::GetMin() const
+{
+	return GetPercentile(0.0);
+}
+
+double FLyraPerformanceStatHistory::GetMax() const
+{
+	return GetPercentile(1.0);
+}
+
+double FLyraPerformanceStatHistory::GetAverage() const
+{
+	if (NumSamples == 0)
+	{
+		return 0.0;
+	}
+
+	double Sum = 0.0;
+	for (int32 Index = 0; Index < NumSamples; ++Index)
+	{
+		Sum += Samples[Index];
+	}
+	return Sum / NumSamples;
+}
+
+double FLyraPerformanceStatHistory::GetPercentile(double Fraction) const
+{
+	if (NumSamples == 0)
+	{
+		return 0.0;
+	}
+
+	if (bSortedSamplesDirty)
+	{
+		// The ring buffer isn't full yet, only the first NumSamples entries are valid
+		SortedSamples.Reset(NumSamples);
+		SortedSamples.Append(Samples.GetData(), NumSamples);
+		SortedSamples.Sort();
+		bSortedSamplesDirty = false;
+	}
+
+	// Nearest-rank percentile
+	const int32 Rank = FMath::CeilToInt(FMath::Clamp(Fraction, 0.0, 1.0) * NumSamples);
+	return SortedSamples[FMath::Clamp(Rank - 1, 0, NumSamples - 1)];
+}
 
 //////////////////////////////////////////////////////////////////////
 // FLyraPerformanceStatCache
 
+FLyraPerformanceStatCache::FLyraPerformanceStatCache(ULyraPerformanceStatSubsystem* InSubsystem)
+	: MySubsystem(InSubsystem)
+{
+	ResetHistory();
+}
+
+FLyraPerformanceStatCache::~FLyraPerformanceStatCache()
+{
+	if (bRegisteredAudioResourceMonitor)
+	{
+		if ((--LyraPerformanceStats::AudioResourceMonitorRefCount == 0) && LyraPerformanceStats::IsSoundEngineInitialized())
+		{
+			FWwiseLowLevelSoundEngine::Get()->UnregisterResourceMonitorCallback(&LyraPerformanceStats::OnAudioResourceMonitor);
+		}
+	}
+}
+
+void FLyraPerformanceStatCache::ResetHistory()
+{
+	const int32 Capacity = FMath::Max(LyraPerformanceStats::HistorySize, 1);
+	for (FLyraPerformanceStatHistory& History : StatHistory)
+	{
+		History.Reset(Capacity);
+	}
+
+	HitchHistory.Reset();
+	HitchHistory.SetNumZeroed(Capacity);
+	NextHitchIndex = 0;
+	NumHitchesInHistory = 0;
+}
+
 void FLyraPerformanceStatCache::StartCharting()
 {
+	ResetHistory();
 }
 
 void FLyraPerformanceStatCache::ProcessFrame(const FFrameData& FrameData)
@@ -56,15 +248,130 @@ void FLyraPerformanceStatCache::ProcessFrame(const FFrameData& FrameData)
 			}
 		}
 	}
+
+	UpdateAudioStats();
+
+	// Record the frame in the history
+	if (StatHistory[0].GetCapacity() != FMath::Max(LyraPerformanceStats::HistorySize, 1))
+	{
+		ResetHistory();
+	}
+
+	for (ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+	{
+		StatHistory[(int32)Stat].AddSample(GetCachedStat(Stat));
+	}
+
+	// Keep a rolling count of the frames the engine flagged as hitches
+	const bool bHitch = (FrameData.HitchStatus != EFrameHitchType::NoHitch);
+	NumHitchesInHistory += (bHitch ? 1 : 0) - (HitchHistory[NextHitchIndex] ? 1 : 0);
+	HitchHistory[NextHitchIndex] = bHitch;
+	NextHitchIndex = (NextHitchIndex + 1) % HitchHistory.Num();
+}
+
+void FLyraPerformanceStatCache::UpdateAudioStats()
+{
+	using namespace LyraPerformanceStats;
+
+	CachedAudioCPU = 0.0f;
+	CachedAudioActiveVoices = 0.0f;
+	CachedAudioStreamingBandwidth = 0.0f;
+	CachedAudioStreamingDeadlineMisses = 0.0f;
+
+	// Registering the resource monitor may stall, only try once (it is unavailable in release builds of the sound engine)
+	if (!bRegisteredAudioResourceMonitor && IsSoundEngineInitialized())
+	{
+		bRegisteredAudioResourceMonitor = true;
+		if (AudioResourceMonitorRefCount++ == 0)
+		{
+			FWwiseLowLevelSoundEngine::Get()->RegisterResourceMonitorCallback(&OnAudioResourceMonitor);
+		}
+	}
+
+	if (bRegisteredAudioResourceMonitor)
+	{
+		FScopeLock Lock(&AudioResourcesCriticalSection);
+		CachedAudioCPU = LatestAudioResources.totalCPU;
+		CachedAudioActiveVoices = LatestAudioResources.physicalVoices;
+	}
+
+	const uint64 StreamedBytes = FWwiseFileHandlerCounters::TotalStreamedBytes.Load(EMemoryOrder::Relaxed);
+	const uint32 StreamingDeadlineMisses = FWwiseFileHandlerCounters::StreamingDeadlineMisses.Load(EMemoryOrder::Relaxed);
+	const uint32 NewStreamingDeadlineMisses = StreamingDeadlineMisses - LastStreamingDeadlineMisses;
+	if (CachedData.TrueDeltaSeconds > 0.0)
+	{
+		CachedAudioStreamingBandwidth = ((StreamedBytes - LastStreamedBytes) / 1024.0) / CachedData.TrueDeltaSeconds;
+		CachedAudioStreamingDeadlineMisses = NewStreamingDeadlineMisses / CachedData.TrueDeltaSeconds;
+	}
+	LastStreamedBytes = StreamedBytes;
+	LastStreamingDeadlineMisses = StreamingDeadlineMisses;
+
+	CSV_CUSTOM_STAT(LyraAudio, CPU, CachedAudioCPU, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(LyraAudio, ActiveVoices, CachedAudioActiveVoices, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(LyraAudio, StreamingKBPerSecond, CachedAudioStreamingBandwidth, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(LyraAudio, StreamingDeadlineMisses, (int32)NewStreamingDeadlineMisses, ECsvCustomStatOp::Set);
 }
 
 void FLyraPerformanceStatCache::StopCharting()
 {
+	// The history is kept so that it can still be queried or exported after charting stops
+}
+
+bool FLyraPerformanceStatCache::ExportToCSV(const FString& Filename, bool bIncludeHistory) const
+{
+	const UEnum* StatEnum = StaticEnum<ELyraDisplayablePerformanceStat>();
+
+	FString Summary = TEXT("Stat,Samples,Latest,Min,Average,P50,P95,P99,Max\n");
+	for (ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+	{
+		const FLyraPerformanceStatHistory& History = GetStatHistory(Stat);
+		Summary += FString::Printf(TEXT("%s,%d,%f,%f,%f,%f,%f,%f,%f\n"),
+			*StatEnum->GetNameStringByValue((int64)Stat),
+			History.Num(),
+			History.GetLatest(),
+			History.GetMin(),
+			History.GetAverage(),
+			History.GetPercentile(0.50),
+			History.GetPercentile(0.95),
+			History.GetPercentile(0.99),
+			History.GetMax());
+	}
+	Summary += FString::Printf(TEXT("Hitches,%d\n"), NumHitchesInHistory);
+
+	bool bSuccess = FFileHelper::SaveStringToFile(Summary, *Filename);
+
+	if (bSuccess && bIncludeHistory)
+	{
+		// One row per frame, one column per stat
+		FString History = TEXT("Frame");
+		for (ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+		{
+			History += TEXT(",") + StatEnum->GetNameStringByValue((int64)Stat);
+		}
+		History += TEXT("\n");
+
+		const int32 NumFrames = StatHistory[0].Num();
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			History += FString::Printf(TEXT("%d"), FrameIndex);
+			for (const FLyraPerformanceStatHistory& StatSamples : StatHistory)
+			{
+				History += FString::Printf(TEXT(",%f"), StatSamples.GetSample(FrameIndex));
+			}
+			History += TEXT("\n");
+		}
+
+		bSuccess = FFileHelper::SaveStringToFile(History, *(FPaths::GetBaseFilename(Filename, /*bRemovePath=*/ false) + TEXT("_History.csv")));
+	}
+
+	UE_CLOG(bSuccess, LogLyra, Log, TEXT("Wrote performance stats to %s"), *Filename);
+	UE_CLOG(!bSuccess, LogLyra, Warning, TEXT("Failed to write performance stats to %s"), *Filename);
+	return bSuccess;
 }
 
 double FLyraPerformanceStatCache::GetCachedStat(ELyraDisplayablePerformanceStat Stat) const
 {
-	static_assert((int32)ELyraDisplayablePerformanceStat::Count == 15, "Need to update this function to deal with new performance stats");
+	static_assert((int32)ELyraDisplayablePerformanceStat::Count == 19, "Need to update this function to deal with new performance stats");
 	switch (Stat)
 	{
 	case ELyraDisplayablePerformanceStat::ClientFPS:
@@ -97,6 +404,14 @@ double FLyraPerformanceStatCache::GetCachedStat(ELyraDisplayablePerformanceStat
 		return CachedPacketSizeIncoming;
 	case ELyraDisplayablePerformanceStat::PacketSize_Outgoing:
 		return CachedPacketSizeOutgoing;
+	case ELyraDisplayablePerformanceStat::AudioCPU:
+		return CachedAudioCPU;
+	case ELyraDisplayablePerformanceStat::AudioActiveVoices:
+		return CachedAudioActiveVoices;
+	case ELyraDisplayablePerformanceStat::AudioStreamingBandwidth:
+		return CachedAudioStreamingBandwidth;
+	case ELyraDisplayablePerformanceStat::AudioStreamingDeadlineMisses:
+		return CachedAudioStreamingDeadlineMisses;
 	}
 
 	return 0.0f;
@@ -121,3 +436,18 @@ double ULyraPerformanceStatSubsystem::GetCachedStat(ELyraDisplayablePerformanceS
 {
 	return Tracker->GetCachedStat(Stat);
 }
+
+double ULyraPerformanceStatSubsystem::GetStatPercentile(ELyraDisplayablePerformanceStat Stat, float Percentile) const
+{
+	return Tracker->GetStatHistory(Stat).GetPercentile(Percentile / 100.0);
+}
+
+int32 ULyraPerformanceStatSubsystem::GetRecentHitchCount() const
+{
+	return Tracker->GetHitchCount();
+}
+
+bool ULyraPerformanceStatSubsystem::ExportStatsToCSV(const FString& Filename, bool bIncludeHistory) const
+{
+	return Tracker->ExportToCSV(Filename, bIncludeHistory);
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ChartCreation.h"
+#include "Containers/StaticArray.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "LyraPerformanceStatTypes.h"
 
@@ -12,14 +13,47 @@ class ULyraPerformanceStatSubsystem;
 
 //////////////////////////////////////////////////////////////////////
 
-// Observer which caches the stats for the previous frame
+// Fixed-size ring buffer of the most recent samples of a single stat
+struct FLyraPerformanceStatHistory
+{
+public:
+	// Clears the history and sets how many samples it can hold
+	void Reset(int32 InCapacity);
+
+	void AddSample(double Value);
+
+	int32 Num() const { return NumSamples; }
+	int32 GetCapacity() const { return Samples.Num(); }
+
+	// Returns the Index-th oldest sample still in the history
+	double GetSample(int32 Index) const;
+
+	double GetLatest() const;
+	double GetMin() const;
+	double GetMax() const;
+	double GetAverage() const;
+
+	// Returns the value below which the given fraction (0..1) of the samples fall
+	double GetPercentile(double Fraction) const;
+
+private:
+	TArray<double> Samples;
+	int32 NextIndex = 0;
+	int32 NumSamples = 0;
+
+	// Sorted copy of the samples, rebuilt on demand when percentiles are requested
+	mutable TArray<double> SortedSamples;
+	mutable bool bSortedSamplesDirty = true;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// Observer which caches the stats for the previous frame, and keeps a short history of them
 struct FLyraPerformanceStatCache : public IPerformanceDataConsumer
 {
 public:
-	FLyraPerformanceStatCache(ULyraPerformanceStatSubsystem* InSubsystem)
-		: MySubsystem(InSubsystem)
-	{
-	}
+	FLyraPerformanceStatCache(ULyraPerformanceStatSubsystem* InSubsystem);
+	virtual ~FLyraPerformanceStatCache();
 
 	//~IPerformanceDataConsumer interface
 	virtual void StartCharting() override;
@@ -29,10 +63,27 @@ public:
 
 	double GetCachedStat(ELyraDisplayablePerformanceStat Stat) const;
 
+	const FLyraPerformanceStatHistory& GetStatHistory(ELyraDisplayablePerformanceStat Stat) const { return StatHistory[(int32)Stat]; }
+
+	// Returns the number of hitch frames detected by the engine in the current history window
+	int32 GetHitchCount() const { return NumHitchesInHistory; }
+
+	// Writes percentiles for every stat to a CSV file (and optionally the raw per-frame history to a second one)
+	bool ExportToCSV(const FString& Filename, bool bIncludeHistory) const;
+
+protected:
+	void ResetHistory();
+	void UpdateAudioStats();
+
 protected:
 	IPerformanceDataConsumer::FFrameData CachedData;
 	ULyraPerformanceStatSubsystem* MySubsystem;
 
+	TStaticArray<FLyraPerformanceStatHistory, (int32)ELyraDisplayablePerformanceStat::Count> StatHistory;
+	TArray<bool> HitchHistory;
+	int32 NextHitchIndex = 0;
+	int32 NumHitchesInHistory = 0;
+
 	float CachedServerFPS = 0.0f;
 	float CachedPingMS = 0.0f;
 	float CachedPacketLossIncomingPercent = 0.0f;
@@ -41,6 +92,15 @@ protected:
 	float CachedPacketRateOutgoing = 0.0f;
 	float CachedPacketSizeIncoming = 0.0f;
 	float CachedPacketSizeOutgoing = 0.0f;
+
+	float CachedAudioCPU = 0.0f;
+	float CachedAudioActiveVoices = 0.0f;
+	float CachedAudioStreamingBandwidth = 0.0f;
+	float CachedAudioStreamingDeadlineMisses = 0.0f;
+
+	uint64 LastStreamedBytes = 0;
+	uint32 LastStreamingDeadlineMisses = 0;
+	bool bRegisteredAudioResourceMonitor = false;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -55,6 +115,18 @@ public:
 	UFUNCTION(BlueprintCallable)
 	double GetCachedStat(ELyraDisplayablePerformanceStat Stat) const;
 
+	// Returns the value below which the given percentile (0..100) of recent frames fall
+	UFUNCTION(BlueprintCallable)
+	double GetStatPercentile(ELyraDisplayablePerformanceStat Stat, float Percentile) const;
+
+	// Returns the number of hitches in the recent frame history
+	UFUNCTION(BlueprintCallable)
+	int32 GetRecentHitchCount() const;
+
+	// Writes the recent stat history (percentiles, and optionally every sample) to CSV, returns false on failure
+	UFUNCTION(BlueprintCallable)
+	bool ExportStatsToCSV(const FString& Filename, bool bIncludeHistory = false) const;
+
 	//~USubsystem interface
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
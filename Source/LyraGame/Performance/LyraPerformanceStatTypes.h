@@ -77,6 +77,18 @@ enum class ELyraDisplayablePerformanceStat : uint8
 	// The avg. size (in bytes) of packets sent
 	PacketSize_Outgoing,
 
+	// Wwise sound engine CPU usage (%)
+	AudioCPU,
+
+	// Number of physical voices playing in Wwise
+	AudioActiveVoices,
+
+	// Wwise streaming bandwidth (in KB/s)
+	AudioStreamingBandwidth,
+
+	// Wwise streaming reads that completed after their deadline (per second)
+	AudioStreamingDeadlineMisses,
+
 	// New stats should go above here
 	Count UMETA(Hidden)
 };
@@ -10,9 +10,210 @@
 #include "EngineUtils.h"
 #include "Engine/PlayerStartPIE.h"
 #include "LyraPlayerStart.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "Teams/LyraTeamSubsystem.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogPlayerSpawning, Log, All);
 
+DECLARE_CYCLE_STAT(TEXT("Choose Scored Player Start"), STAT_LyraChooseScoredPlayerStart, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Build Team Pawn Spatial Hash"), STAT_LyraBuildTeamPawnSpatialHash, STATGROUP_Game);
+
+namespace LyraPlayerSpawning
+{
+	static float OccupancyCacheLifetime = 0.25f;
+	static FAutoConsoleVariableRef CVarOccupancyCacheLifetime(
+		TEXT("Lyra.Spawning.OccupancyCacheLifetime"),
+		OccupancyCacheLifetime,
+		TEXT("How long (in seconds) a player start occupancy test is reused before being run again (0 disables the cache)"),
+		ECVF_Default);
+
+	static float SpatialHashCellSize = 2500.0f;
+	static FAutoConsoleVariableRef CVarSpatialHashCellSize(
+		TEXT("Lyra.Spawning.SpatialHashCellSize"),
+		SpatialHashCellSize,
+		TEXT("Size (in cm) of the grid cells used to bucket pawns when scoring player starts"),
+		ECVF_Default);
+
+#if !UE_BUILD_SHIPPING
+	// Synthetic benchmark: nearest enemy distance for every start, brute force vs spatial hash
+	static void BenchmarkSpawnScoring(const TArray<FString>& Args)
+	{
+		const int32 NumPlayers = (Args.Num() > 0) ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+		const int32 NumStarts = (Args.Num() > 1) ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 500;
+		const int32 NumTeams = 2;
+		const double MapExtent = 50000.0;
+
+		FRandomStream Random(1234);
+		auto RandomLocation = [&Random, MapExtent]()
+		{
+			return FVector(Random.FRandRange(-MapExtent, MapExtent), Random.FRandRange(-MapExtent, MapExtent), Random.FRandRange(0.0, 2000.0));
+		};
+
+		TArray<TPair<int32, FVector>> Pawns;
+		for (int32 PlayerIndex = 0; PlayerIndex < NumPlayers; ++PlayerIndex)
+		{
+			Pawns.Emplace(PlayerIndex % NumTeams, RandomLocation());
+		}
+
+		TArray<FVector> Starts;
+		for (int32 StartIndex = 0; StartIndex < NumStarts; ++StartIndex)
+		{
+			Starts.Add(RandomLocation());
+		}
+
+		// A respawn wave: every player picks a start
+		double BruteForceChecksum = 0.0;
+		const double BruteForceStartTime = FPlatformTime::Seconds();
+		for (int32 PlayerIndex = 0; PlayerIndex < NumPlayers; ++PlayerIndex)
+		{
+			const int32 TeamId = PlayerIndex % NumTeams;
+			double BestScore = -1.0;
+			for (const FVector& Start : Starts)
+			{
+				double NearestEnemy = TNumericLimits<double>::Max();
+				for (const TPair<int32, FVector>& Pawn : Pawns)
+				{
+					if (Pawn.Key != TeamId)
+					{
+						NearestEnemy = FMath::Min(NearestEnemy, FVector::DistSquared(Start, Pawn.Value));
+					}
+				}
+				BestScore = FMath::Max(BestScore, NearestEnemy);
+			}
+			BruteForceChecksum += BestScore;
+		}
+		const double BruteForceTime = FPlatformTime::Seconds() - BruteForceStartTime;
+
+		double HashChecksum = 0.0;
+		const double HashStartTime = FPlatformTime::Seconds();
+		FLyraTeamPawnSpatialHash Hash;
+		Hash.Reset(SpatialHashCellSize);
+		for (const TPair<int32, FVector>& Pawn : Pawns)
+		{
+			Hash.Add(Pawn.Key, Pawn.Value);
+		}
+		for (int32 PlayerIndex = 0; PlayerIndex < NumPlayers; ++PlayerIndex)
+		{
+			const int32 TeamId = PlayerIndex % NumTeams;
+			double BestScore = -1.0;
+			for (const FVector& Start : Starts)
+			{
+				BestScore = FMath::Max(BestScore, Hash.FindNearestDistanceSquaredNotOnTeam(Start, TeamId));
+			}
+			HashChecksum += BestScore;
+		}
+		const double HashTime = FPlatformTime::Seconds() - HashStartTime;
+
+		UE_LOG(LogPlayerSpawning, Display, TEXT("Spawn scoring for %d players over %d starts (cell size %.0f):"), NumPlayers, NumStarts, SpatialHashCellSize);
+		UE_LOG(LogPlayerSpawning, Display, TEXT("  Brute force:  %.3f ms (%.3f ms per spawn)"), BruteForceTime * 1000.0, BruteForceTime * 1000.0 / NumPlayers);
+		UE_LOG(LogPlayerSpawning, Display, TEXT("  Spatial hash: %.3f ms (%.3f ms per spawn)"), HashTime * 1000.0, HashTime * 1000.0 / NumPlayers);
+		UE_CLOG(!FMath::IsNearlyEqual(BruteForceChecksum, HashChecksum, 1.0), LogPlayerSpawning, Error, TEXT("  Results differ! (%f vs %f)"), BruteForceChecksum, HashChecksum);
+	}
+
+	static FAutoConsoleCommand CVarBenchmarkSpawnScoring(
+		TEXT("Lyra.Spawning.BenchmarkScoring"),
+		TEXT("Times nearest-enemy scoring of player starts on a synthetic map. Usage: Lyra.Spawning.BenchmarkScoring [NumPlayers=100] [NumStarts=500]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(BenchmarkSpawnScoring));
+#endif // !UE_BUILD_SHIPPING
+}
+
+//////////////////////////////////////////////////////////////////////
+// FLyraTeamPawnSpatialHash
+
+void FLyraTeamPawnSpatialHash::Reset(double InCellSize)
+{
+	Teams.Reset();
+	CellSize = FMath::Max(InCellSize, 1.0);
+	NumPawns = 0;
+}
+
+FIntPoint FLyraTeamPawnSpatialHash::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void FLyraTeamPawnSpatialHash::Add(int32 TeamId, const FVector& Location)
+{
+	const FIntPoint Cell = GetCell(Location);
+
+	FTeamCells& Team = Teams.FindOrAdd(TeamId);
+	Team.Cells.FindOrAdd(Cell).Add(Location);
+	Team.MinCell = Team.MinCell.ComponentMin(Cell);
+	Team.MaxCell = Team.MaxCell.ComponentMax(Cell);
+
+	++NumPawns;
+}
+
+bool FLyraTeamPawnSpatialHash::HasPawnsNotOnTeam(int32 TeamId) const
+{
+	for (const auto& KVP : Teams)
+	{
+		if (KVP.Key != TeamId)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+double FLyraTeamPawnSpatialHash::FindNearestDistanceSquaredNotOnTeam(const FVector& Location, int32 TeamId) const
+{
+	double BestDistanceSq = TNumericLimits<double>::Max();
+	for (const auto& KVP : Teams)
+	{
+		if (KVP.Key != TeamId)
+		{
+			BestDistanceSq = FMath::Min(BestDistanceSq, FindNearestDistanceSquared(KVP.Value, Location));
+		}
+	}
+	return BestDistanceSq;
+}
+
+double FLyraTeamPawnSpatialHash::FindNearestDistanceSquared(const FTeamCells& Team, const FVector& Location) const
+{
+	const FIntPoint Center = GetCell(Location);
+
+	// Rings beyond this distance can't contain anything from this team
+	const int32 MaxRing = FMath::Max(
+		FMath::Max(FMath::Abs(Team.MinCell.X - Center.X), FMath::Abs(Team.MaxCell.X - Center.X)),
+		FMath::Max(FMath::Abs(Team.MinCell.Y - Center.Y), FMath::Abs(Team.MaxCell.Y - Center.Y)));
+
+	double BestDistanceSq = TNumericLimits<double>::Max();
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		for (int32 Y = Center.Y - Ring; Y <= Center.Y + Ring; ++Y)
+		{
+			// Only the border of the ring, the inside was covered by the previous rings
+			const bool bEdgeRow = (Y == Center.Y - Ring) || (Y == Center.Y + Ring);
+			const int32 XStep = (bEdgeRow || Ring == 0) ? 1 : (2 * Ring);
+			for (int32 X = Center.X - Ring; X <= Center.X + Ring; X += XStep)
+			{
+				if (const TArray<FVector>* Locations = Team.Cells.Find(FIntPoint(X, Y)))
+				{
+					for (const FVector& PawnLocation : *Locations)
+					{
+						BestDistanceSq = FMath::Min(BestDistanceSq, FVector::DistSquared(Location, PawnLocation));
+					}
+				}
+			}
+		}
+
+		// Anything in the next ring is at least Ring cells away
+		const double NextRingDistance = Ring * CellSize;
+		if (BestDistanceSq <= NextRingDistance * NextRingDistance)
+		{
+			break;
+		}
+	}
+
+	return BestDistanceSq;
+}
+
+//////////////////////////////////////////////////////////////////////
+// ULyraPlayerSpawningManagerComponent
+
 ULyraPlayerSpawningManagerComponent::ULyraPlayerSpawningManagerComponent(const FObjectInitializer& ObjectInitializer)
 : Super(ObjectInitializer)
 {
@@ -119,6 +320,9 @@ AActor* ULyraPlayerSpawningManagerComponent::ChoosePlayerStart(AController* Play
 		if (ALyraPlayerStart* LyraStart = Cast<ALyraPlayerStart>(PlayerStart))
 		{
 			LyraStart->TryClaim(Player);
+
+			// Someone is about to spawn here, don't trust the cached occupancy anymore
+			CachedOccupancy.Remove(LyraStart);
 		}
 
 		return PlayerStart;
@@ -184,7 +388,7 @@ APlayerStart* ULyraPlayerSpawningManagerComponent::GetFirstRandomUnoccupiedPlaye
 
 		for (ALyraPlayerStart* StartPoint : StartPoints)
 		{
-			ELyraPlayerStartLocationOccupancy State = StartPoint->GetLocationOccupancy(Controller);
+			ELyraPlayerStartLocationOccupancy State = GetCachedLocationOccupancy(StartPoint, Controller);
 
 			switch (State)
 			{
@@ -210,3 +414,109 @@ APlayerStart* ULyraPlayerSpawningManagerComponent::GetFirstRandomUnoccupiedPlaye
 
 	return nullptr;
 }
+
+ALyraPlayerStart* ULyraPlayerSpawningManagerComponent::ChooseBestScoredPlayerStart(AController* Controller, const TArray<ALyraPlayerStart*>& PlayerStarts, FPlayerStartScoreFunc ScoreFunc) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_LyraChooseScoredPlayerStart);
+
+	ALyraPlayerStart* BestPlayerStart = nullptr;
+	double BestScore = 0.0;
+	ALyraPlayerStart* FallbackPlayerStart = nullptr;
+	double FallbackBestScore = 0.0;
+
+	for (ALyraPlayerStart* PlayerStart : PlayerStarts)
+	{
+		const double Score = ScoreFunc(*PlayerStart);
+		if (Score < 0.0)
+		{
+			continue;
+		}
+
+		if (PlayerStart->IsClaimed())
+		{
+			if ((FallbackPlayerStart == nullptr) || (Score > FallbackBestScore))
+			{
+				FallbackPlayerStart = PlayerStart;
+				FallbackBestScore = Score;
+			}
+		}
+		// Only run the (cached) occupancy test for starts that would actually win
+		else if (((BestPlayerStart == nullptr) || (Score > BestScore)) && (GetCachedLocationOccupancy(PlayerStart, Controller) < ELyraPlayerStartLocationOccupancy::Full))
+		{
+			BestPlayerStart = PlayerStart;
+			BestScore = Score;
+		}
+	}
+
+	return (BestPlayerStart != nullptr) ? BestPlayerStart : FallbackPlayerStart;
+}
+
+const FLyraTeamPawnSpatialHash& ULyraPlayerSpawningManagerComponent::GetTeamPawnSpatialHash() const
+{
+	if (TeamPawnSpatialHashFrame != GFrameCounter)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_LyraBuildTeamPawnSpatialHash);
+
+		TeamPawnSpatialHashFrame = GFrameCounter;
+		TeamPawnSpatialHash.Reset(LyraPlayerSpawning::SpatialHashCellSize);
+
+		const AGameStateBase* GameState = GetGameState<AGameStateBase>();
+		const ULyraTeamSubsystem* TeamSubsystem = GetWorld()->GetSubsystem<ULyraTeamSubsystem>();
+		if ((GameState != nullptr) && (TeamSubsystem != nullptr))
+		{
+			for (APlayerState* PS : GameState->PlayerArray)
+			{
+				const APawn* Pawn = PS->GetPawn();
+				if (PS->IsOnlyASpectator() || (Pawn == nullptr))
+				{
+					continue;
+				}
+
+				const int32 TeamId = TeamSubsystem->FindTeamFromObject(PS);
+				if (TeamId != INDEX_NONE)
+				{
+					TeamPawnSpatialHash.Add(TeamId, Pawn->GetActorLocation());
+				}
+			}
+		}
+	}
+
+	return TeamPawnSpatialHash;
+}
+
+ELyraPlayerStartLocationOccupancy ULyraPlayerSpawningManagerComponent::GetCachedLocationOccupancy(ALyraPlayerStart* PlayerStart, AController* Controller) const
+{
+	const UWorld* World = GetWorld();
+	const AGameModeBase* AuthGameMode = World->GetAuthGameMode();
+	UClass* PawnClass = (AuthGameMode != nullptr) ? AuthGameMode->GetDefaultPawnClassForController(Controller) : nullptr;
+	const double CurrentTime = World->GetTimeSeconds();
+
+	if (FCachedOccupancy* Cached = CachedOccupancy.Find(PlayerStart))
+	{
+		if ((Cached->PawnClass.Get() == PawnClass) && ((CurrentTime - Cached->Time) < LyraPlayerSpawning::OccupancyCacheLifetime))
+		{
+			return Cached->Occupancy;
+		}
+	}
+
+	const ELyraPlayerStartLocationOccupancy Occupancy = PlayerStart->GetLocationOccupancy(Controller);
+
+	// Drop entries for starts that have gone away
+	if (CachedOccupancy.Num() > CachedPlayerStarts.Num())
+	{
+		for (auto It = CachedOccupancy.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	FCachedOccupancy& NewEntry = CachedOccupancy.FindOrAdd(PlayerStart);
+	NewEntry.PawnClass = PawnClass;
+	NewEntry.Occupancy = Occupancy;
+	NewEntry.Time = CurrentTime;
+
+	return Occupancy;
+}
@@ -13,6 +13,40 @@ class APlayerState;
 class APlayerStart;
 class ALyraPlayerStart;
 class AActor;
+enum class ELyraPlayerStartLocationOccupancy;
+
+/**
+ * Uniform grid of pawn locations, bucketed per team, used to answer proximity queries when scoring player starts
+ */
+struct LYRAGAME_API FLyraTeamPawnSpatialHash
+{
+public:
+	void Reset(double InCellSize);
+	void Add(int32 TeamId, const FVector& Location);
+
+	int32 Num() const { return NumPawns; }
+
+	/** Does any team other than TeamId have a pawn in the hash? */
+	bool HasPawnsNotOnTeam(int32 TeamId) const;
+
+	/** Returns the squared distance from Location to the closest pawn that isn't on TeamId, or TNumericLimits<double>::Max() if there are none */
+	double FindNearestDistanceSquaredNotOnTeam(const FVector& Location, int32 TeamId) const;
+
+private:
+	struct FTeamCells
+	{
+		TMap<FIntPoint, TArray<FVector>> Cells;
+		FIntPoint MinCell = FIntPoint(MAX_int32, MAX_int32);
+		FIntPoint MaxCell = FIntPoint(MIN_int32, MIN_int32);
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+	double FindNearestDistanceSquared(const FTeamCells& Team, const FVector& Location) const;
+
+	TMap<int32, FTeamCells> Teams;
+	double CellSize = 2500.0;
+	int32 NumPawns = 0;
+};
 
 /**
  * @class ULyraPlayerSpawningManagerComponent
@@ -33,6 +67,21 @@ public:
 protected:
 	// Utility
 	APlayerStart* GetFirstRandomUnoccupiedPlayerStart(AController* Controller, const TArray<ALyraPlayerStart*>& FoundStartPoints) const;
+
+	/** Scores a player start for ChooseBestScoredPlayerStart, higher is better. Negative scores reject the start. */
+	using FPlayerStartScoreFunc = TFunctionRef<double(const ALyraPlayerStart& PlayerStart)>;
+
+	/**
+	 * Scores every start in a single pass and returns the best one that isn't fully occupied, or the best claimed start
+	 * if all unclaimed starts are occupied (nullptr if every start was rejected)
+	 */
+	ALyraPlayerStart* ChooseBestScoredPlayerStart(AController* Controller, const TArray<ALyraPlayerStart*>& PlayerStarts, FPlayerStartScoreFunc ScoreFunc) const;
+
+	/** Location of every non-spectator pawn bucketed by team, rebuilt at most once per frame */
+	const FLyraTeamPawnSpatialHash& GetTeamPawnSpatialHash() const;
+
+	/** ALyraPlayerStart::GetLocationOccupancy, cached per start for a short time since the overlap tests are expensive */
+	ELyraPlayerStartLocationOccupancy GetCachedLocationOccupancy(ALyraPlayerStart* PlayerStart, AController* Controller) const;
 	
 	virtual AActor* OnChoosePlayerStart(AController* Player, TArray<ALyraPlayerStart*>& PlayerStarts) { return nullptr; }
 	virtual void OnFinishRestartPlayer(AController* Player, const FRotator& StartRotation) { }
@@ -52,6 +101,18 @@ private:
 	UPROPERTY(Transient)
 	TArray<TWeakObjectPtr<ALyraPlayerStart>> CachedPlayerStarts;
 
+	struct FCachedOccupancy
+	{
+		TWeakObjectPtr<UClass> PawnClass;
+		ELyraPlayerStartLocationOccupancy Occupancy;
+		double Time = 0.0;
+	};
+
+	mutable TMap<TWeakObjectPtr<ALyraPlayerStart>, FCachedOccupancy> CachedOccupancy;
+
+	mutable FLyraTeamPawnSpatialHash TeamPawnSpatialHash;
+	mutable uint64 TeamPawnSpatialHashFrame = MAX_uint64;
+
 private:
 	void OnLevelAdded(ULevel* InLevel, UWorld* InWorld);
 	void HandleOnActorSpawned(AActor* SpawnedActor);
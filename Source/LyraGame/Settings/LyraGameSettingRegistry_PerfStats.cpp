@@ -26,7 +26,7 @@ void ULyraGameSettingRegistry::AddPerformanceStatPage(UGameSettingCollection* Pe
 {
 	//----------------------------------------------------------------------------------
 	{
-		static_assert((int32)ELyraDisplayablePerformanceStat::Count == 15, "Consider updating this function to deal with new performance stats");
+		static_assert((int32)ELyraDisplayablePerformanceStat::Count == 19, "Consider updating this function to deal with new performance stats");
 
 		UGameSettingCollectionPage* StatsPage = NewObject<UGameSettingCollectionPage>();
 		StatsPage->SetDevName(TEXT("PerfStatsPage"));
@@ -179,6 +179,49 @@ void ULyraGameSettingRegistry::AddPerformanceStatPage(UGameSettingCollection* Pe
 			}
 			//----------------------------------------------------------------------------------
 		}
+
+		// Audio stats
+		////////////////////////////////////////////////////////////////////////////////////
+		{
+			UGameSettingCollection* StatCategory_Audio = NewObject<UGameSettingCollection>();
+			StatCategory_Audio->SetDevName(TEXT("StatCategory_Audio"));
+			StatCategory_Audio->SetDisplayName(LOCTEXT("StatCategory_Audio_Name", "Audio"));
+			StatsPage->AddSetting(StatCategory_Audio);
+
+			//----------------------------------------------------------------------------------
+			{
+				ULyraSettingValueDiscrete_PerfStat* Setting = NewObject<ULyraSettingValueDiscrete_PerfStat>();
+				Setting->SetStat(ELyraDisplayablePerformanceStat::AudioCPU);
+				Setting->SetDisplayName(LOCTEXT("PerfStat_AudioCPU", "Audio CPU"));
+				Setting->SetDescriptionRichText(LOCTEXT("PerfStatDescription_AudioCPU", "The percentage of CPU time spent processing audio (not available in shipping builds)."));
+				StatCategory_Audio->AddSetting(Setting);
+			}
+			//----------------------------------------------------------------------------------
+			{
+				ULyraSettingValueDiscrete_PerfStat* Setting = NewObject<ULyraSettingValueDiscrete_PerfStat>();
+				Setting->SetStat(ELyraDisplayablePerformanceStat::AudioActiveVoices);
+				Setting->SetDisplayName(LOCTEXT("PerfStat_AudioActiveVoices", "Active Voices"));
+				Setting->SetDescriptionRichText(LOCTEXT("PerfStatDescription_AudioActiveVoices", "The number of voices currently being rendered (not available in shipping builds)."));
+				StatCategory_Audio->AddSetting(Setting);
+			}
+			//----------------------------------------------------------------------------------
+			{
+				ULyraSettingValueDiscrete_PerfStat* Setting = NewObject<ULyraSettingValueDiscrete_PerfStat>();
+				Setting->SetStat(ELyraDisplayablePerformanceStat::AudioStreamingBandwidth);
+				Setting->SetDisplayName(LOCTEXT("PerfStat_AudioStreamingBandwidth", "Audio Streaming"));
+				Setting->SetDescriptionRichText(LOCTEXT("PerfStatDescription_AudioStreamingBandwidth", "The amount of audio data (in KB) streamed from disk per second."));
+				StatCategory_Audio->AddSetting(Setting);
+			}
+			//----------------------------------------------------------------------------------
+			{
+				ULyraSettingValueDiscrete_PerfStat* Setting = NewObject<ULyraSettingValueDiscrete_PerfStat>();
+				Setting->SetStat(ELyraDisplayablePerformanceStat::AudioStreamingDeadlineMisses);
+				Setting->SetDisplayName(LOCTEXT("PerfStat_AudioStreamingDeadlineMisses", "Audio Streaming Misses"));
+				Setting->SetDescriptionRichText(LOCTEXT("PerfStatDescription_AudioStreamingDeadlineMisses", "The number of audio streaming reads per second that completed too late."));
+				StatCategory_Audio->AddSetting(Setting);
+			}
+			//----------------------------------------------------------------------------------
+		}
 	}
 }
 
@@ -1,3 +1,200 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "LyraSignificanceManager.h"
+#include "AkAudioDevice.h"
+#include "AkComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "UObject/UObjectIterator.h"
+
+namespace LyraSignificanceManager
+{
+	static bool bEnableAkComponentSignificance = true;
+	static FAutoConsoleVariableRef CVarEnableAkComponentSignificance(
+		TEXT("LyraSignificance.AkComponents.Enable"),
+		bEnableAkComponentSignificance,
+		TEXT("Should far, silent or inaudible AkComponents tick less often?"),
+		ECVF_Default);
+
+	static float AkComponentUpdateInterval = 0.1f;
+	static FAutoConsoleVariableRef CVarAkComponentUpdateInterval(
+		TEXT("LyraSignificance.AkComponents.UpdateInterval"),
+		AkComponentUpdateInterval,
+		TEXT("Seconds between two updates of the AkComponents significance."),
+		ECVF_Default);
+
+	static float AkComponentReducedTickInterval = 0.25f;
+	static FAutoConsoleVariableRef CVarAkComponentReducedTickInterval(
+		TEXT("LyraSignificance.AkComponents.ReducedTickInterval"),
+		AkComponentReducedTickInterval,
+		TEXT("Tick interval, in seconds, of the AkComponents that are far from every listener or not playing."),
+		ECVF_Default);
+
+	static float AkComponentAudibleRadiusScale = 1.1f;
+	static FAutoConsoleVariableRef CVarAkComponentAudibleRadiusScale(
+		TEXT("LyraSignificance.AkComponents.AudibleRadiusScale"),
+		AkComponentAudibleRadiusScale,
+		TEXT("Scale applied to the attenuation radius of the AkComponents before deciding that they are out of range."),
+		ECVF_Default);
+
+	// Ratio of the scaled attenuation radius to the distance to the closest viewpoint.
+	// Above 2, the emitter is in the closest half of its range. Below 1, it's out of range.
+	float CalculateAkComponentSignificance(USignificanceManager::FManagedObjectInfo* ObjectInfo, const FTransform& Viewpoint)
+	{
+		const UAkComponent* Component = CastChecked<UAkComponent>(ObjectInfo->GetObject());
+		const float Radius = Component->GetAttenuationRadius() * AkComponentAudibleRadiusScale;
+		if (Radius <= 0.0f)
+		{
+			// Without an associated event we can't know the range, only the playing state decides
+			return 1.0f;
+		}
+
+		const float Distance = FVector::Dist(Component->GetComponentLocation(), Viewpoint.GetLocation());
+		return Radius / FMath::Max(Distance, 1.0f);
+	}
+}
+
+const FName ULyraSignificanceManager::AkComponentTag(TEXT("AkComponent"));
+
+void ULyraSignificanceManager::BeginDestroy()
+{
+	UnbindFromAudioDevice();
+
+	Super::BeginDestroy();
+}
+
+ETickableTickType ULyraSignificanceManager::GetTickableTickType() const
+{
+	return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool ULyraSignificanceManager::IsTickable() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->IsGameWorld() && !IsUnreachable();
+}
+
+TStatId ULyraSignificanceManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULyraSignificanceManager, STATGROUP_Tickables);
+}
+
+void ULyraSignificanceManager::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+
+	if (!AkComponentRegisteredHandle.IsValid())
+	{
+		BindToAudioDevice();
+	}
+
+	// AkComponents are the only managed objects, so the significances are only needed at their update interval
+	TimeSinceAkComponentUpdate += DeltaTime;
+	if (TimeSinceAkComponentUpdate < LyraSignificanceManager::AkComponentUpdateInterval)
+	{
+		return;
+	}
+
+	Viewpoints.Reset();
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		if (PlayerController && PlayerController->IsLocalController())
+		{
+			FVector Location;
+			FRotator Rotation;
+			PlayerController->GetPlayerViewPoint(Location, Rotation);
+			Viewpoints.Emplace(Rotation, Location);
+		}
+	}
+
+	if (Viewpoints.Num() == 0)
+	{
+		return;
+	}
+
+	TimeSinceAkComponentUpdate = 0.0f;
+	Update(Viewpoints);
+	UpdateAkComponentSignificance(LyraSignificanceManager::bEnableAkComponentSignificance);
+}
+
+void ULyraSignificanceManager::BindToAudioDevice()
+{
+	FAkAudioDevice* AudioDevice = FAkAudioDevice::Get();
+	if (AudioDevice == nullptr)
+	{
+		return;
+	}
+
+	AkComponentRegisteredHandle = AudioDevice->OnAkComponentRegistered.AddUObject(this, &ThisClass::OnAkComponentRegistered);
+	AkComponentUnregisteredHandle = AudioDevice->OnAkComponentUnregistered.AddUObject(this, &ThisClass::OnAkComponentUnregistered);
+
+	// Pick up the components that were registered before us
+	for (TObjectIterator<UAkComponent> It; It; ++It)
+	{
+		if (It->IsRegistered() && !It->IsTemplate())
+		{
+			OnAkComponentRegistered(*It);
+		}
+	}
+}
+
+void ULyraSignificanceManager::UnbindFromAudioDevice()
+{
+	if (FAkAudioDevice* AudioDevice = FAkAudioDevice::Get())
+	{
+		AudioDevice->OnAkComponentRegistered.Remove(AkComponentRegisteredHandle);
+		AudioDevice->OnAkComponentUnregistered.Remove(AkComponentUnregisteredHandle);
+	}
+	AkComponentRegisteredHandle.Reset();
+	AkComponentUnregisteredHandle.Reset();
+}
+
+void ULyraSignificanceManager::OnAkComponentRegistered(UAkComponent* Component)
+{
+	if (Component->GetWorld() == GetWorld() && GetManagedObject(Component) == nullptr)
+	{
+		RegisterObject(Component, AkComponentTag, &LyraSignificanceManager::CalculateAkComponentSignificance);
+	}
+}
+
+void ULyraSignificanceManager::OnAkComponentUnregistered(UAkComponent* Component)
+{
+	if (GetManagedObject(Component) != nullptr)
+	{
+		UnregisterObject(Component);
+	}
+}
+
+void ULyraSignificanceManager::UpdateAkComponentSignificance(bool bEnabled)
+{
+	if (!bEnabled && !bAkComponentSignificanceApplied)
+	{
+		return;
+	}
+
+	const float ReducedTickInterval = LyraSignificanceManager::AkComponentReducedTickInterval;
+	for (const FManagedObjectInfo* ObjectInfo : GetManagedObjects(AkComponentTag))
+	{
+		UAkComponent* Component = CastChecked<UAkComponent>(ObjectInfo->GetObject());
+		EAkComponentSignificance NewSignificance = EAkComponentSignificance::Full;
+		if (bEnabled)
+		{
+			const float Significance = ObjectInfo->GetSignificance();
+			if (Component->HasActiveEvents())
+			{
+				NewSignificance = Significance >= 2.0f ? EAkComponentSignificance::Full
+					: Significance >= 1.0f ? EAkComponentSignificance::Reduced
+					: EAkComponentSignificance::Inaudible;
+			}
+			else
+			{
+				// Silent emitters in range keep following rooms and reverb volumes, so that they are ready when they play
+				NewSignificance = Significance >= 1.0f ? EAkComponentSignificance::Reduced : EAkComponentSignificance::Inaudible;
+			}
+		}
+		Component->SetSignificance(NewSignificance, ReducedTickInterval);
+	}
+
+	bAkComponentSignificanceApplied = bEnabled;
+}
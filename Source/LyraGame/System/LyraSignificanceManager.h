@@ -4,11 +4,54 @@
 
 #include "CoreMinimal.h"
 #include "SignificanceManager.h"
+#include "Tickable.h"
 #include "LyraSignificanceManager.generated.h"
 
+class UAkComponent;
+
+/**
+ * ULyraSignificanceManager
+ *
+ *	Updates significance from the local players' viewpoints every frame.
+ *	Wwise AkComponents are registered automatically and bucketed by distance, attenuation radius and playing state,
+ *	so that far or silent emitters tick at a reduced rate and inaudible ones stop ticking altogether.
+ */
 UCLASS()
-class ULyraSignificanceManager : public USignificanceManager
+class ULyraSignificanceManager : public USignificanceManager, public FTickableGameObject
 {
 	GENERATED_BODY()
 
+public:
+
+	//~UObject interface
+	virtual void BeginDestroy() override;
+	//~End of UObject interface
+
+	//~FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+	virtual TStatId GetStatId() const override;
+	//~End of FTickableGameObject interface
+
+	static const FName AkComponentTag;
+
+private:
+	void BindToAudioDevice();
+	void UnbindFromAudioDevice();
+
+	void OnAkComponentRegistered(UAkComponent* Component);
+	void OnAkComponentUnregistered(UAkComponent* Component);
+
+	/** Applies the significance computed by the last update to every registered AkComponent */
+	void UpdateAkComponentSignificance(bool bEnabled);
+
+	TArray<FTransform> Viewpoints;
+
+	FDelegateHandle AkComponentRegisteredHandle;
+	FDelegateHandle AkComponentUnregisteredHandle;
+
+	float TimeSinceAkComponentUpdate = 0.0f;
+	bool bAkComponentSignificanceApplied = false;
 };
@@ -97,6 +97,96 @@ bool FIndicatorProjection::Project(const UIndicatorDescriptor& IndicatorDescript
 	return false;
 }
 
+bool FIndicatorProjection::GetProjectionPoint(const UIndicatorDescriptor& IndicatorDescriptor, FVector& OutWorldPoint)
+{
+	USceneComponent* Component = IndicatorDescriptor.GetSceneComponent();
+	if (Component == nullptr)
+	{
+		return false;
+	}
+
+	switch (IndicatorDescriptor.GetProjectionMode())
+	{
+		case EActorCanvasProjectionMode::ComponentPoint:
+		{
+			const FVector WorldLocation = (IndicatorDescriptor.GetComponentSocketName() != NAME_None)
+				? Component->GetSocketTransform(IndicatorDescriptor.GetComponentSocketName()).GetLocation()
+				: Component->GetComponentLocation();
+
+			OutWorldPoint = WorldLocation + IndicatorDescriptor.GetWorldPositionOffset();
+			return true;
+		}
+		case EActorCanvasProjectionMode::ActorBoundingBox:
+		case EActorCanvasProjectionMode::ComponentBoundingBox:
+		{
+			const FBox IndicatorBox = (IndicatorDescriptor.GetProjectionMode() == EActorCanvasProjectionMode::ActorBoundingBox)
+				? Component->GetOwner()->GetComponentsBoundingBox()
+				: Component->Bounds.GetBox();
+
+			OutWorldPoint = IndicatorBox.GetCenter() + (IndicatorBox.GetSize() * (IndicatorDescriptor.GetBoundingBoxAnchor() - FVector(0.5)));
+			return true;
+		}
+		default:
+			return false;
+	}
+}
+
+void FIndicatorProjection::ProjectPoints(const FSceneViewProjectionData& InProjectionData, const FVector2D& ScreenSize, TConstArrayView<FVector> WorldPoints,
+	TArrayView<FVector> OutScreenPositionsWithDepth, TArrayView<bool> OutInFrontOfCamera)
+{
+	check(WorldPoints.Num() == OutScreenPositionsWithDepth.Num() && WorldPoints.Num() == OutInFrontOfCamera.Num());
+
+	const FIntRect ViewRect = InProjectionData.GetConstrainedViewRect();
+	const float ViewWidth = (float)ViewRect.Width();
+	const float ViewHeight = (float)ViewRect.Height();
+	if (ViewWidth <= 0.0f || ViewHeight <= 0.0f)
+	{
+		for (bool& bInFront : OutInFrontOfCamera)
+		{
+			bInFront = false;
+		}
+		return;
+	}
+
+	// Points are made relative to the view origin in double precision, which lets the rest of the transform run in single precision SIMD
+	const FMatrix44f TranslatedViewProjectionMatrix(InProjectionData.ViewRotationMatrix * InProjectionData.ProjectionMatrix);
+	const VectorRegister4Float MatrixRow0 = VectorLoad(&TranslatedViewProjectionMatrix.M[0][0]);
+	const VectorRegister4Float MatrixRow1 = VectorLoad(&TranslatedViewProjectionMatrix.M[1][0]);
+	const VectorRegister4Float MatrixRow2 = VectorLoad(&TranslatedViewProjectionMatrix.M[2][0]);
+	const VectorRegister4Float MatrixRow3 = VectorLoad(&TranslatedViewProjectionMatrix.M[3][0]);
+
+	// Maps normalized 0..1 UI space into the allotted size, the same way GetPixelPoint does
+	const FVector2D PixelScale(ScreenSize.X, ScreenSize.Y);
+	const FVector2D PixelOffset(ViewRect.Min.X / ViewWidth * ScreenSize.X, ViewRect.Min.Y / ViewHeight * ScreenSize.Y);
+
+	for (int32 PointIndex = 0; PointIndex < WorldPoints.Num(); ++PointIndex)
+	{
+		const FVector ViewRelativePoint = WorldPoints[PointIndex] - InProjectionData.ViewOrigin;
+
+		VectorRegister4Float ClipPosition = VectorMultiplyAdd(VectorSetFloat1((float)ViewRelativePoint.Z), MatrixRow2, MatrixRow3);
+		ClipPosition = VectorMultiplyAdd(VectorSetFloat1((float)ViewRelativePoint.Y), MatrixRow1, ClipPosition);
+		ClipPosition = VectorMultiplyAdd(VectorSetFloat1((float)ViewRelativePoint.X), MatrixRow0, ClipPosition);
+
+		alignas(16) float Clip[4];
+		VectorStoreAligned(ClipPosition, Clip);
+
+		// Not clamping the point but flagging it if it is behind the camera
+		OutInFrontOfCamera[PointIndex] = (Clip[3] >= 0.0f);
+
+		const float W = (Clip[3] == 0.0f) ? 1.0f : Clip[3];
+		const float RHW = 1.0f / FMath::Abs(W);
+
+		// Move from projection space to normalized 0..1 UI space
+		const float NormalizedX = (Clip[0] * RHW * 0.5f) + 0.5f;
+		const float NormalizedY = 1.0f - (Clip[1] * RHW * 0.5f) - 0.5f;
+
+		OutScreenPositionsWithDepth[PointIndex] = FVector(
+			(NormalizedX * PixelScale.X) + PixelOffset.X,
+			(NormalizedY * PixelScale.Y) + PixelOffset.Y,
+			ViewRelativePoint.Size());
+	}
+}
+
 void UIndicatorDescriptor::SetIndicatorManagerComponent(ULyraIndicatorManagerComponent* InManager)
 {
 	// Make sure nobody has set this.
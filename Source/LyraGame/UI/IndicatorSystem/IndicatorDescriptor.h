@@ -17,6 +17,19 @@ class ULyraIndicatorManagerComponent;
 struct FIndicatorProjection
 {
 	bool Project(const UIndicatorDescriptor& IndicatorDescriptor, const FSceneViewProjectionData& InProjectionData, const FVector2D& ScreenSize, FVector& ScreenPositionWithDepth);
+
+	/**
+	 * Gets the single world point an indicator is projected from. Returns false if the indicator has no scene component,
+	 * or uses a screen bounding box projection mode (which needs Project).
+	 */
+	static bool GetProjectionPoint(const UIndicatorDescriptor& IndicatorDescriptor, FVector& OutWorldPoint);
+
+	/**
+	 * Projects a batch of world points to screen positions (X, Y) with distance from the view as depth (Z),
+	 * matching ULocalPlayer::GetPixelPoint. OutInFrontOfCamera is false for points behind the view.
+	 */
+	static void ProjectPoints(const FSceneViewProjectionData& InProjectionData, const FVector2D& ScreenSize, TConstArrayView<FVector> WorldPoints,
+		TArrayView<FVector> OutScreenPositionsWithDepth, TArrayView<bool> OutInFrontOfCamera);
 };
 
 UENUM(BlueprintType)
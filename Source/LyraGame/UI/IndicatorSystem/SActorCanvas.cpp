@@ -194,6 +194,9 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
 
 			bool IndicatorsChanged = false;
 
+			PackedProjectionSlotIndices.Reset();
+			PackedProjectionWorldPoints.Reset();
+
 			for (int32 ChildIndex = 0; ChildIndex < CanvasChildren.Num(); ++ChildIndex)
 			{
 				SActorCanvas::FSlot& CurChild = CanvasChildren[ChildIndex];
@@ -227,35 +230,41 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
 					IndicatorsChanged = true;
 				}
 
+				// Indicators placed at a single world point are gathered and projected together below
+				FVector WorldPoint;
+				if (FIndicatorProjection::GetProjectionPoint(*Indicator, OUT WorldPoint))
+				{
+					PackedProjectionSlotIndices.Add(ChildIndex);
+					PackedProjectionWorldPoints.Add(WorldPoint);
+					continue;
+				}
+
 				FVector ScreenPositionWithDepth;
 
 				FIndicatorProjection Projector;
 				const bool Success = Projector.Project(*Indicator, ProjectionData, PaintGeometry.Size, OUT ScreenPositionWithDepth);
 
-				if (!Success)
-				{
-					CurChild.SetHasValidScreenPosition(false);
-					CurChild.SetInFrontOfCamera(false);
+				IndicatorsChanged |= ApplyIndicatorProjection(CurChild, *Indicator, Success, ScreenPositionWithDepth);
+			}
 
-					IndicatorsChanged |= CurChild.bIsDirty();
-					CurChild.ClearDirtyFlag();
-					continue;
-				}
+			if (PackedProjectionWorldPoints.Num() > 0)
+			{
+				PackedProjectionResults.SetNumUninitialized(PackedProjectionWorldPoints.Num(), false);
+				PackedProjectionInFront.SetNumUninitialized(PackedProjectionWorldPoints.Num(), false);
 
-				CurChild.SetInFrontOfCamera(Success);
-				CurChild.SetHasValidScreenPosition(CurChild.GetInFrontOfCamera() || Indicator->GetClampToScreen());
+				FIndicatorProjection::ProjectPoints(ProjectionData, PaintGeometry.Size, PackedProjectionWorldPoints, PackedProjectionResults, PackedProjectionInFront);
 
-				if (CurChild.HasValidScreenPosition())
+				for (int32 PackedIndex = 0; PackedIndex < PackedProjectionSlotIndices.Num(); ++PackedIndex)
 				{
-					// Only dirty the screen position if we can actually show this indicator.
-					CurChild.SetScreenPosition(FVector2D(ScreenPositionWithDepth));
-					CurChild.SetDepth(ScreenPositionWithDepth.X);
-				}
+					SActorCanvas::FSlot& CurChild = CanvasChildren[PackedProjectionSlotIndices[PackedIndex]];
+					const UIndicatorDescriptor* Indicator = CurChild.Indicator;
 
-				CurChild.SetPriority(Indicator->GetPriority());
+					FVector ScreenPositionWithDepth = PackedProjectionResults[PackedIndex];
+					ScreenPositionWithDepth.X += Indicator->GetScreenSpaceOffset().X;
+					ScreenPositionWithDepth.Y += Indicator->GetScreenSpaceOffset().Y;
 
-				IndicatorsChanged |= CurChild.bIsDirty();
-				CurChild.ClearDirtyFlag();
+					IndicatorsChanged |= ApplyIndicatorProjection(CurChild, *Indicator, PackedProjectionInFront[PackedIndex], ScreenPositionWithDepth);
+				}
 			}
 
 			if (IndicatorsChanged)
@@ -284,6 +293,89 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
 	}
 }
 
+bool SActorCanvas::ApplyIndicatorProjection(FSlot& Slot, const UIndicatorDescriptor& Indicator, bool bProjected, const FVector& ScreenPositionWithDepth)
+{
+	if (!bProjected)
+	{
+		Slot.SetHasValidScreenPosition(false);
+		Slot.SetInFrontOfCamera(false);
+	}
+	else
+	{
+		Slot.SetInFrontOfCamera(true);
+		Slot.SetHasValidScreenPosition(Slot.GetInFrontOfCamera() || Indicator.GetClampToScreen());
+
+		if (Slot.HasValidScreenPosition())
+		{
+			// Only dirty the screen position if we can actually show this indicator.
+			Slot.SetScreenPosition(FVector2D(ScreenPositionWithDepth));
+			Slot.SetDepth(ScreenPositionWithDepth.Z);
+		}
+
+		Slot.SetPriority(Indicator.GetPriority());
+	}
+
+	const bool bChanged = Slot.bIsDirty();
+	Slot.ClearDirtyFlag();
+	return bChanged;
+}
+
+void SActorCanvas::UpdateSortedSlots() const
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_SActorCanvas_UpdateSortedSlots);
+
+	if (bSortedSlotsNeedRebuild || SortedSlots.Num() != CanvasChildren.Num())
+	{
+		bSortedSlotsNeedRebuild = false;
+
+		TSet<const SActorCanvas::FSlot*> CurrentSlots;
+		CurrentSlots.Reserve(CanvasChildren.Num());
+		for (int32 ChildIndex = 0; ChildIndex < CanvasChildren.Num(); ++ChildIndex)
+		{
+			CurrentSlots.Add(&CanvasChildren[ChildIndex]);
+		}
+
+		// Keep the surviving slots in their previous order (only addresses are compared, removed slots are never dereferenced)
+		int32 NumKept = 0;
+		for (const SActorCanvas::FSlot* Slot : SortedSlots)
+		{
+			if (CurrentSlots.Remove(Slot) > 0)
+			{
+				SortedSlots[NumKept++] = Slot;
+			}
+		}
+		SortedSlots.SetNum(NumKept, false);
+
+		// New slots go on the end in child order and get sorted into place below
+		for (int32 ChildIndex = 0; ChildIndex < CanvasChildren.Num(); ++ChildIndex)
+		{
+			if (CurrentSlots.Contains(&CanvasChildren[ChildIndex]))
+			{
+				SortedSlots.Add(&CanvasChildren[ChildIndex]);
+			}
+		}
+	}
+
+	auto SortPredicate = [](const SActorCanvas::FSlot& A, const SActorCanvas::FSlot& B)
+	{
+		return A.GetPriority() == B.GetPriority() ? A.GetDepth() > B.GetDepth() : A.GetPriority() < B.GetPriority();
+	};
+
+	// Insertion sort over last arrange's order: close to linear when only a few indicators swapped places, and stable
+	for (int32 SortIndex = 1; SortIndex < SortedSlots.Num(); ++SortIndex)
+	{
+		const SActorCanvas::FSlot* Slot = SortedSlots[SortIndex];
+
+		int32 InsertIndex = SortIndex;
+		while (InsertIndex > 0 && SortPredicate(*Slot, *SortedSlots[InsertIndex - 1]))
+		{
+			SortedSlots[InsertIndex] = SortedSlots[InsertIndex - 1];
+			--InsertIndex;
+		}
+		SortedSlots[InsertIndex] = Slot;
+	}
+}
+
 void SActorCanvas::SetShowAnyIndicators(bool bIndicators)
 {
 	if (bShowAnyIndicators != bIndicators)
@@ -314,16 +406,7 @@ void SActorCanvas::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrange
 		const FVector Center = FVector(AllottedGeometry.Size * 0.5f, 0.0f);
 
 		// Sort the children
-		TArray<const SActorCanvas::FSlot*> SortedSlots;
-		for (int32 ChildIndex = 0; ChildIndex < CanvasChildren.Num(); ++ChildIndex)
-		{
-			SortedSlots.Add(&CanvasChildren[ChildIndex]);
-		}
-
-		SortedSlots.StableSort([](const SActorCanvas::FSlot& A, const SActorCanvas::FSlot& B)
-		{
-			return A.GetPriority() == B.GetPriority() ? A.GetDepth() > B.GetDepth() : A.GetPriority() < B.GetPriority();
-		});
+		UpdateSortedSlots();
 
 		// Go through all the sorted children
 		for (int32 ChildIndex = 0; ChildIndex < SortedSlots.Num(); ++ChildIndex)
@@ -349,6 +432,18 @@ void SActorCanvas::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrange
 			FVector2D SlotSize, SlotOffset, SlotPaddingMin, SlotPaddingMax;
 			GetOffsetAndSize(Indicator, SlotSize, SlotOffset, SlotPaddingMin, SlotPaddingMax);
 
+			// Unclamped indicators that are entirely off screen would just be culled at paint, so don't arrange them at all
+			if (!bShouldClamp)
+			{
+				const FVector2D SlotMin = ScreenPosition + SlotOffset;
+				const FVector2D SlotMax = SlotMin + SlotSize;
+				if (SlotMax.X < 0.0f || SlotMax.Y < 0.0f || SlotMin.X > AllottedGeometry.Size.X || SlotMin.Y > AllottedGeometry.Size.Y)
+				{
+					CurChild.SetWasIndicatorClamped(false);
+					continue;
+				}
+			}
+
 			bool bWasIndicatorClamped = false;
 
 			// If we don't have to clamp this thing, we can skip a lot of work
@@ -623,6 +718,7 @@ SActorCanvas::FScopedWidgetSlotArguments SActorCanvas::AddActorSlot(UIndicatorDe
 		{
 			if (TSharedPtr<SActorCanvas> Canvas = WeakCanvas.Pin())
 			{
+				Canvas->bSortedSlotsNeedRebuild = true;
 				Canvas->UpdateActiveTimer();
 			}
 		}};
@@ -635,6 +731,7 @@ int32 SActorCanvas::RemoveActorSlot(const TSharedRef<SWidget>& SlotWidget)
 		if ( SlotWidget == CanvasChildren[SlotIdx].GetWidget() )
 		{
 			CanvasChildren.RemoveAt(SlotIdx);
+			bSortedSlotsNeedRebuild = true;
 
 			UpdateActiveTimer();
 
@@ -224,6 +224,12 @@ private:
 
 	void UpdateActiveTimer();
 
+	/** Applies a projection result to a slot, returns true if the slot changed */
+	static bool ApplyIndicatorProjection(FSlot& Slot, const UIndicatorDescriptor& Indicator, bool bProjected, const FVector& ScreenPositionWithDepth);
+
+	/** Brings SortedSlots up to date with CanvasChildren and re-sorts it, starting from last arrange's order */
+	void UpdateSortedSlots() const;
+
 private:
 	TArray<UIndicatorDescriptor*> AllIndicators;
 	TArray<UIndicatorDescriptor*> InactiveIndicators;
@@ -250,5 +256,15 @@ private:
 
 	mutable TOptional<FGeometry> OptionalPaintGeometry;
 
+	/** Canvas slots in the order they were last arranged. The order barely changes between frames, so it is re-sorted incrementally. */
+	mutable TArray<const FSlot*> SortedSlots;
+	mutable bool bSortedSlotsNeedRebuild = true;
+
+	/** Scratch buffers for projecting the point based indicators as one batch */
+	TArray<int32> PackedProjectionSlotIndices;
+	TArray<FVector> PackedProjectionWorldPoints;
+	TArray<FVector> PackedProjectionResults;
+	TArray<bool> PackedProjectionInFront;
+
 	TSharedPtr<FActiveTimerHandle> TickHandle;
 };
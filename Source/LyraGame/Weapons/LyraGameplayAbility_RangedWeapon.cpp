@@ -15,6 +15,11 @@
 #include "AbilitySystem/LyraGameplayEffectContext.h"
 #include "AbilitySystem/LyraGameplayAbilityTargetData_SingleTargetHit.h"
 #include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Trace Bullets In Cartridge"), STAT_LyraTraceBulletsInCartridge, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Resolve Async Bullet Traces"), STAT_LyraResolveAsyncBulletTraces, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async Bullet Traces Submitted"), STAT_LyraAsyncBulletTracesSubmitted, STATGROUP_Game);
 
 namespace LyraConsoleVariables
 {
@@ -38,6 +43,13 @@ namespace LyraConsoleVariables
 		DrawBulletHitRadius,
 		TEXT("When bullet hit debug drawing is enabled (see DrawBulletHitDuration), how big should the hit radius be? (in uu)"),
 		ECVF_Default);
+
+	static bool bAsyncBulletTraces = false;
+	static FAutoConsoleVariableRef CVarAsyncBulletTraces(
+		TEXT("lyra.Weapon.AsyncBulletTraces"),
+		bAsyncBulletTraces,
+		TEXT("Should locally predicted shots submit their bullet traces as one asynchronous batch (results are processed next frame) instead of tracing synchronously"),
+		ECVF_Default);
 }
 
 // Weapon fire will be blocked/canceled if the player has this tag
@@ -163,20 +175,29 @@ FHitResult ULyraGameplayAbility_RangedWeapon::WeaponTrace(const FVector& StartTr
 		GetWorld()->LineTraceMultiByChannel(HitResults, StartTrace, EndTrace, TraceChannel, TraceParams);
 	}
 
+	return AppendUniqueHitResults(StartTrace, EndTrace, HitResults, /*out*/ OutHitResults);
+}
+
+FHitResult ULyraGameplayAbility_RangedWeapon::AppendUniqueHitResults(const FVector& StartTrace, const FVector& EndTrace, const TArray<FHitResult>& HitResults, OUT TArray<FHitResult>& OutHitResults)
+{
 	FHitResult Hit(ForceInit);
 	if (HitResults.Num() > 0)
 	{
 		// Filter the output list to prevent multiple hits on the same actor;
 		// this is to prevent a single bullet dealing damage multiple times to
 		// a single actor if using an overlap trace
-		for (FHitResult& CurHitResult : HitResults)
+		TSet<FActorInstanceHandle, DefaultKeyFuncs<FActorInstanceHandle>, TInlineSetAllocator<16>> HitObjects;
+		HitObjects.Reserve(OutHitResults.Num() + HitResults.Num());
+		for (const FHitResult& ExistingHitResult : OutHitResults)
 		{
-			auto Pred = [&CurHitResult](const FHitResult& Other)
-			{
-				return Other.HitObjectHandle == CurHitResult.HitObjectHandle;
-			};
+			HitObjects.Add(ExistingHitResult.HitObjectHandle);
+		}
 
-			if (!OutHitResults.ContainsByPredicate(Pred))
+		for (const FHitResult& CurHitResult : HitResults)
+		{
+			bool bAlreadyHit = false;
+			HitObjects.Add(CurHitResult.HitObjectHandle, &bAlreadyHit);
+			if (!bAlreadyHit)
 			{
 				OutHitResults.Add(CurHitResult);
 			}
@@ -193,6 +214,39 @@ FHitResult ULyraGameplayAbility_RangedWeapon::WeaponTrace(const FVector& StartTr
 	return Hit;
 }
 
+void ULyraGameplayAbility_RangedWeapon::MergeSweepHitResults(const TArray<FHitResult>& SweepHits, OUT TArray<FHitResult>& OutHits)
+{
+	// If the trace with sweep radius enabled hit a pawn, check if we should use its hit results
+	const int32 FirstPawnIdx = FindFirstPawnHitResult(SweepHits);
+	if (SweepHits.IsValidIndex(FirstPawnIdx))
+	{
+		TSet<FActorInstanceHandle, DefaultKeyFuncs<FActorInstanceHandle>, TInlineSetAllocator<16>> LineHitObjects;
+		LineHitObjects.Reserve(OutHits.Num());
+		for (const FHitResult& LineHitResult : OutHits)
+		{
+			LineHitObjects.Add(LineHitResult.HitObjectHandle);
+		}
+
+		// If we had a blocking hit in our line trace that occurs in SweepHits before our
+		// hit pawn, we should just use our initial hit results since the Pawn hit should be blocked
+		bool bUseSweepHits = true;
+		for (int32 Idx = 0; Idx < FirstPawnIdx; ++Idx)
+		{
+			const FHitResult& CurHitResult = SweepHits[Idx];
+			if (CurHitResult.bBlockingHit && LineHitObjects.Contains(CurHitResult.HitObjectHandle))
+			{
+				bUseSweepHits = false;
+				break;
+			}
+		}
+
+		if (bUseSweepHits)
+		{
+			OutHits = SweepHits;
+		}
+	}
+}
+
 FVector ULyraGameplayAbility_RangedWeapon::GetWeaponTargetingSourceLocation() const
 {
 	// Use Pawn's location as a base
@@ -319,33 +373,7 @@ FHitResult ULyraGameplayAbility_RangedWeapon::DoSingleBulletTrace(const FVector&
 			TArray<FHitResult> SweepHits;
 			Impact = WeaponTrace(StartTrace, EndTrace, SweepRadius, bIsSimulated, /*out*/ SweepHits);
 
-			// If the trace with sweep radius enabled hit a pawn, check if we should use its hit results
-			const int32 FirstPawnIdx = FindFirstPawnHitResult(SweepHits);
-			if (SweepHits.IsValidIndex(FirstPawnIdx))
-			{
-				// If we had a blocking hit in our line trace that occurs in SweepHits before our
-				// hit pawn, we should just use our initial hit results since the Pawn hit should be blocked
-				bool bUseSweepHits = true;
-				for (int32 Idx = 0; Idx < FirstPawnIdx; ++Idx)
-				{
-					const FHitResult& CurHitResult = SweepHits[Idx];
-
-					auto Pred = [&CurHitResult](const FHitResult& Other)
-					{
-						return Other.HitObjectHandle == CurHitResult.HitObjectHandle;
-					};
-					if (CurHitResult.bBlockingHit && OutHits.ContainsByPredicate(Pred))
-					{
-						bUseSweepHits = false;
-						break;
-					}
-				}
-
-				if (bUseSweepHits)
-				{
-					OutHits = SweepHits;
-				}
-			}
+			MergeSweepHitResults(SweepHits, /*out*/ OutHits);
 		}
 	}
 
@@ -353,13 +381,21 @@ FHitResult ULyraGameplayAbility_RangedWeapon::DoSingleBulletTrace(const FVector&
 }
 
 void ULyraGameplayAbility_RangedWeapon::PerformLocalTargeting(OUT TArray<FHitResult>& OutHits)
+{
+	FRangedWeaponFiringInput InputData;
+	if (GetLocalFiringInput(/*out*/ InputData))
+	{
+		TraceBulletsInCartridge(InputData, /*out*/ OutHits);
+	}
+}
+
+bool ULyraGameplayAbility_RangedWeapon::GetLocalFiringInput(OUT FRangedWeaponFiringInput& InputData) const
 {
 	APawn* const AvatarPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
 
 	ULyraRangedWeaponInstance* WeaponData = GetWeaponInstance();
 	if (AvatarPawn && AvatarPawn->IsLocallyControlled() && WeaponData)
 	{
-		FRangedWeaponFiringInput InputData;
 		InputData.WeaponData = WeaponData;
 		InputData.bCanPlayBulletFX = (AvatarPawn->GetNetMode() != NM_DedicatedServer);
 
@@ -378,12 +414,16 @@ void ULyraGameplayAbility_RangedWeapon::PerformLocalTargeting(OUT TArray<FHitRes
 		}
 #endif
 
-		TraceBulletsInCartridge(InputData, /*out*/ OutHits);
+		return true;
 	}
+
+	return false;
 }
 
 void ULyraGameplayAbility_RangedWeapon::TraceBulletsInCartridge(const FRangedWeaponFiringInput& InputData, OUT TArray<FHitResult>& OutHits)
 {
+	SCOPE_CYCLE_COUNTER(STAT_LyraTraceBulletsInCartridge);
+
 	ULyraRangedWeaponInstance* WeaponData = InputData.WeaponData;
 	check(WeaponData);
 
@@ -400,44 +440,173 @@ void ULyraGameplayAbility_RangedWeapon::TraceBulletsInCartridge(const FRangedWea
 		const FVector BulletDir = VRandConeNormalDistribution(InputData.AimDir, HalfSpreadAngleInRadians, WeaponData->GetSpreadExponent());
 
 		const FVector EndTrace = InputData.StartTrace + (BulletDir * WeaponData->GetMaxDamageRange());
-		FVector HitLocation = EndTrace;
 
 		TArray<FHitResult> AllImpacts;
 
 		FHitResult Impact = DoSingleBulletTrace(InputData.StartTrace, EndTrace, WeaponData->GetBulletTraceSweepRadius(), /*bIsSimulated=*/ false, /*out*/ AllImpacts);
 
-		const AActor* HitActor = Impact.GetActor();
+		AddBulletImpacts(Impact, EndTrace, AllImpacts, /*out*/ OutHits);
+	}
+}
 
-		if (HitActor)
-		{
+void ULyraGameplayAbility_RangedWeapon::AddBulletImpacts(const FHitResult& Impact, const FVector& EndTrace, const TArray<FHitResult>& AllImpacts, OUT TArray<FHitResult>& OutHits) const
+{
+	const AActor* HitActor = Impact.GetActor();
+
+	if (HitActor)
+	{
 #if ENABLE_DRAW_DEBUG
-			if (LyraConsoleVariables::DrawBulletHitDuration > 0.0f)
-			{
-				DrawDebugPoint(GetWorld(), Impact.ImpactPoint, LyraConsoleVariables::DrawBulletHitRadius, FColor::Red, false, LyraConsoleVariables::DrawBulletHitRadius);
-			}
+		if (LyraConsoleVariables::DrawBulletHitDuration > 0.0f)
+		{
+			DrawDebugPoint(GetWorld(), Impact.ImpactPoint, LyraConsoleVariables::DrawBulletHitRadius, FColor::Red, false, LyraConsoleVariables::DrawBulletHitRadius);
+		}
 #endif
 
-			if (AllImpacts.Num() > 0)
-			{
-				OutHits.Append(AllImpacts);
-			}
+		if (AllImpacts.Num() > 0)
+		{
+			OutHits.Append(AllImpacts);
+		}
+	}
 
-			HitLocation = Impact.ImpactPoint;
+	// Make sure there's always an entry in OutHits so the direction can be used for tracers, etc...
+	if (OutHits.Num() == 0)
+	{
+		FHitResult& FakeImpact = OutHits.Add_GetRef(Impact);
+		if (!Impact.bBlockingHit)
+		{
+			// Locate the fake 'impact' at the end of the trace
+			FakeImpact.Location = EndTrace;
+			FakeImpact.ImpactPoint = EndTrace;
 		}
+	}
+}
+
+bool ULyraGameplayAbility_RangedWeapon::StartAsyncBulletTraces(const FRangedWeaponFiringInput& InputData)
+{
+	ULyraRangedWeaponInstance* WeaponData = InputData.WeaponData;
+	check(WeaponData);
+
+	UWorld* World = GetWorld();
+	const int32 BulletsPerCartridge = WeaponData->GetBulletsPerCartridge();
+	if ((World == nullptr) || (BulletsPerCartridge <= 0))
+	{
+		return false;
+	}
+
+	FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(WeaponTrace), /*bTraceComplex=*/ true, /*IgnoreActor=*/ GetAvatarActorFromActorInfo());
+	TraceParams.bReturnPhysicalMaterial = true;
+	AddAdditionalTraceIgnoreActors(TraceParams);
+
+	const ECollisionChannel TraceChannel = DetermineTraceChannel(TraceParams, /*bIsSimulated=*/ false);
+
+	const uint32 CartridgeTraceId = NextCartridgeTraceId++;
+	FTraceDelegate TraceDelegate = FTraceDelegate::CreateUObject(this, &ThisClass::OnAsyncBulletTraceComplete, CartridgeTraceId);
 
-		// Make sure there's always an entry in OutHits so the direction can be used for tracers, etc...
-		if (OutHits.Num() == 0)
+	FPendingCartridgeTrace& CartridgeTrace = PendingCartridgeTraces.Add(CartridgeTraceId);
+	CartridgeTrace.StartTrace = InputData.StartTrace;
+	CartridgeTrace.SweepRadius = WeaponData->GetBulletTraceSweepRadius();
+	CartridgeTrace.Bullets.SetNum(BulletsPerCartridge);
+
+	for (int32 BulletIndex = 0; BulletIndex < BulletsPerCartridge; ++BulletIndex)
+	{
+		// Spread is sampled in the same order as TraceBulletsInCartridge
+		const float BaseSpreadAngle = WeaponData->GetCalculatedSpreadAngle();
+		const float SpreadAngleMultiplier = WeaponData->GetCalculatedSpreadAngleMultiplier();
+		const float ActualSpreadAngle = BaseSpreadAngle * SpreadAngleMultiplier;
+
+		const float HalfSpreadAngleInRadians = FMath::DegreesToRadians(ActualSpreadAngle * 0.5f);
+
+		const FVector BulletDir = VRandConeNormalDistribution(InputData.AimDir, HalfSpreadAngleInRadians, WeaponData->GetSpreadExponent());
+
+		const FVector EndTrace = InputData.StartTrace + (BulletDir * WeaponData->GetMaxDamageRange());
+		CartridgeTrace.Bullets[BulletIndex].EndTrace = EndTrace;
+
+#if ENABLE_DRAW_DEBUG
+		if (LyraConsoleVariables::DrawBulletTracesDuration > 0.0f)
 		{
-			if (!Impact.bBlockingHit)
-			{
-				// Locate the fake 'impact' at the end of the trace
-				Impact.Location = EndTrace;
-				Impact.ImpactPoint = EndTrace;
-			}
+			static float DebugThickness = 1.0f;
+			DrawDebugLine(World, InputData.StartTrace, EndTrace, FColor::Red, false, LyraConsoleVariables::DrawBulletTracesDuration, 0, DebugThickness);
+		}
+#endif // ENABLE_DRAW_DEBUG
+
+		// The line and sweep traces are submitted together so a missed line trace doesn't cost another frame;
+		// UserData holds the bullet index with the low bit flagging the sweep
+		World->AsyncLineTraceByChannel(EAsyncTraceType::Multi, InputData.StartTrace, EndTrace, TraceChannel, TraceParams,
+			FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, BulletIndex * 2);
+		++CartridgeTrace.NumOutstandingTraces;
 
-			OutHits.Add(Impact);
+		if (CartridgeTrace.SweepRadius > 0.0f)
+		{
+			World->AsyncSweepByChannel(EAsyncTraceType::Multi, InputData.StartTrace, EndTrace, FQuat::Identity, TraceChannel, FCollisionShape::MakeSphere(CartridgeTrace.SweepRadius),
+				TraceParams, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, (BulletIndex * 2) + 1);
+			++CartridgeTrace.NumOutstandingTraces;
 		}
 	}
+
+	INC_DWORD_STAT_BY(STAT_LyraAsyncBulletTracesSubmitted, CartridgeTrace.NumOutstandingTraces);
+
+	return true;
+}
+
+void ULyraGameplayAbility_RangedWeapon::OnAsyncBulletTraceComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum, uint32 CartridgeTraceId)
+{
+	// The ability may have ended while the traces were in flight
+	FPendingCartridgeTrace* CartridgeTrace = PendingCartridgeTraces.Find(CartridgeTraceId);
+	if (CartridgeTrace == nullptr)
+	{
+		return;
+	}
+
+	const int32 BulletIndex = TraceDatum.UserData / 2;
+	const bool bIsSweep = (TraceDatum.UserData & 1) != 0;
+	if (CartridgeTrace->Bullets.IsValidIndex(BulletIndex))
+	{
+		FPendingBulletTrace& BulletTrace = CartridgeTrace->Bullets[BulletIndex];
+		(bIsSweep ? BulletTrace.SweepHits : BulletTrace.LineHits) = MoveTemp(TraceDatum.OutHits);
+	}
+
+	if (--CartridgeTrace->NumOutstandingTraces <= 0)
+	{
+		const FPendingCartridgeTrace CompletedCartridgeTrace = MoveTemp(*CartridgeTrace);
+		PendingCartridgeTraces.Remove(CartridgeTraceId);
+
+		FinishAsyncBulletTraces(CompletedCartridgeTrace);
+	}
+}
+
+void ULyraGameplayAbility_RangedWeapon::FinishAsyncBulletTraces(const FPendingCartridgeTrace& CartridgeTrace)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LyraResolveAsyncBulletTraces);
+
+	if (!IsActive() || (CurrentActorInfo == nullptr))
+	{
+		return;
+	}
+
+	UAbilitySystemComponent* MyAbilityComponent = CurrentActorInfo->AbilitySystemComponent.Get();
+	check(MyAbilityComponent);
+
+	FScopedPredictionWindow ScopedPrediction(MyAbilityComponent, CurrentActivationInfo.GetActivationPredictionKey());
+
+	// Resolve each bullet exactly like DoSingleBulletTrace would have
+	TArray<FHitResult> FoundHits;
+	for (const FPendingBulletTrace& BulletTrace : CartridgeTrace.Bullets)
+	{
+		TArray<FHitResult> AllImpacts;
+		FHitResult Impact = AppendUniqueHitResults(CartridgeTrace.StartTrace, BulletTrace.EndTrace, BulletTrace.LineHits, /*out*/ AllImpacts);
+
+		if ((FindFirstPawnHitResult(AllImpacts) == INDEX_NONE) && (CartridgeTrace.SweepRadius > 0.0f))
+		{
+			TArray<FHitResult> SweepHits;
+			Impact = AppendUniqueHitResults(CartridgeTrace.StartTrace, BulletTrace.EndTrace, BulletTrace.SweepHits, /*out*/ SweepHits);
+
+			MergeSweepHitResults(SweepHits, /*out*/ AllImpacts);
+		}
+
+		AddBulletImpacts(Impact, BulletTrace.EndTrace, AllImpacts, /*out*/ FoundHits);
+	}
+
+	ProcessLocalTargetingHits(FoundHits);
 }
 
 void ULyraGameplayAbility_RangedWeapon::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
@@ -469,6 +638,9 @@ void ULyraGameplayAbility_RangedWeapon::EndAbility(const FGameplayAbilitySpecHan
 		UAbilitySystemComponent* MyAbilityComponent = CurrentActorInfo->AbilitySystemComponent.Get();
 		check(MyAbilityComponent);
 
+		// Drop any shots still waiting on asynchronous traces
+		PendingCartridgeTraces.Reset();
+
 		// When ability ends, consume target data and remove delegate
 		MyAbilityComponent->AbilityTargetDataSetDelegate(CurrentSpecHandle, CurrentActivationInfo.GetActivationPredictionKey()).Remove(OnTargetDataReadyCallbackDelegateHandle);
 		MyAbilityComponent->ConsumeClientReplicatedTargetData(CurrentSpecHandle, CurrentActivationInfo.GetActivationPredictionKey());
@@ -562,15 +734,30 @@ void ULyraGameplayAbility_RangedWeapon::StartRangedWeaponTargeting()
 	UAbilitySystemComponent* MyAbilityComponent = CurrentActorInfo->AbilitySystemComponent.Get();
 	check(MyAbilityComponent);
 
-	AController* Controller = GetControllerFromActorInfo();
-	check(Controller);
-	ULyraWeaponStateComponent* WeaponStateComponent = Controller->FindComponentByClass<ULyraWeaponStateComponent>();
-
 	FScopedPredictionWindow ScopedPrediction(MyAbilityComponent, CurrentActivationInfo.GetActivationPredictionKey());
 
+	// Optionally hand the traces off to the world's async trace tasks, the target data is then processed when they complete
+	if (LyraConsoleVariables::bAsyncBulletTraces)
+	{
+		FRangedWeaponFiringInput InputData;
+		if (GetLocalFiringInput(/*out*/ InputData) && StartAsyncBulletTraces(InputData))
+		{
+			return;
+		}
+	}
+
 	TArray<FHitResult> FoundHits;
 	PerformLocalTargeting(/*out*/ FoundHits);
 
+	ProcessLocalTargetingHits(FoundHits);
+}
+
+void ULyraGameplayAbility_RangedWeapon::ProcessLocalTargetingHits(const TArray<FHitResult>& FoundHits)
+{
+	AController* Controller = GetControllerFromActorInfo();
+	check(Controller);
+	ULyraWeaponStateComponent* WeaponStateComponent = Controller->FindComponentByClass<ULyraWeaponStateComponent>();
+
 	// Fill out the target data from the hit results
 	FGameplayAbilityTargetDataHandle TargetData;
 	TargetData.UniqueId = WeaponStateComponent ? WeaponStateComponent->GetUnconfirmedServerSideHitMarkerCount() : 0;
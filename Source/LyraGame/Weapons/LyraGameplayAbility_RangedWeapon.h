@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Equipment/LyraGameplayAbility_FromEquipment.h"
+#include "WorldCollision.h"
 
 #include "LyraGameplayAbility_RangedWeapon.generated.h"
 
@@ -79,9 +80,31 @@ protected:
 		}
 	};
 
+	// Bullet traces submitted as one asynchronous batch, resolved once every trace has completed
+	struct FPendingBulletTrace
+	{
+		FVector EndTrace = FVector::ZeroVector;
+		TArray<FHitResult> LineHits;
+		TArray<FHitResult> SweepHits;
+	};
+
+	struct FPendingCartridgeTrace
+	{
+		FVector StartTrace = FVector::ZeroVector;
+		float SweepRadius = 0.0f;
+		TArray<FPendingBulletTrace> Bullets;
+		int32 NumOutstandingTraces = 0;
+	};
+
 protected:
 	static int32 FindFirstPawnHitResult(const TArray<FHitResult>& HitResults);
 
+	// Appends HitResults to OutHitResults, skipping objects that were already hit, and returns the last hit (or an empty hit spanning the trace)
+	static FHitResult AppendUniqueHitResults(const FVector& StartTrace, const FVector& EndTrace, const TArray<FHitResult>& HitResults, OUT TArray<FHitResult>& OutHitResults);
+
+	// Replaces OutHits with SweepHits if the sweep hit a pawn that isn't blocked by something the line trace already hit
+	static void MergeSweepHitResults(const TArray<FHitResult>& SweepHits, OUT TArray<FHitResult>& OutHits);
+
 	// Does a single weapon trace, either sweeping or ray depending on if SweepRadius is above zero
 	FHitResult WeaponTrace(const FVector& StartTrace, const FVector& EndTrace, float SweepRadius, bool bIsSimulated, OUT TArray<FHitResult>& OutHitResults) const;
 
@@ -91,6 +114,16 @@ protected:
 	// Traces all of the bullets in a single cartridge
 	void TraceBulletsInCartridge(const FRangedWeaponFiringInput& InputData, OUT TArray<FHitResult>& OutHits);
 
+	// Adds the hits from a single bullet to the cartridge results
+	void AddBulletImpacts(const FHitResult& Impact, const FVector& EndTrace, const TArray<FHitResult>& AllImpacts, OUT TArray<FHitResult>& OutHits) const;
+
+	// Submits all of the bullets in a single cartridge as one batch of asynchronous traces, returns false if nothing was submitted
+	bool StartAsyncBulletTraces(const FRangedWeaponFiringInput& InputData);
+
+	void OnAsyncBulletTraceComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum, uint32 CartridgeTraceId);
+
+	void FinishAsyncBulletTraces(const FPendingCartridgeTrace& CartridgeTrace);
+
 	virtual void AddAdditionalTraceIgnoreActors(FCollisionQueryParams& TraceParams) const;
 
 	// Determine the trace channel to use for the weapon trace(s)
@@ -98,6 +131,12 @@ protected:
 
 	void PerformLocalTargeting(OUT TArray<FHitResult>& OutHits);
 
+	// Fills out the firing input for a locally controlled avatar, returns false if we can't fire locally
+	bool GetLocalFiringInput(OUT FRangedWeaponFiringInput& OutInputData) const;
+
+	// Turns the local targeting hits into target data and processes it
+	void ProcessLocalTargetingHits(const TArray<FHitResult>& FoundHits);
+
 	FVector GetWeaponTargetingSourceLocation() const;
 	FTransform GetTargetingTransform(APawn* SourcePawn, ELyraAbilityTargetingSource Source) const;
 
@@ -112,4 +151,9 @@ protected:
 
 private:
 	FDelegateHandle OnTargetDataReadyCallbackDelegateHandle;
+
+	// Cartridges waiting on asynchronous traces, cleared when the ability ends
+	TMap<uint32, FPendingCartridgeTrace> PendingCartridgeTraces;
+
+	uint32 NextCartridgeTraceId = 0;
 };